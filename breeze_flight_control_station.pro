@@ -4,7 +4,7 @@
 #
 #-------------------------------------------------
 
-QT       += core gui svg multimedia multimediawidgets serialport
+QT       += core gui multimedia multimediawidgets serialport concurrent
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets printsupport
 
@@ -19,6 +19,7 @@ INCLUDEPATH += \
     include/fcs_instrucment \
     include/fcs_instrucment_widget \
     lib/communication_link/include \
+    lib/communication_record/include \
     lib/communication_serial/include \
     lib/qcustomplot
 
@@ -29,19 +30,42 @@ LIBS += \
 HEADERS += \
     include/flight_control_station.h \
     include/fcs_instrucment/fcs_instrucment_pfd.h \
+    include/fcs_instrucment/fcs_instrucment_profiler.h \
+    include/fcs_instrucment/fcs_instrucment_digit_item.h \
+    include/fcs_instrucment/fcs_instrucment_dashboard.h \
+    include/fcs_instrucment/fcs_instrucment_render_clock.h \
+    include/fcs_instrucment/fcs_instrucment_svg_cache.h \
+    include/fcs_instrucment/fcs_instrucment_terrain_item.h \
+    include/fcs_instrucment/fcs_instrucment_value_filter.h \
+    include/fcs_instrucment/fcs_instrucment_view.h \
+    include/fcs_instrucment/fcs_instrucment_viewport.h \
+    include/fcs_instrucment_widget/fcs_instrucment_widget.h \
     include/fcs_instrucment_widget/fcs_instrucment_widget_pfd.h \
     include/fcs_instrucment_layout.h \
     include/fcs_custom_tab_style.h \
     include/fcs_custom_tab_widget.h
 
 HEADERS += \
+    lib/communication_record/include/communication_record_export.h \
+    lib/communication_record/include/communication_record_format.h \
+    lib/communication_record/include/communication_record_reader.h \
+    lib/communication_record/include/communication_record_writer.h \
     lib/qcustomplot/qcustomplot.h
 
 SOURCES += \
     src/flight_control_station.cpp \
     src/main.cpp \
     src/fcs_instrucment/fcs_instrucment_pfd.cpp \
-    src/fcs_instrucment_widget/fcs_instrucment_widget_pfd.cpp \
+    src/fcs_instrucment/fcs_instrucment_profiler.cpp \
+    src/fcs_instrucment/fcs_instrucment_digit_item.cpp \
+    src/fcs_instrucment/fcs_instrucment_dashboard.cpp \
+    src/fcs_instrucment/fcs_instrucment_render_clock.cpp \
+    src/fcs_instrucment/fcs_instrucment_svg_cache.cpp \
+    src/fcs_instrucment/fcs_instrucment_terrain_item.cpp \
+    src/fcs_instrucment/fcs_instrucment_value_filter.cpp \
+    src/fcs_instrucment/fcs_instrucment_view.cpp \
+    src/fcs_instrucment/fcs_instrucment_viewport.cpp \
+    src/fcs_instrucment_widget/fcs_instrucment_widget.cpp \
     src/fcs_instrucment_layout.cpp \
     src/fcs_custom_tab_widget.cpp
 
@@ -51,11 +75,16 @@ SOURCES += \
 #    lib/communication_serial/src/communication_serial_interface.cpp \
 #    lib/communication_link/src/communication_link.cpp \
 #    lib/communication_link/src/communication_data_type.cpp
+    lib/communication_record/src/communication_record_export.cpp \
+    lib/communication_record/src/communication_record_format.cpp \
+    lib/communication_record/src/communication_record_reader.cpp \
+    lib/communication_record/src/communication_record_writer.cpp \
     lib/qcustomplot/qcustomplot.cpp
 
 FORMS += \
-    form/flight_control_station.ui \
-    form/fcs_instrucment_widget/fcs_instrucment_widget_pfd.ui
+    form/flight_control_station.ui
 
 RESOURCES += \
     breeze_flight_control_station.qrc
+
+include(tools/breeze_svg_compiler/breeze_svg_compiler.pri)
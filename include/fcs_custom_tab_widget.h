@@ -42,8 +42,40 @@
 #ifndef FCS_CUSTOM_TAB_WIDGET_H
 #define FCS_CUSTOM_TAB_WIDGET_H
 
+#include <QMultiHash>
+#include <QObject>
 #include <QTabWidget>
 
+class QCustomPlot;
+
+class FCSCustomTabConsumer
+{
+public:
+    virtual ~FCSCustomTabConsumer() {}
+    // Stop repainting when tab is hidden, incoming data is still buffered.
+    virtual void pauseTabConsumer(void) = 0;
+    // Catch up with data buffered while paused in a single update.
+    virtual void resumeTabConsumer(void) = 0;
+};
+
+class FCSCustomTabPlot : public QObject, public FCSCustomTabConsumer
+{
+    Q_OBJECT
+
+public:
+    explicit FCSCustomTabPlot(QCustomPlot *plot);
+    ~FCSCustomTabPlot();
+    void pauseTabConsumer(void);
+    void resumeTabConsumer(void);
+public slots:
+    // Replot after data is added, deferred to resume while paused.
+    void replotPlot(void);
+private:
+    QCustomPlot *tab_plot_;
+    bool         tab_paused_;
+    bool         tab_pending_;
+};
+
 class FCSCustomTabWidget : public QTabWidget
 {
     Q_OBJECT
@@ -51,6 +83,15 @@ class FCSCustomTabWidget : public QTabWidget
 public:
     explicit FCSCustomTabWidget(QWidget *parent = 0);
     ~FCSCustomTabWidget();
+    // Register consumer fed with data shown on tab, it is paused at once if
+    // tab is not current. Consumer must be unregistered before deletion.
+    void registerTabConsumer(QWidget *tab, FCSCustomTabConsumer *consumer);
+    void unregisterTabConsumer(FCSCustomTabConsumer *consumer);
+private slots:
+    void switchTabConsumers(int index);
+private:
+    QMultiHash<QWidget *, FCSCustomTabConsumer *>  tab_consumers_;
+    QWidget                                       *tab_current_;
 };
 
 
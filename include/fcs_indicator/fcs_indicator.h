@@ -1,7 +1,6 @@
 /******************************************************************************
  * Software License Agreement (GPL V3 License)
  *
- * Copyright (C) 2013 Marek M. Cel
  * Copyright (c) 2018 myyerrol(Team MicroDynamics)
  *
  * This file is part of breeze_flight_control_station.
@@ -23,65 +22,47 @@
 
  ******************************************************************************
  * File:
- * fcs_instrucment_widget_alt.cpp
+ * fcs_indicator.h
  *
  * Author:
- * Marek M. Cel<marekcel@marekcel.pl>
  * myyerrol<myyerrol@126.com>
  *
  * History:
  * <Authors>     <Date>         <Version>     <Operation>
- * Marek M. Cel  2013.--.--     --            Finish ALT widget
- * myyerrol      2018.03.14     1.0.0         Modify ALT widget
+ * myyerrol      2026.10.19     1.0.0         Create this file
  *
  * Description:
- * This .cpp file implements the widget of Altimeter(ALT) according to
- * QFlightInstruments project.
+ * This .h file defines the base of indicators, which coalesces repaints on
+ * the render clock and keys the cached layers.
  *****************************************************************************/
 
-#include <fcs_instrucment_widget_alt.h>
-#include <ui_fcs_instrucment_widget_alt.h>
+#ifndef FLIGHT_INDICATOR_H
+#define FLIGHT_INDICATOR_H
 
-FCSInstrucmentWidgetALT::FCSInstrucmentWidgetALT(QWidget *parent) :
-    QWidget(parent),
-    widget_ui_(new Ui::FCSInstrucmentWidgetALT),
-    widget_alt_(0),
-    widget_layout_(0)
-{
-    widget_ui_->setupUi(this);
-
-    setupWidgetUi();
-
-    widget_alt_ = widget_ui_->graphics_view_alt;
-}
+#include <QPixmap>
+#include <QWidget>
 
-FCSInstrucmentWidgetALT::~FCSInstrucmentWidgetALT()
+class FlightIndicator : public QWidget
 {
-    if (widget_layout_) {
-        delete widget_layout_;
-    }
-    else {
-        ;
-    }
-
-    widget_layout_ = 0;
-
-    if (widget_ui_) {
-        delete widget_ui_;
-    }
-    else {
-        ;
-    }
-
-    widget_ui_ = 0;
-}
-
-void FCSInstrucmentWidgetALT::setupWidgetUi(void)
-{
-    widget_layout_ = new FCSInstrucmentLayout(this);
-
-    widget_layout_->setContentsMargins(0, 0, 0, 0);
-    widget_layout_->addWidget(widget_ui_->graphics_view_alt);
+    Q_OBJECT
+public:
+    explicit FlightIndicator(QWidget *parent = 0);
+    virtual ~FlightIndicator();
+protected slots:
+    // Repaint once per render clock frame if any setter ran since the last.
+    void updateCanvas(void);
+protected:
+    // Rebuild the layers when the given size or the pixel ratio changed.
+    // param1: The size in pixels the layers are drawn for.
+    void    checkLayers(int size);
+    void    requestCanvas(void);
+    QPixmap createLayer(int width, int height);
+    virtual void initLayers(void) = 0;
+protected:
+    double  layer_ratio_;
+private:
+    int     layer_size_;
+    bool    canvas_dirty_;
+};
 
-    setLayout(widget_layout_);
-}
+#endif // FLIGHT_INDICATOR_H
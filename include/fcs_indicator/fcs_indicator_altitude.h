@@ -42,12 +42,13 @@
 #ifndef FLIGHT_ALTITUDE_INDICATOR_H
 #define FLIGHT_ALTITUDE_INDICATOR_H
 
-#include <QWidget>
+#include <QPixmap>
+#include <fcs_indicator.h>
 
 #define VALUE_STEP_ALTITUDE 0.01
 #define VALUE_STEP_HEIGHT   0.01
 
-class FlightAltitudeIndicator : public QWidget
+class FlightAltitudeIndicator : public FlightIndicator
 {
     Q_OBJECT
 public:
@@ -58,21 +59,21 @@ public:
     void setHeight(double height);
     double getAltitude(void);
     double getHeight(void);
-signals:
-    void replotCanvas(void);
-protected slots:
-    void updateCanvas(void);
 protected:
     void paintEvent(QPaintEvent *);
     void resizeEvent(QResizeEvent *);
     void keyPressEvent(QKeyEvent *event);
+    void initLayers(void);
 private:
-    int    widget_size_min_;
-    int    widget_size_max_;
-    int    widget_size_curr_;
-    int    widget_size_offset_;
-    double altitude_;
-    double height_;
+    int     widget_size_min_;
+    int     widget_size_max_;
+    int     widget_size_curr_;
+    int     widget_size_offset_;
+    double  altitude_;
+    double  height_;
+    QPixmap layer_dial_;
+    QPixmap layer_arrow_;
+    QPixmap layer_readout_;
 };
 
 #endif // FLIGHT_ALTITUDE_INDICATOR_H
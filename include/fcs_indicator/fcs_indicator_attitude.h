@@ -42,11 +42,12 @@
 #ifndef FLIGHT_ATTITUDE_INDICATOR_H
 #define FLIGHT_ATTITUDE_INDICATOR_H
 
-#include <QWidget>
+#include <QPixmap>
+#include <fcs_indicator.h>
 
 #define VALUE_STEP_ATTITUDE 1
 
-class FlightAttitudeIndicator : public QWidget
+class FlightAttitudeIndicator : public FlightIndicator
 {
     Q_OBJECT
 public:
@@ -57,21 +58,21 @@ public:
     void setRoll(double roll);
     double getPitch(void);
     double getRoll(void);
-signals:
-    void replotCanvas(void);
-protected slots:
-    void updateCanvas(void);
 protected:
     void paintEvent(QPaintEvent *);
     void resizeEvent(QResizeEvent *);
     void keyPressEvent(QKeyEvent *event);
+    void initLayers(void);
 private:
-    int    widget_size_min_;
-    int    widget_size_max_;
-    int    widget_size_curr_;
-    int    widget_size_offset_;
-    double pitch_;
-    double roll_;
+    int     widget_size_min_;
+    int     widget_size_max_;
+    int     widget_size_curr_;
+    int     widget_size_offset_;
+    double  pitch_;
+    double  roll_;
+    QPixmap layer_ladder_;
+    QPixmap layer_dial_;
+    QPixmap layer_marker_;
 };
 
 #endif // FLIGHT_ATTITUDE_INDICATOR_H
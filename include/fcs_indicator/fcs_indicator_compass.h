@@ -42,11 +42,12 @@
 #ifndef FLIGHT_COMPASS_INDICATOR_H
 #define FLIGHT_COMPASS_INDICATOR_H
 
-#include <QWidget>
+#include <QPixmap>
+#include <fcs_indicator.h>
 
 #define VALUE_STEP_COMPASS 1
 
-class FlightCompassIndicator : public QWidget
+class FlightCompassIndicator : public FlightIndicator
 {
     Q_OBJECT
 public:
@@ -54,20 +55,19 @@ public:
     ~FlightCompassIndicator();
     void setYaw(double yaw);
     double getYaw(void);
-signals:
-    void replotCanvas(void);
-protected slots:
-    void updateCanvas(void);
 protected:
     void paintEvent(QPaintEvent *);
     void resizeEvent(QResizeEvent *);
     void keyPressEvent(QKeyEvent *event);
+    void initLayers(void);
 private:
-    int    widget_size_min_;
-    int    widget_size_max_;
-    int    widget_size_curr_;
-    int    widget_size_offset_;
-    double yaw_;
+    int     widget_size_min_;
+    int     widget_size_max_;
+    int     widget_size_curr_;
+    int     widget_size_offset_;
+    double  yaw_;
+    QPixmap layer_dial_;
+    QPixmap layer_quadrotor_;
 };
 
 #endif // FLIGHT_COMPASS_INDICATOR_H
@@ -43,9 +43,11 @@
 #define FCS_INSTRUCMENT_ATTITUDE_H
 
 #include <QGraphicsView>
-#include <QGraphicsSvgItem>
+#include <fcs_instrucment_render_clock.h>
+#include <fcs_instrucment_svg_cache.h>
+#include <fcs_instrucment_view.h>
 
-class FCSInstrucmentADI : public QGraphicsView
+class FCSInstrucmentADI : public FCSInstrucmentView
 {
     Q_OBJECT
 
@@ -53,21 +55,23 @@ public:
     FCSInstrucmentADI(QWidget *parent = 0);
     virtual ~FCSInstrucmentADI();
     void reinitADI(void);
-    void updateADI(void);
     void setADIAngleRoll(float angle_roll);
     void setADIAnglePitch(float angle_pitch);
+public slots:
+    void updateADI(void);
 protected:
+    void initInstrucment(void);
     void resizeEvent(QResizeEvent *event);
 private:
     void initADI(void);
     void resetADI(void);
     void updateADIView(void);
 private:
-    QGraphicsScene   *adi_scene_;
-    QGraphicsSvgItem *adi_item_back_;
-    QGraphicsSvgItem *adi_item_face_;
-    QGraphicsSvgItem *adi_item_ring_;
-    QGraphicsSvgItem *adi_item_case_;
+    QGraphicsScene        *adi_scene_;
+    FCSInstrucmentSvgItem *adi_item_back_;
+    FCSInstrucmentSvgItem *adi_item_face_;
+    FCSInstrucmentSvgItem *adi_item_ring_;
+    FCSInstrucmentSvgItem *adi_item_case_;
     float adi_angle_roll_;
     float adi_angle_pitch_;
     float adi_face_delta_x_new_;
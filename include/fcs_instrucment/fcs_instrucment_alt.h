@@ -43,9 +43,11 @@
 #define FCS_INSTRUCMENT_ALTITUDE_H
 
 #include <QGraphicsView>
-#include <QGraphicsSvgItem>
+#include <fcs_instrucment_render_clock.h>
+#include <fcs_instrucment_svg_cache.h>
+#include <fcs_instrucment_view.h>
 
-class FCSInstrucmentALT : public QGraphicsView
+class FCSInstrucmentALT : public FCSInstrucmentView
 {
     Q_OBJECT
 
@@ -53,23 +55,25 @@ public:
     FCSInstrucmentALT(QWidget *parent = 0);
     virtual ~FCSInstrucmentALT();
     void reinitALT(void);
-    void updateALT(void);
     void setALTAltitude(float altitude);
     void setALTPressure(float pressure);
+public slots:
+    void updateALT(void);
 protected:
+    void initInstrucment(void);
     void resizeEvent(QResizeEvent *event);
 private:
     void initALT(void);
     void resetALT(void);
     void updateALTView(void);
 private:
-    QGraphicsScene   *alt_scene_;
-    QGraphicsSvgItem *alt_item_face_1_;
-    QGraphicsSvgItem *alt_item_face_2_;
-    QGraphicsSvgItem *alt_item_face_3_;
-    QGraphicsSvgItem *alt_item_hand_1_;
-    QGraphicsSvgItem *alt_item_hand_2_;
-    QGraphicsSvgItem *alt_item_case_;
+    QGraphicsScene        *alt_scene_;
+    FCSInstrucmentSvgItem *alt_item_face_1_;
+    FCSInstrucmentSvgItem *alt_item_face_2_;
+    FCSInstrucmentSvgItem *alt_item_face_3_;
+    FCSInstrucmentSvgItem *alt_item_hand_1_;
+    FCSInstrucmentSvgItem *alt_item_hand_2_;
+    FCSInstrucmentSvgItem *alt_item_case_;
     float alt_altitude_;
     float alt_pressure_;
     float alt_scale_x_;
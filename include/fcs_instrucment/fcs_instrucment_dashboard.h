@@ -0,0 +1,190 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_dashboard.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines a dashboard hosting several instrucment panels as item
+ * groups of one scene, so they share one viewport and one repaint pass.
+ *****************************************************************************/
+
+#ifndef FCS_INSTRUCMENT_DASHBOARD_H
+#define FCS_INSTRUCMENT_DASHBOARD_H
+
+#include <QGraphicsItemGroup>
+#include <QGraphicsView>
+#include <QList>
+#include <fcs_instrucment_render_clock.h>
+#include <fcs_instrucment_svg_cache.h>
+#include <fcs_instrucment_view.h>
+
+// Instrucment Dashboard Widget.
+class FCSInstrucmentDashboard : public FCSInstrucmentView
+{
+    Q_OBJECT
+
+public:
+    // Dashboard panels.
+    enum PanelType
+    {
+        PANEL_ADI,  // Attitude director indicator.
+        PANEL_ALT,  // Altimeter.
+        PANEL_HSI   // Horizontal situation indicator.
+    };
+public:
+    FCSInstrucmentDashboard(QWidget *parent = 0);
+    virtual ~FCSInstrucmentDashboard();
+    // Place panel on layout grid, cells are square and panels are drawn in
+    // original units of cell, so one view transform fits all of them.
+    // param1: panel type according to PanelType.
+    // param2: row of top left cell.
+    // param3: column of top left cell.
+    // param4: cells covered by panel in both directions.
+    // return: panel index for setters, -1 if place is invalid.
+    int addDashboardPanel(PanelType panel_type, int row, int column,
+                          int span = 1);
+    // Remove all panels.
+    void clearDashboardPanels(void);
+    // Set roll angle of ADI panel.
+    // param1: panel index.
+    // param2: roll angle [deg].
+    void setDashboardAngleRoll(int panel, float angle_roll);
+    // Set pitch angle of ADI panel.
+    // param1: panel index.
+    // param2: pitch angle [deg].
+    void setDashboardAnglePitch(int panel, float angle_pitch);
+    // Set altitude of ALT panel.
+    // param1: panel index.
+    // param2: altitude [ft].
+    void setDashboardAltitude(int panel, float altitude);
+    // Set pressure of ALT panel.
+    // param1: panel index.
+    // param2: pressure [inHg].
+    void setDashboardPressure(int panel, float pressure);
+    // Set heading of HSI panel.
+    // param1: panel index.
+    // param2: heading [deg].
+    void setDashboardHeading(int panel, float heading);
+public slots:
+    // Refreshes(redraws) all panels, driven by render clock once per frame.
+    void updateDashboard(void);
+protected:
+    void initInstrucment(void);
+    void resizeEvent(QResizeEvent *event);
+private:
+    // Base of dashboard panels, items are children of panel group and
+    // setters of other panel types are ignored.
+    class Panel
+    {
+    public:
+        Panel(QGraphicsItemGroup *group);
+        virtual ~Panel();
+        // Create items of panel in its group.
+        virtual void initPanel(void) = 0;
+        virtual void updatePanel(void) = 0;
+        virtual void setPanelAngleRoll(float angle_roll);
+        virtual void setPanelAnglePitch(float angle_pitch);
+        virtual void setPanelAltitude(float altitude);
+        virtual void setPanelPressure(float pressure);
+        virtual void setPanelHeading(float heading);
+        QGraphicsItemGroup *getPanelGroup(void) const;
+    protected:
+        FCSInstrucmentSvgItem *createPanelItem(const QString &path, int z,
+                                               bool rotating);
+    protected:
+        QGraphicsItemGroup *panel_group_;
+        bool                panel_dirty_;
+        QPointF             panel_original_ctr_;
+    };
+    // Attitude Director Indicator(ADI) Panel.
+    class PanelADI : public Panel
+    {
+    public:
+        PanelADI(QGraphicsItemGroup *group);
+        void initPanel(void);
+        void updatePanel(void);
+        void setPanelAngleRoll(float angle_roll);
+        void setPanelAnglePitch(float angle_pitch);
+    private:
+        FCSInstrucmentSvgItem *adi_item_back_;
+        FCSInstrucmentSvgItem *adi_item_face_;
+        FCSInstrucmentSvgItem *adi_item_ring_;
+        FCSInstrucmentSvgItem *adi_item_case_;
+        float                  adi_angle_roll_;
+        float                  adi_angle_pitch_;
+        const float            adi_original_pix_per_deg_;
+    };
+    // Altimeter(ALT) Panel.
+    class PanelALT : public Panel
+    {
+    public:
+        PanelALT(QGraphicsItemGroup *group);
+        void initPanel(void);
+        void updatePanel(void);
+        void setPanelAltitude(float altitude);
+        void setPanelPressure(float pressure);
+    private:
+        FCSInstrucmentSvgItem *alt_item_face_1_;
+        FCSInstrucmentSvgItem *alt_item_face_2_;
+        FCSInstrucmentSvgItem *alt_item_face_3_;
+        FCSInstrucmentSvgItem *alt_item_hand_1_;
+        FCSInstrucmentSvgItem *alt_item_hand_2_;
+        FCSInstrucmentSvgItem *alt_item_case_;
+        float                  alt_altitude_;
+        float                  alt_pressure_;
+    };
+    // Horizontal Situation Indicator(HSI) Panel.
+    class PanelHSI : public Panel
+    {
+    public:
+        PanelHSI(QGraphicsItemGroup *group);
+        void initPanel(void);
+        void updatePanel(void);
+        void setPanelHeading(float heading);
+    private:
+        FCSInstrucmentSvgItem *hsi_item_face_;
+        FCSInstrucmentSvgItem *hsi_item_case_;
+        float                  hsi_heading_;
+    };
+private:
+    void reinitDashboard(void);
+    Panel *getDashboardPanel(int panel) const;
+private:
+    QGraphicsScene  *dashboard_scene_;
+    QList<Panel *>   dashboard_panels_;
+    // Dashboard layout variables, counted in cells.
+    int dashboard_rows_;
+    int dashboard_columns_;
+    // Dashboard original variables.
+    const int dashboard_original_cell_;
+};
+
+#endif // FCS_INSTRUCMENT_DASHBOARD_H
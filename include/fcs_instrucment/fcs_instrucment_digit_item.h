@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_digit_item.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines a fixed width text item of instrucments, which draws
+ * readouts and scale labels from pre-shaped glyphs instead of laying out a
+ * text document.
+ *****************************************************************************/
+
+#ifndef FCS_INSTRUCMENT_DIGIT_ITEM_H
+#define FCS_INSTRUCMENT_DIGIT_ITEM_H
+
+#include <QColor>
+#include <QFont>
+#include <QGraphicsItem>
+#include <QHash>
+#include <QPainter>
+#include <QStaticText>
+
+#define DIGIT_ITEM_LENGTH_MAX 16
+#define DIGIT_ITEM_GLYPH_MIN  32
+#define DIGIT_ITEM_GLYPH_MAX  127
+
+class FCSInstrucmentDigitItem : public QGraphicsItem
+{
+public:
+    // Construct item with a fixed number of character cells.
+    // param1: font of glyphs, expected to be monospaced.
+    // param2: color of glyphs.
+    // param3: number of character cells.
+    FCSInstrucmentDigitItem(const QFont &font, const QColor &color,
+                            int length, QGraphicsItem *parent = 0);
+    ~FCSInstrucmentDigitItem();
+    QRectF boundingRect() const;
+    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
+               QWidget *widget = 0);
+    // Set integer padded with fill character like QString::arg, the item
+    // is only repainted when displayed text changes.
+    // param1: integer number.
+    // param2: minimum field width.
+    // param3: fill character.
+    void setDigitNumber(int number, int width = 0, char fill = ' ');
+    // Set ascii text centered in cells, the item is only repainted when it
+    // changes.
+    // param1: ascii text, truncated to number of cells.
+    void setDigitText(const char *text);
+    // Place item so that its cells are centered on point.
+    // param1: center point in parent coordinates.
+    void setDigitCenter(const QPointF &center);
+private:
+    // Pre-shaped glyphs of printable ascii characters for one font.
+    struct GlyphAtlas
+    {
+        QFont       atlas_font;
+        qreal       atlas_advance;
+        qreal       atlas_height;
+        QStaticText atlas_glyph[DIGIT_ITEM_GLYPH_MAX - DIGIT_ITEM_GLYPH_MIN];
+    };
+    static GlyphAtlas *getGlyphAtlas(const QFont &font);
+private:
+    GlyphAtlas *digit_atlas_;
+    QColor      digit_color_;
+    int         digit_length_;
+    int         digit_number_;
+    int         digit_width_;
+    char        digit_fill_;
+    bool        digit_number_valid_;
+    int         digit_text_length_;
+    char        digit_text_[DIGIT_ITEM_LENGTH_MAX + 1];
+};
+
+#endif // FCS_INSTRUCMENT_DIGIT_ITEM_H
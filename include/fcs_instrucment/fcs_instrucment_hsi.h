@@ -43,9 +43,11 @@
 #define FCS_INSTRUCMENT_COMPASS_H
 
 #include <QGraphicsView>
-#include <QGraphicsSvgItem>
+#include <fcs_instrucment_render_clock.h>
+#include <fcs_instrucment_svg_cache.h>
+#include <fcs_instrucment_view.h>
 
-class FCSInstrucmentHSI : public QGraphicsView
+class FCSInstrucmentHSI : public FCSInstrucmentView
 {
     Q_OBJECT
 
@@ -53,18 +55,20 @@ public:
     FCSInstrucmentHSI(QWidget *parent = 0);
     virtual ~FCSInstrucmentHSI();
     void reinitHSI(void);
-    void updateHSI(void);
     void setHSIHeading(float heading);
+public slots:
+    void updateHSI(void);
 protected:
+    void initInstrucment(void);
     void resizeEvent(QResizeEvent *event);
 private:
     void initHSI(void);
     void resetHSI(void);
     void updateHSIView(void);
 private:
-    QGraphicsScene   *hsi_scene_;
-    QGraphicsSvgItem *hsi_item_face_;
-    QGraphicsSvgItem *hsi_item_case_;
+    QGraphicsScene        *hsi_scene_;
+    FCSInstrucmentSvgItem *hsi_item_face_;
+    FCSInstrucmentSvgItem *hsi_item_case_;
     float hsi_heading_;
     float hsi_scale_x_;
     float hsi_scale_y_;
@@ -42,11 +42,19 @@
 #ifndef FCS_INSTRUCMENT_PFD_H
 #define FCS_INSTRUCMENT_PFD_H
 
+#include <QElapsedTimer>
 #include <QGraphicsView>
-#include <QGraphicsSvgItem>
+#include <fcs_instrucment_digit_item.h>
+#include <fcs_instrucment_render_clock.h>
+#include <fcs_instrucment_svg_cache.h>
+#include <fcs_instrucment_terrain_item.h>
+#include <fcs_instrucment_value_filter.h>
+#include <fcs_instrucment_view.h>
+
+#define PFD_ITEM_PANEL_KEY 0
 
 // Primary Flight Display Instrument Widget.
-class FCSInstrucmentPFD : public QGraphicsView
+class FCSInstrucmentPFD : public FCSInstrucmentView
 {
     Q_OBJECT
 
@@ -58,24 +66,53 @@ public:
         MB,  // Milibars.
         IN   // Inches of mercury.
     };
+    // PFD panels, every item in scene carries its panel as data with key
+    // PFD_ITEM_PANEL_KEY, so tools can measure panels apart.
+    enum PanelType
+    {
+        PANEL_ADI,
+        PANEL_ALT,
+        PANEL_ASI,
+        PANEL_HSI,
+        PANEL_VSI,
+        PANEL_PFD  // Back and mask shared by all panels.
+    };
+    // PFD render modes.
+    enum RenderMode
+    {
+        VECTOR, // Every layer renders from svg vectors on each repaint.
+        CACHED  // Static and translation-only layers render from pixmaps.
+    };
 public:
     explicit FCSInstrucmentPFD(QWidget *parent = 0);
     ~FCSInstrucmentPFD();
-    // Reinitates widget.
+    // Refits widget to its current size, items are kept alive.
     void reinitPFD(void);
-    // Refreshes(redraws) widget.
-    void updatePFD(void);
+    // Set render mode.
+    // param1: render mode according to RenderMode.
+    void setPFDRenderMode(RenderMode render_mode);
+    // Set filter mode of attitude, altitude, airspeed, heading and climb
+    // rate, which are presented at display rate between samples.
+    // param1: filter mode according to FCSInstrucmentValueFilter.
+    void setPFDFilterMode(FCSInstrucmentValueFilter::FilterMode filter_mode);
+    // Set angular rate used to extrapolate attitude and heading.
+    // param1: roll rate [deg/s].
+    // param2: pitch rate [deg/s].
+    // param3: yaw rate [deg/s].
+    void setPFDAngularRate(float roll_rate, float pitch_rate, float yaw_rate);
     // Set roll angle.
     // param1: roll angle [deg].
     inline void setPFDAngleRoll(float angle_roll)
     {
-        pfd_panel_adi_->setADIAngleRoll(angle_roll);
+        pfd_filter_roll_.addSample(angle_roll, getPFDTime());
+        requestPFDFrame();
     }
     // Set pitch angle.
     // param1: pitch angle [deg].
     inline void setPFDAnglePitch(float angle_pitch)
     {
-        pfd_panel_adi_->setADIAnglePitch(angle_pitch);
+        pfd_filter_pitch_.addSample(angle_pitch, getPFDTime());
+        requestPFDFrame();
     }
     // Set flight path marker.
     // param1: angle of attach [deg].
@@ -87,12 +124,14 @@ public:
     {
         pfd_panel_adi_->setADIFlightPathMarker(angle_attack, angle_sideslip,
                                                visible);
+        requestPFDFrame();
     }
     // Set slip or skid.
     // param1: normalized slip or skid(range from -1.0 to 1.0).
     inline void setPFDSlipSkid(float slip_skid)
     {
         pfd_panel_adi_->setADISlipSkid(slip_skid);
+        requestPFDFrame();
     }
     // Set turn rate.
     // param1: normalized turn rate (range from -1.0 to 1.0), hash marks
@@ -100,6 +139,7 @@ public:
     inline void setPFDTurnRate(float turn_rate)
     {
         pfd_panel_adi_->setADITurnRate(turn_rate);
+        requestPFDFrame();
     }
     // Set horizontal deviation bar position.
     // param1: normalized horizontal deviation bar position (range from -1.0 to 1.0).
@@ -107,6 +147,7 @@ public:
     inline void setPFDDeviateBarPositionH(float bar_h, bool visible = true)
     {
         pfd_panel_adi_->setADIDeviateBarPositionH(bar_h, visible);
+        requestPFDFrame();
     }
     // Set vertical deviation bar position.
     // param1: normalized vertical deviation bar position (range from -1.0 to 1.0).
@@ -114,6 +155,7 @@ public:
     inline void setPFDDeviateBarPositionV(float bar_v, bool visible = true)
     {
         pfd_panel_adi_->setADIDeviateBarPositionV(bar_v, visible);
+        requestPFDFrame();
     }
     // Set horizontal deviation dot position.
     // param1: normalized horizontal deviation dot position (range from -1.0 to 1.0).
@@ -121,6 +163,7 @@ public:
     inline void setPFDDeviateDotPositionH(float dot_pos, bool visible = true)
     {
         pfd_panel_adi_->setADIDeviateDotPositionH(dot_pos, visible);
+        requestPFDFrame();
     }
     // Set vertical deviation dot position.
     // param1: normalized vertical deviation dot position (range from -1.0 to 1.0).
@@ -128,12 +171,14 @@ public:
     inline void setPFDDeviateDotPositionV(float dot_pos, bool visible = true)
     {
         pfd_panel_adi_->setADIDeviateDotPositionV(dot_pos, visible);
+        requestPFDFrame();
     }
     // Set Altitude.
     // param1: altitude (dimensionless numeric value).
     inline void setPFDAltitude(float altitude)
     {
-        pfd_panel_alt_->setALTAltitude(altitude);
+        pfd_filter_altitude_.addSample(altitude, getPFDTime());
+        requestPFDFrame();
     }
     // Set pressure.
     // param1: pressure (dimensionless numeric value).
@@ -141,32 +186,58 @@ public:
     inline void setPFDPressure(float pressure, PressureUnit pressure_unit)
     {
         pfd_panel_alt_->setALTPressure(pressure, pressure_unit);
+        requestPFDFrame();
     }
     // Set airspeed.
     // param1: airspeed (dimensionless numeric value).
     inline void setPFDAirspeed(float airspeed)
     {
-        pfd_panel_asi_->setASIAirspeed(airspeed);
+        pfd_filter_airspeed_.addSample(airspeed, getPFDTime());
+        requestPFDFrame();
     }
     // Set Mach number.
     // param1: Mach number.
     inline void setPFDMachNumber(float mach_number)
     {
         pfd_panel_asi_->setASIMachNumber(mach_number);
+        requestPFDFrame();
     }
     // Set heading.
     // param1: heading [deg].
     inline void setPFDHeading(float heading)
     {
-        pfd_panel_hsi_->setHSIHeading(heading);
+        pfd_filter_heading_.addSample(heading, getPFDTime());
+        requestPFDFrame();
     }
     // Set climb rate.
     // param1: climb rate (dimensionless numeric value).
     inline void setPFDClimbRate(float climb_rate)
     {
-        pfd_panel_vsi_->setVSIClimbRate(climb_rate);
+        pfd_filter_climb_rate_.addSample(climb_rate, getPFDTime());
+        requestPFDFrame();
     }
+    // Set heightmap drawn as synthetic vision terrain behind pitch ladder.
+    // param1: path of SRTM heightmap(*.hgt), empty path turns terrain off.
+    // return: true if heightmap is loaded.
+    bool setPFDTerrainFile(const QString &path);
+    // Set geodetic origin of position.
+    // param1: latitude [deg].
+    // param2: longitude [deg].
+    void setPFDTerrainOrigin(double latitude, double longitude);
+    // Set position, used by synthetic vision terrain only.
+    // param1: north of origin [m].
+    // param2: east of origin [m].
+    // param3: height above ground at origin [m].
+    inline void setPFDPosition(float x, float y, float z)
+    {
+        pfd_panel_adi_->setADIPosition(x, y, z);
+        requestPFDFrame();
+    }
+public slots:
+    // Refreshes(redraws) widget, driven by render clock once per frame.
+    void updatePFD(void);
 protected:
+    void initInstrucment(void);
     void resizeEvent(QResizeEvent *event);
 private:
     // Attitude Director Indicator(ADI) Panel.
@@ -175,8 +246,9 @@ private:
     public:
         PanelADI(QGraphicsScene *scene);
         ~PanelADI();
-        void initADI(float scale_x, float scale_y);
-        void updateADI(float scale_x, float scale_y);
+        void initADI(void);
+        void updateADI(void);
+        void setADICacheMode(QGraphicsItem::CacheMode cache_mode);
         void setADIAngleRoll(float angle_roll);
         void setADIAnglePitch(float angle_pitch);
         void setADIFlightPathMarker(float angle_attack, float angle_sideslip,
@@ -187,6 +259,9 @@ private:
         void setADIDeviateBarPositionV(float bar_v, bool visible = true);
         void setADIDeviateDotPositionH(float dot_h, bool visible = true);
         void setADIDeviateDotPositionV(float dot_v, bool visible = true);
+        void setADITerrainMap(const FCSInstrucmentTerrainMap *terrain_map);
+        void setADIPosition(float x, float y, float z);
+        void setADIHeading(float heading);
     private:
         void resetADI(void);
         void updateADILadd(float delta, float roll_sin, float roll_cos);
@@ -197,22 +272,35 @@ private:
         void updateADIFlightPath(void);
         void updateADIBars(void);
         void updateADIDots(void);
+        void updateADITerrain(void);
     private:
-        QGraphicsScene    *adi_scene_;
-        QGraphicsSvgItem  *adi_item_back_;
-        QGraphicsSvgItem  *adi_item_ladd_;
-        QGraphicsSvgItem  *adi_item_roll_;
-        QGraphicsSvgItem  *adi_item_slip_;
-        QGraphicsSvgItem  *adi_item_turn_;
-        QGraphicsSvgItem  *adi_item_path_;
-        QGraphicsSvgItem  *adi_item_mark_;
-        QGraphicsSvgItem  *adi_item_bar_h_;
-        QGraphicsSvgItem  *adi_item_bar_v_;
-        QGraphicsSvgItem  *adi_item_dot_h_;
-        QGraphicsSvgItem  *adi_item_dot_v_;
-        QGraphicsSvgItem  *adi_item_mask_;
-        QGraphicsSvgItem  *adi_item_scale_h_;
-        QGraphicsSvgItem  *adi_item_scale_v_;
+        QGraphicsScene            *adi_scene_;
+        FCSInstrucmentSvgItem     *adi_item_back_;
+        FCSInstrucmentTerrainItem *adi_item_terrain_;
+        FCSInstrucmentSvgItem     *adi_item_ladd_;
+        FCSInstrucmentSvgItem     *adi_item_roll_;
+        FCSInstrucmentSvgItem     *adi_item_slip_;
+        FCSInstrucmentSvgItem     *adi_item_turn_;
+        FCSInstrucmentSvgItem     *adi_item_path_;
+        FCSInstrucmentSvgItem     *adi_item_mark_;
+        FCSInstrucmentSvgItem     *adi_item_bar_h_;
+        FCSInstrucmentSvgItem     *adi_item_bar_v_;
+        FCSInstrucmentSvgItem     *adi_item_dot_h_;
+        FCSInstrucmentSvgItem     *adi_item_dot_v_;
+        FCSInstrucmentSvgItem     *adi_item_mask_;
+        FCSInstrucmentSvgItem     *adi_item_scale_h_;
+        FCSInstrucmentSvgItem     *adi_item_scale_v_;
+        // ADI cache mode.
+        QGraphicsItem::CacheMode adi_cache_mode_;
+        // ADI dirty variables.
+        bool adi_dirty_;
+        bool adi_dirty_attitude_;
+        bool adi_dirty_slip_;
+        bool adi_dirty_turn_;
+        bool adi_dirty_path_;
+        bool adi_dirty_bars_;
+        bool adi_dirty_dots_;
+        bool adi_dirty_terrain_;
         // ADI basic variables.
         float adi_angle_roll_;
         float adi_angle_pitch_;
@@ -224,6 +312,12 @@ private:
         float adi_bar_v_;
         float adi_dot_h_;
         float adi_dot_v_;
+        // ADI terrain variables.
+        const FCSInstrucmentTerrainMap *adi_terrain_map_;
+        float                           adi_position_x_;
+        float                           adi_position_y_;
+        float                           adi_position_z_;
+        float                           adi_heading_;
         // ADI visible variables.
         bool adi_path_valid_;
         bool adi_path_visible_;
@@ -231,40 +325,6 @@ private:
         bool adi_bar_v_visible_;
         bool adi_dot_h_visible_;
         bool adi_dot_v_visible_;
-        // ADI delta variables.
-        float adi_ladd_delta_x_new_;
-        float adi_ladd_delta_x_old_;
-        float adi_ladd_delta_y_new_;
-        float adi_ladd_delta_y_old_;
-        float adi_ladd_back_delta_x_new_;
-        float adi_ladd_back_delta_x_old_;
-        float adi_ladd_back_delta_y_new_;
-        float adi_ladd_back_delta_y_old_;
-        float adi_slip_delta_x_new_;
-        float adi_slip_delta_x_old_;
-        float adi_slip_delta_y_new_;
-        float adi_slip_delta_y_old_;
-        float adi_turn_delta_x_new_;
-        float adi_turn_delta_x_old_;
-        float adi_path_delta_x_new_;
-        float adi_path_delta_x_old_;
-        float adi_path_delta_y_new_;
-        float adi_path_delta_y_old_;
-        float adi_mark_delta_x_new_;
-        float adi_mark_delta_x_old_;
-        float adi_mark_delta_y_new_;
-        float adi_mark_delta_y_old_;
-        float adi_bar_h_delta_x_new_;
-        float adi_bar_h_delta_x_old_;
-        float adi_bar_v_delta_y_new_;
-        float adi_bar_v_delta_y_old_;
-        float adi_dot_h_delta_x_new_;
-        float adi_dot_h_delta_x_old_;
-        float adi_dot_v_delta_y_new_;
-        float adi_dot_v_delta_y_old_;
-        // ADI scale variables.
-        float adi_scale_x_;
-        float adi_scale_y_;
         // ADI deflection variables.
         const float adi_original_pix_per_deg_;
         const float adi_delta_ladd_back_max_;
@@ -273,9 +333,11 @@ private:
         const float adi_max_turn_deflection_;
         const float adi_max_bars_deflection_;
         const float adi_max_dots_deflection_;
+        const float adi_original_terrain_size_;
         // ADI original variables.
         QPointF adi_original_adi_ctr_;
         QPointF adi_original_back_pos_;
+        QPointF adi_original_terrain_pos_;
         QPointF adi_original_ladd_pos_;
         QPointF adi_original_roll_pos_;
         QPointF adi_original_slip_pos_;
@@ -289,6 +351,7 @@ private:
         QPointF adi_original_scale_v_pos_;
         // ADI z variables.
         const int adi_back_z_;
+        const int adi_terrain_z_;
         const int adi_ladd_z_;
         const int adi_roll_z_;
         const int adi_slip_z_;
@@ -305,8 +368,9 @@ private:
     public:
         PanelALT(QGraphicsScene *scene);
         ~PanelALT();
-        void initALT(float scale_x, float scale_y);
-        void updateALT(float scale_x, float scale_y);
+        void initALT(void);
+        void updateALT(void);
+        void setALTCacheMode(QGraphicsItem::CacheMode cache_mode);
         void setALTAltitude(float altitude);
         void setALTPressure(float pressure, int pressure_unit);
     private:
@@ -316,17 +380,23 @@ private:
         void updateALTScale(void);
         void updateALTScaleLabels(void);
     private:
-        QGraphicsScene    *alt_scene_;
-        QGraphicsSvgItem  *alt_item_back_;
-        QGraphicsSvgItem  *alt_item_scale1_;
-        QGraphicsSvgItem  *alt_item_scale2_;
-        QGraphicsTextItem *alt_item_label1_;
-        QGraphicsTextItem *alt_item_label2_;
-        QGraphicsTextItem *alt_item_label3_;
-        QGraphicsSvgItem  *alt_item_ground_;
-        QGraphicsSvgItem  *alt_item_frame_;
-        QGraphicsTextItem *alt_item_altitude_;
-        QGraphicsTextItem *alt_item_pressure_;
+        QGraphicsScene          *alt_scene_;
+        FCSInstrucmentSvgItem   *alt_item_back_;
+        FCSInstrucmentSvgItem   *alt_item_scale1_;
+        FCSInstrucmentSvgItem   *alt_item_scale2_;
+        FCSInstrucmentDigitItem *alt_item_label1_;
+        FCSInstrucmentDigitItem *alt_item_label2_;
+        FCSInstrucmentDigitItem *alt_item_label3_;
+        FCSInstrucmentSvgItem   *alt_item_ground_;
+        FCSInstrucmentSvgItem   *alt_item_frame_;
+        FCSInstrucmentDigitItem *alt_item_altitude_;
+        FCSInstrucmentDigitItem *alt_item_pressure_;
+        // ALT cache mode.
+        QGraphicsItem::CacheMode alt_cache_mode_;
+        // ALT dirty variables.
+        bool alt_dirty_;
+        bool alt_dirty_altitude_;
+        bool alt_dirty_pressure_;
         // ALT color variables.
         QColor alt_frame_text_color_;
         QColor alt_press_text_color_;
@@ -339,18 +409,6 @@ private:
         float alt_pressure_;
         // ALT pressure unit.
         int alt_pressure_unit_;
-        // ALT delta variables.
-        float alt_scale1_delta_y_new_;
-        float alt_scale1_delta_y_old_;
-        float alt_scale2_delta_y_new_;
-        float alt_scale2_delta_y_old_;
-        float alt_ground_delta_y_new_;
-        float alt_ground_delta_y_old_;
-        float alt_labels_delta_y_new_;
-        float alt_labels_delta_y_old_;
-        // ALT scale variables.
-        float alt_scale_x_;
-        float alt_scale_y_;
         // ALT original float variables.
         const float alt_original_pix_per_alt_;
         const float alt_original_scale_height_;
@@ -380,30 +438,38 @@ private:
     public:
         PanelASI(QGraphicsScene *scene);
         ~PanelASI();
-        void initASI(float scale_x, float scale_y);
-        void updateASI(float scale_x, float scale_y);
+        void initASI(void);
+        void updateASI(void);
+        void setASICacheMode(QGraphicsItem::CacheMode cache_mode);
         void setASIAirspeed(float airspeed);
         void setASIMachNumber(float mach_number);
     private:
         void resetASI(void);
         void updateASIAirspeed(void);
+        void updateASIMachNumber(void);
         void updateASIScale(void);
         void updateASIScaleLabels(void);
     private:
-        QGraphicsScene    *asi_scene_;
-        QGraphicsSvgItem  *asi_item_back_;
-        QGraphicsSvgItem  *asi_item_scale1_;
-        QGraphicsSvgItem  *asi_item_scale2_;
-        QGraphicsTextItem *asi_item_label1_;
-        QGraphicsTextItem *asi_item_label2_;
-        QGraphicsTextItem *asi_item_label3_;
-        QGraphicsTextItem *asi_item_label4_;
-        QGraphicsTextItem *asi_item_label5_;
-        QGraphicsTextItem *asi_item_label6_;
-        QGraphicsTextItem *asi_item_label7_;
-        QGraphicsSvgItem  *asi_item_frame_;
-        QGraphicsTextItem *asi_item_airspeed_;
-        QGraphicsTextItem *asi_item_mach_number_;
+        QGraphicsScene          *asi_scene_;
+        FCSInstrucmentSvgItem   *asi_item_back_;
+        FCSInstrucmentSvgItem   *asi_item_scale1_;
+        FCSInstrucmentSvgItem   *asi_item_scale2_;
+        FCSInstrucmentDigitItem *asi_item_label1_;
+        FCSInstrucmentDigitItem *asi_item_label2_;
+        FCSInstrucmentDigitItem *asi_item_label3_;
+        FCSInstrucmentDigitItem *asi_item_label4_;
+        FCSInstrucmentDigitItem *asi_item_label5_;
+        FCSInstrucmentDigitItem *asi_item_label6_;
+        FCSInstrucmentDigitItem *asi_item_label7_;
+        FCSInstrucmentSvgItem   *asi_item_frame_;
+        FCSInstrucmentDigitItem *asi_item_airspeed_;
+        FCSInstrucmentDigitItem *asi_item_mach_number_;
+        // ASI cache mode.
+        QGraphicsItem::CacheMode asi_cache_mode_;
+        // ASI dirty variables.
+        bool asi_dirty_;
+        bool asi_dirty_airspeed_;
+        bool asi_dirty_mach_number_;
         // ASI color variables.
         QColor asi_frame_text_color_;
         QColor asi_labels_color_;
@@ -413,16 +479,6 @@ private:
         // ASI float variables.
         float asi_airspeed_;
         float asi_mach_number_;
-        // ASI delta variables.
-        float asi_scale1_delta_y_new_;
-        float asi_scale1_delta_y_old_;
-        float asi_scale2_delta_y_new_;
-        float asi_scale2_delta_y_old_;
-        float asi_labels_delta_y_new_;
-        float asi_labels_delta_y_old_;
-        // ASI scale variables.
-        float asi_scale_x_;
-        float asi_scale_y_;
         // ASI original float variables.
         const float asi_original_pix_rer_spd_;
         const float asi_original_scale_height_;
@@ -454,27 +510,29 @@ private:
     public:
         PanelHSI(QGraphicsScene *scene);
         ~PanelHSI();
-        void initHSI(float scale_x, float scale_y);
-        void updateHSI(float scale_x, float scale_y);
+        void initHSI(void);
+        void updateHSI(void);
+        void setHSICacheMode(QGraphicsItem::CacheMode cache_mode);
         void setHSIHeading(float heading);
     private:
         void resetHSI(void);
         void updateHSIHeading(void);
     private:
-        QGraphicsScene    *hsi_scene_;
-        QGraphicsSvgItem  *hsi_item_back_;
-        QGraphicsSvgItem  *hsi_item_face_;
-        QGraphicsSvgItem  *hsi_item_marks_;
-        QGraphicsTextItem *hsi_item_frame_text_;
+        QGraphicsScene          *hsi_scene_;
+        FCSInstrucmentSvgItem   *hsi_item_back_;
+        FCSInstrucmentSvgItem   *hsi_item_face_;
+        FCSInstrucmentSvgItem   *hsi_item_marks_;
+        FCSInstrucmentDigitItem *hsi_item_frame_text_;
+        // HSI cache mode.
+        QGraphicsItem::CacheMode hsi_cache_mode_;
+        // HSI dirty variables.
+        bool hsi_dirty_;
         // HSI color variable.
         QColor hsi_frame_text_color_;
         // HSI font variable.
         QFont  hsi_frame_text_font_;
         // HSI heading variable.
         float hsi_heading_;
-        // HSI scale variables.
-        float hsi_scale_x_;
-        float hsi_scale_y_;
         // HSI original variables.
         QPointF hsi_original_hsi_ctr_;
         QPointF hsi_original_back_pos_;
@@ -493,24 +551,23 @@ private:
     public:
         PanelVSI(QGraphicsScene *scene);
         ~PanelVSI();
-        void initVSI(float scale_x, float scale_y);
-        void updateVSI(float scale_x, float scale_y);
+        void initVSI(void);
+        void updateVSI(void);
+        void setVSICacheMode(QGraphicsItem::CacheMode cache_mode);
         void setVSIClimbRate(float climb_rate);
     private:
         void resetVSI(void);
         void updateVSIClimbRate(void);
     private:
-        QGraphicsScene    *vsi_scene_;
-        QGraphicsSvgItem  *vsi_item_scale_;
-        QGraphicsSvgItem  *vsi_item_arrow_;
+        QGraphicsScene        *vsi_scene_;
+        FCSInstrucmentSvgItem *vsi_item_scale_;
+        FCSInstrucmentSvgItem *vsi_item_arrow_;
+        // VSI cache mode.
+        QGraphicsItem::CacheMode vsi_cache_mode_;
+        // VSI dirty variables.
+        bool vsi_dirty_;
         // VSI climb rate.
         float vsi_climb_rate_;
-        // VSI delta variables.
-        float vsi_arrow_delta_y_new_;
-        float vsi_arrow_delta_y_old_;
-        // VSI scale variables.
-        float vsi_scale_x_;
-        float vsi_scale_y_;
         // VSI original float variables.
         const float vsi_original_marke_height_;
         const float vsi_original_pix_per_spd1_;
@@ -527,6 +584,18 @@ private:
     void initPFD(void);
     void resetPFD(void);
     void updatePFDView(void);
+    void tagPFDItems(PanelType panel_type);
+    // Setters only mark state, render clock coalesces them into one
+    // refresh per frame.
+    inline void requestPFDFrame(void)
+    {
+        FCSInstrucmentRenderClock::getInstance()->requestFrame();
+    }
+    // Time base of samples and frames given to filters [ms].
+    inline qint64 getPFDTime(void) const
+    {
+        return pfd_filter_timer_.elapsed();
+    }
 private:
     QGraphicsScene *pfd_scene_;
     PanelADI       *pfd_panel_adi_;
@@ -535,11 +604,24 @@ private:
     PanelHSI       *pfd_panel_hsi_;
     PanelVSI       *pfd_panel_vsi_;
     // PFD svg items
-    QGraphicsSvgItem *pfd_item_back_;
-    QGraphicsSvgItem *pfd_item_mask_;
+    FCSInstrucmentSvgItem *pfd_item_back_;
+    FCSInstrucmentSvgItem *pfd_item_mask_;
     // PFD scale variables.
     float pfd_scale_x_;
     float pfd_scale_y_;
+    // PFD render mode.
+    RenderMode pfd_render_mode_;
+    // PFD synthetic vision terrain.
+    FCSInstrucmentTerrainMap pfd_terrain_map_;
+    // PFD filter variables.
+    FCSInstrucmentValueFilter::FilterMode pfd_filter_mode_;
+    QElapsedTimer                         pfd_filter_timer_;
+    FCSInstrucmentValueFilter             pfd_filter_roll_;
+    FCSInstrucmentValueFilter             pfd_filter_pitch_;
+    FCSInstrucmentValueFilter             pfd_filter_altitude_;
+    FCSInstrucmentValueFilter             pfd_filter_airspeed_;
+    FCSInstrucmentValueFilter             pfd_filter_heading_;
+    FCSInstrucmentValueFilter             pfd_filter_climb_rate_;
     // PFD original variables.
     const int pfd_original_height_;
     const int pfd_original_width_;
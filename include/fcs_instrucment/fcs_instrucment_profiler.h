@@ -0,0 +1,192 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_profiler.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines the render profiler of instrucments, which collects
+ * scoped timers of painting and data updates into per-thread buffers and keeps
+ * rolling histograms of them.
+ *****************************************************************************/
+
+
+#ifndef FCS_INSTRUCMENT_PROFILER_H
+#define FCS_INSTRUCMENT_PROFILER_H
+
+#include <QAtomicInt>
+#include <QList>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+#include <QWidget>
+
+#define PROFILER_PROBE_MAX    32
+#define PROFILER_BUFFER_SIZE  4096
+#define PROFILER_BUFFER_MASK  (PROFILER_BUFFER_SIZE - 1)
+#define PROFILER_BUCKET_COUNT 80
+#define PROFILER_SLICE_COUNT  10
+#define PROFILER_SLICE_TIME   500
+
+// Time enclosing scope as named probe, costs one atomic load when profiler
+// is disabled.
+#define FCS_INSTRUCMENT_PROFILE(name)                                         \
+    static const int fcs_profiler_probe =                                     \
+        FCSInstrucmentProfiler::registerProbe(name);                          \
+    FCSInstrucmentProfilerScope fcs_profiler_scope(fcs_profiler_probe)
+
+struct FCSInstrucmentProfilerStatistic
+{
+    int     stat_probe;
+    QString stat_name;
+    int     stat_count;
+    double  stat_mean;
+    double  stat_p50;
+    double  stat_p99;
+    double  stat_max;
+};
+
+class FCSInstrucmentProfiler : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Get the profiler shared by all instrucments, create it on first
+    // request.
+    static FCSInstrucmentProfiler *getInstance(void);
+    // Register probe, the same name always gets the same probe.
+    // param1: name of probe, kept by pointer so it must be a literal.
+    // return: probe, -1 when all probes are in use.
+    static int registerProbe(const char *name);
+    // Get monotonic timestamp.
+    // return: timestamp [ns].
+    static qint64 getTimestamp(void);
+    // Record sample into buffer of calling thread, it never blocks and
+    // drops the sample when buffer is full.
+    // param1: probe.
+    // param2: duration [ns].
+    static void addSample(int probe, qint64 duration);
+    static inline bool isEnabled(void)
+    {
+        return (profiler_enabled_.loadAcquire() != 0);
+    }
+    void setEnabled(bool enabled);
+    // Get statistics of rolling window, percentiles are upper bounds of
+    // histogram buckets, which are a quarter octave wide.
+    // return: statistics [ms] of probes with samples.
+    QList<FCSInstrucmentProfilerStatistic> getStatistics(void) const;
+    // Get samples dropped since last clear because buffers were full.
+    int getDroppedCount(void) const;
+    // Get length of rolling window.
+    // return: window time [ms].
+    int getWindowTime(void) const;
+    // Write statistics and histograms of rolling window as csv.
+    // param1: path of output file.
+    // return: true if file is written.
+    bool dumpStatistics(const QString &path) const;
+    void clearStatistics(void);
+signals:
+    // Emitted once per slice of rolling window while enabled.
+    void statisticsUpdated(void);
+private slots:
+    void collectSamples(void);
+private:
+    struct Slice
+    {
+        quint32 slice_buckets[PROFILER_BUCKET_COUNT];
+        quint32 slice_count;
+        qint64  slice_sum;
+        qint64  slice_max;
+    };
+    explicit FCSInstrucmentProfiler(QObject *parent = 0);
+    ~FCSInstrucmentProfiler();
+    void addSliceSample(int probe, qint64 duration);
+    void getProbeBuckets(int probe, quint32 *buckets, quint32 *count,
+                         qint64 *sum, qint64 *max) const;
+private:
+    static QAtomicInt profiler_enabled_;
+    QTimer           *profiler_timer_;
+    Slice             profiler_slices_[PROFILER_SLICE_COUNT]
+                                      [PROFILER_PROBE_MAX];
+    int               profiler_slice_;
+    int               profiler_dropped_;
+};
+
+class FCSInstrucmentProfilerScope
+{
+public:
+    inline explicit FCSInstrucmentProfilerScope(int probe) :
+        scope_probe_(-1),
+        scope_start_(0)
+    {
+        if (probe >= 0 && FCSInstrucmentProfiler::isEnabled()) {
+            scope_probe_ = probe;
+            scope_start_ = FCSInstrucmentProfiler::getTimestamp();
+        }
+        else {
+            ;
+        }
+    }
+    inline ~FCSInstrucmentProfilerScope()
+    {
+        if (scope_probe_ >= 0) {
+            FCSInstrucmentProfiler::addSample(
+                scope_probe_,
+                FCSInstrucmentProfiler::getTimestamp() - scope_start_);
+        }
+        else {
+            ;
+        }
+    }
+private:
+    int    scope_probe_;
+    qint64 scope_start_;
+};
+
+// Table of profiler statistics drawn over instrucments, it ignores mouse so
+// widgets under it stay usable.
+class FCSInstrucmentProfilerOverlay : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit FCSInstrucmentProfilerOverlay(QWidget *parent = 0);
+    ~FCSInstrucmentProfilerOverlay();
+    QSize sizeHint() const;
+protected:
+    void paintEvent(QPaintEvent *event);
+private slots:
+    void updateOverlay(void);
+private:
+    QStringList overlay_lines_;
+};
+
+#endif // FCS_INSTRUCMENT_PROFILER_H
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_render_clock.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines the render clock of instrucments, which coalesces
+ * refresh requests of all instrucments into one update per display frame.
+ *****************************************************************************/
+
+#ifndef FCS_INSTRUCMENT_RENDER_CLOCK_H
+#define FCS_INSTRUCMENT_RENDER_CLOCK_H
+
+#include <QObject>
+#include <QTimer>
+
+class FCSInstrucmentRenderClock : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Get the clock shared by all instrucments, create it on first request.
+    static FCSInstrucmentRenderClock *getInstance(void);
+    // Set frame rate cap.
+    // param1: frame rate cap [Hz], 0 follows refresh rate of screen.
+    void setFrameRateCap(float frame_rate_cap);
+    // Get frame rate in use.
+    // return: frame rate [Hz].
+    float getFrameRate(void) const;
+    // Ask for refresh on next frame, requests before it are coalesced.
+    void requestFrame(void);
+signals:
+    // Emitted once per frame while refresh is requested.
+    void frameTicked(void);
+private slots:
+    void tickFrame(void);
+private:
+    explicit FCSInstrucmentRenderClock(QObject *parent = 0);
+    ~FCSInstrucmentRenderClock();
+    void updateFrameInterval(void);
+private:
+    QTimer *clock_timer_;
+    bool    clock_frame_requested_;
+    float   clock_frame_rate_;
+    float   clock_frame_rate_cap_;
+};
+
+#endif // FCS_INSTRUCMENT_RENDER_CLOCK_H
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_svg_cache.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines a process-wide cache of svg renderers, so that every
+ * instrucment item built from the same resource shares one parsed document.
+ * With FCS_INSTRUCMENT_VECTOR the documents are compiled into painter path
+ * tables at build time and QtSvg is not used at runtime.
+ *****************************************************************************/
+
+#ifndef FCS_INSTRUCMENT_SVG_CACHE_H
+#define FCS_INSTRUCMENT_SVG_CACHE_H
+
+#include <QHash>
+#include <QString>
+
+#ifdef FCS_INSTRUCMENT_VECTOR
+#include <fcs_instrucment_vector_item.h>
+
+typedef FCSInstrucmentVectorItem  FCSInstrucmentSvgItem;
+typedef FCSInstrucmentVectorShape FCSInstrucmentSvgRenderer;
+#else
+#include <QGraphicsSvgItem>
+#include <QSvgRenderer>
+
+typedef QGraphicsSvgItem FCSInstrucmentSvgItem;
+typedef QSvgRenderer     FCSInstrucmentSvgRenderer;
+#endif
+
+class FCSInstrucmentSvgCache
+{
+public:
+    // Get the shared renderer of svg resource, parse it on first request.
+    // param1: resource path of svg file.
+    static FCSInstrucmentSvgRenderer *getRenderer(const QString &path);
+    // Create svg item drawing with the shared renderer of resource.
+    // param1: resource path of svg file.
+    static FCSInstrucmentSvgItem *createItem(const QString &path);
+    // Release all cached renderers, items using them must be deleted first.
+    static void clearRenderer(void);
+private:
+    static QHash<QString, FCSInstrucmentSvgRenderer *> &getRendererTable(
+        void);
+};
+
+#endif // FCS_INSTRUCMENT_SVG_CACHE_H
@@ -0,0 +1,188 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_terrain_item.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines the synthetic vision terrain of ADI, a local SRTM
+ * heightmap is rendered in perspective by a software voxel renderer.
+ *****************************************************************************/
+
+#ifndef FCS_INSTRUCMENT_TERRAIN_ITEM_H
+#define FCS_INSTRUCMENT_TERRAIN_ITEM_H
+
+#include <QCache>
+#include <QFile>
+#include <QGraphicsItem>
+#include <QImage>
+#include <QPainter>
+#include <QString>
+#include <QVector>
+
+#define TERRAIN_TILE_SHIFT 5
+#define TERRAIN_TILE_SIZE  (1 << TERRAIN_TILE_SHIFT)
+#define TERRAIN_TILE_MASK  (TERRAIN_TILE_SIZE - 1)
+#define TERRAIN_TILE_CACHE 256
+#define TERRAIN_IMAGE_MAX  1024
+
+// Heightmap of one SRTM tile(*.hgt), samples are converted into heights and
+// shaded colors in small tiles on first use and kept in a bounded cache.
+class FCSInstrucmentTerrainMap
+{
+public:
+    FCSInstrucmentTerrainMap();
+    ~FCSInstrucmentTerrainMap();
+    // Map heightmap file, origin is the one set before or else its center.
+    // param1: path of file named after its south-west corner(N39E116.hgt).
+    // return: true if file is a square grid of big-endian 16-bit samples.
+    bool loadTerrainFile(const QString &path);
+    void clearTerrain(void);
+    bool isTerrainValid(void) const;
+    // Set geodetic origin of local frame, x points north, y east and z up
+    // from ground at origin. It is kept for files loaded later.
+    // param1: latitude [deg].
+    // param2: longitude [deg].
+    void setTerrainOrigin(double latitude, double longitude);
+    // Convert local position into sample coordinates.
+    // param1: north [m].
+    // param2: east [m].
+    // param3: sample row, rows run southward.
+    // param4: sample column.
+    void getTerrainPosition(float x, float y, float *row,
+                            float *column) const;
+    float getTerrainOriginHeight(void) const;
+    float getTerrainSpacingNorth(void) const;
+    float getTerrainSpacingEast(void) const;
+    // Get height and color of sample.
+    // return: false outside heightmap and in voids.
+    inline bool getTerrainSample(int row, int column, float *height,
+                                 quint32 *color) const
+    {
+        if ((unsigned int)row    >= (unsigned int)terrain_samples_ ||
+            (unsigned int)column >= (unsigned int)terrain_samples_) {
+            return false;
+        }
+        else {
+            ;
+        }
+
+        int key = ((row >> TERRAIN_TILE_SHIFT) << 16) |
+            (column >> TERRAIN_TILE_SHIFT);
+
+        // Neighbouring samples mostly share a tile, so cache lookups only
+        // happen when rays cross tile borders.
+        if (key != terrain_tile_key_) {
+            terrain_tile_     = getTerrainTile(row >> TERRAIN_TILE_SHIFT,
+                                               column >> TERRAIN_TILE_SHIFT);
+            terrain_tile_key_ = key;
+        }
+        else {
+            ;
+        }
+
+        int index = ((row & TERRAIN_TILE_MASK) << TERRAIN_TILE_SHIFT) |
+            (column & TERRAIN_TILE_MASK);
+
+        *color  = terrain_tile_->tile_color[index];
+        *height = terrain_tile_->tile_height[index];
+
+        return (*color != 0);
+    }
+private:
+    struct Tile
+    {
+        float   tile_height[TERRAIN_TILE_SIZE * TERRAIN_TILE_SIZE];
+        quint32 tile_color[TERRAIN_TILE_SIZE * TERRAIN_TILE_SIZE];
+    };
+    const Tile *getTerrainTile(int tile_row, int tile_column) const;
+    int getTerrainHeight(int row, int column) const;
+    quint32 getTerrainColor(int height, float shade) const;
+    void updateTerrainOrigin(double latitude, double longitude);
+private:
+    QFile                     terrain_file_;
+    const uchar              *terrain_data_;
+    int                       terrain_samples_;
+    double                    terrain_latitude_;
+    double                    terrain_longitude_;
+    bool                      terrain_origin_set_;
+    double                    terrain_origin_latitude_;
+    double                    terrain_origin_longitude_;
+    float                     terrain_origin_row_;
+    float                     terrain_origin_column_;
+    float                     terrain_origin_height_;
+    float                     terrain_spacing_north_;
+    float                     terrain_spacing_east_;
+    mutable QCache<int, Tile> terrain_tiles_;
+    mutable int               terrain_tile_key_;
+    mutable const Tile       *terrain_tile_;
+};
+
+// Square item drawing terrain from current pose without roll, it is rolled
+// with the ADI background by item rotation.
+class FCSInstrucmentTerrainItem : public QGraphicsItem
+{
+public:
+    // Construct item, vertical scale matches pitch ladder.
+    // param1: side of item in scene units.
+    // param2: scene units per degree of pitch.
+    FCSInstrucmentTerrainItem(float size, float pix_per_deg,
+                              QGraphicsItem *parent = 0);
+    ~FCSInstrucmentTerrainItem();
+    QRectF boundingRect() const;
+    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
+               QWidget *widget = 0);
+    void setTerrainMap(const FCSInstrucmentTerrainMap *terrain_map);
+    // Set pose, item is repainted only when it changes.
+    // param1: north [m].
+    // param2: east [m].
+    // param3: height above ground at origin [m].
+    // param4: heading [deg].
+    // param5: pitch [deg].
+    void setTerrainPose(float x, float y, float z, float heading,
+                        float pitch);
+private:
+    void renderTerrain(int size);
+    static void fillTerrainSpan(quint32 *span, int length, quint32 color);
+private:
+    const FCSInstrucmentTerrainMap *terrain_map_;
+    QImage                          terrain_image_;
+    QVector<int>                    terrain_ybuffer_;
+    float                           terrain_size_;
+    float                           terrain_pix_per_deg_;
+    float                           terrain_x_;
+    float                           terrain_y_;
+    float                           terrain_z_;
+    float                           terrain_heading_;
+    float                           terrain_pitch_;
+    bool                            terrain_dirty_;
+};
+
+#endif // FCS_INSTRUCMENT_TERRAIN_ITEM_H
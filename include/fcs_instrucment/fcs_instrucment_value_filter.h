@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_value_filter.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines the presentation filter of instrucments, which turns
+ * low rate telemetry samples of one channel into values at display rate.
+ *****************************************************************************/
+
+#ifndef FCS_INSTRUCMENT_VALUE_FILTER_H
+#define FCS_INSTRUCMENT_VALUE_FILTER_H
+
+#include <QtGlobal>
+
+class FCSInstrucmentValueFilter
+{
+public:
+    // Filter modes.
+    enum FilterMode
+    {
+        NONE,        // Newest sample is presented as it is.
+        INTERPOLATE, // Interpolates last two samples, one sample behind.
+        EXTRAPOLATE  // Dead-reckons from newest sample with rate.
+    };
+public:
+    // Construct filter, values wrap into [wrap_min, wrap_max) when range
+    // is not empty, e.g. heading from 0 to 360.
+    // param1: lower bound of wrap range.
+    // param2: upper bound of wrap range.
+    FCSInstrucmentValueFilter(float wrap_min = 0.0f, float wrap_max = 0.0f);
+    ~FCSInstrucmentValueFilter();
+    void setFilterMode(FilterMode filter_mode);
+    // Add telemetry sample.
+    // param1: value of sample.
+    // param2: time of sample [ms].
+    void addSample(float value, qint64 time);
+    // Set measured rate used by extrapolation, e.g. from gyro, otherwise
+    // rate is estimated from last two samples.
+    // param1: rate [unit/s].
+    void setRate(float rate);
+    // Get presented value.
+    // param1: time of display frame [ms].
+    float getValue(qint64 time) const;
+    // Check if presented value still changes after time.
+    // param1: time of display frame [ms].
+    bool isMoving(qint64 time) const;
+    void resetFilter(void);
+private:
+    float wrapValue(float value) const;
+    float wrapDelta(float delta) const;
+private:
+    FilterMode filter_mode_;
+    float      filter_wrap_min_;
+    float      filter_wrap_max_;
+    float      filter_value_from_;
+    float      filter_value_old_;
+    float      filter_value_new_;
+    qint64     filter_time_old_;
+    qint64     filter_time_new_;
+    float      filter_rate_;
+    bool       filter_rate_valid_;
+    int        filter_sample_count_;
+};
+
+#endif // FCS_INSTRUCMENT_VALUE_FILTER_H
@@ -0,0 +1,134 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_vector_item.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines the item drawing instrucment layers from painter path
+ * tables compiled out of svg files at build time, so QtSvg is not needed.
+ *****************************************************************************/
+
+#ifndef FCS_INSTRUCMENT_VECTOR_ITEM_H
+#define FCS_INSTRUCMENT_VECTOR_ITEM_H
+
+#include <QBrush>
+#include <QGraphicsItem>
+#include <QList>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPen>
+#include <QString>
+
+// Tables written by tools/breeze_svg_compiler, transforms are baked into
+// coordinates and colors are ARGB.
+struct FCSInstrucmentVectorGradient
+{
+    int          gradient_type;       // 0 linear, 1 radial.
+    float        gradient_coords[5];  // x1 y1 x2 y2 or cx cy r fx fy.
+    float        gradient_matrix[6];  // Gradient to document transform.
+    int          gradient_spread;     // 0 pad, 1 reflect, 2 repeat.
+    int          gradient_stop_count;
+    const float *gradient_stops;      // Offset, r, g, b, a of each stop.
+};
+
+struct FCSInstrucmentVectorLayer
+{
+    const char  *layer_commands;      // 'M', 'L', 'C' and 'Z'.
+    const float *layer_points;
+    int          layer_fill_rule;     // 0 nonzero, 1 evenodd.
+    unsigned int layer_fill;
+    int          layer_fill_gradient; // Index of gradient, -1 for color.
+    unsigned int layer_stroke;
+    int          layer_stroke_gradient;
+    float        layer_stroke_width;  // 0 without stroke.
+    int          layer_stroke_cap;    // 0 flat, 1 round, 2 square.
+    int          layer_stroke_join;   // 0 miter, 1 round, 2 bevel.
+    float        layer_stroke_miter;
+    int          layer_dash_count;
+    const float *layer_dashes;
+    float        layer_dash_offset;
+};
+
+struct FCSInstrucmentVectorData
+{
+    const char                         *data_path;
+    float                               data_width;
+    float                               data_height;
+    int                                 data_layer_count;
+    const FCSInstrucmentVectorLayer    *data_layers;
+    const FCSInstrucmentVectorGradient *data_gradients;
+};
+
+// Compiled svg resources, terminated by 0.
+extern const FCSInstrucmentVectorData *const fcs_instrucment_vector_table[];
+
+// Paths, pens and brushes of one svg resource, built once and shared by
+// every item drawing it.
+class FCSInstrucmentVectorShape
+{
+public:
+    // Find compiled table of resource.
+    // param1: resource path of svg file.
+    // return: table, 0 if resource was not compiled in.
+    static const FCSInstrucmentVectorData *findData(const QString &path);
+    FCSInstrucmentVectorShape(const FCSInstrucmentVectorData *data);
+    ~FCSInstrucmentVectorShape();
+    QRectF getShapeBounds(void) const;
+    void paintShape(QPainter *painter) const;
+private:
+    QBrush createBrush(unsigned int color, int gradient) const;
+private:
+    struct Layer
+    {
+        QPainterPath layer_path;
+        QPen         layer_pen;
+        QBrush       layer_brush;
+    };
+    const FCSInstrucmentVectorData *shape_data_;
+    QRectF                          shape_bounds_;
+    QList<Layer>                    shape_layers_;
+};
+
+// Drop-in for QGraphicsSvgItem of instrucments, sized like the document.
+class FCSInstrucmentVectorItem : public QGraphicsItem
+{
+public:
+    FCSInstrucmentVectorItem(const FCSInstrucmentVectorShape *shape,
+                             QGraphicsItem *parent = 0);
+    ~FCSInstrucmentVectorItem();
+    QRectF boundingRect() const;
+    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
+               QWidget *widget = 0);
+private:
+    const FCSInstrucmentVectorShape *vector_shape_;
+};
+
+#endif // FCS_INSTRUCMENT_VECTOR_ITEM_H
@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_view.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines some elements for implementing the graphics view shared
+ * by all instrucments, which builds its scene on first show, paints frames
+ * through the viewport helper and times them.
+ *****************************************************************************/
+
+#ifndef FCS_INSTRUCMENT_VIEW_H
+#define FCS_INSTRUCMENT_VIEW_H
+
+#include <QGraphicsView>
+#include <QPaintEvent>
+#include <QShowEvent>
+#include <fcs_instrucment_viewport.h>
+
+class FCSInstrucmentView : public QGraphicsView
+{
+    Q_OBJECT
+
+public:
+    // param1: name of profiler probe which times painting of view.
+    // param2: parent widget.
+    explicit FCSInstrucmentView(const char *probe_name, QWidget *parent = 0);
+    virtual ~FCSInstrucmentView();
+    // Build items of scene once, constructing view only keeps values until
+    // then. Called by host widget or on first show of view.
+    void buildInstrucment(void);
+    bool isInstrucmentBuilt(void) const;
+    // Set viewport mode, raster viewport is kept until OpenGL is opted in.
+    // param1: viewport mode according to FCSInstrucmentViewport.
+    void setViewportMode(FCSInstrucmentViewport::ViewportMode viewport_mode);
+    FCSInstrucmentViewport::ViewportMode getViewportMode(void) const;
+    // Set render scale, frames are rendered at reduced resolution and
+    // upscaled below 1 to spare fill rate on weak machines.
+    // param1: render scale in [VIEWPORT_SCALE_MIN, 1].
+    void setRenderScale(float render_scale);
+    float getRenderScale(void) const;
+    // Get smoothed frame time of current viewport.
+    // return: frame time [ms].
+    float getFrameTime(void) const;
+protected:
+    void showEvent(QShowEvent *event);
+    void paintEvent(QPaintEvent *event);
+    // Create items of scene from values set so far.
+    virtual void initInstrucment(void) = 0;
+    // Check whether updates of items are skipped.
+    // return: true before view is built or while host widget freezes it.
+    bool isViewFrozen(void) const;
+private:
+    FCSInstrucmentViewport view_viewport_;
+    int                    view_probe_;
+    bool                   view_built_;
+};
+
+#endif // FCS_INSTRUCMENT_VIEW_H
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_viewport.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines viewport settings of instrucments, which switch views
+ * between raster and OpenGL viewports, scale their render resolution and
+ * measure their frame time.
+ *****************************************************************************/
+
+#ifndef FCS_INSTRUCMENT_VIEWPORT_H
+#define FCS_INSTRUCMENT_VIEWPORT_H
+
+#include <QElapsedTimer>
+#include <QGraphicsView>
+#include <QImage>
+#include <QRegion>
+
+#define VIEWPORT_SCALE_MIN 0.25f
+
+class FCSInstrucmentViewport
+{
+public:
+    // Viewport modes.
+    enum ViewportMode
+    {
+        RASTER, // Default QWidget viewport painted by raster engine.
+        OPENGL  // QOpenGLWidget viewport, also works on Mesa llvmpipe.
+    };
+public:
+    FCSInstrucmentViewport();
+    ~FCSInstrucmentViewport();
+    // Set viewport of view, update mode and render hints follow the mode.
+    // param1: view to be set.
+    // param2: viewport mode according to ViewportMode.
+    void setViewportMode(QGraphicsView *view, ViewportMode viewport_mode);
+    ViewportMode getViewportMode(void) const;
+    // Set render scale of view, frames below full scale are rendered into an
+    // image of reduced resolution and upscaled, which trades sharpness for
+    // fill rate on weak machines.
+    // param1: view to be set.
+    // param2: render scale in [VIEWPORT_SCALE_MIN, 1].
+    void setRenderScale(QGraphicsView *view, float render_scale);
+    float getRenderScale(void) const;
+    // Mark start and finish of one frame, called around paintEvent. Cached
+    // layers are rasterized again when pixel ratio changed since last frame.
+    // param1: view to be painted.
+    void startFrame(QGraphicsView *view);
+    void finishFrame(void);
+    // Paint exposed region of view at render scale.
+    // param1: view to be painted.
+    // param2: exposed region of viewport.
+    // return: false at full scale, then view paints itself.
+    bool paintFrame(QGraphicsView *view, const QRegion &region);
+    // Get smoothed frame time.
+    // return: frame time [ms].
+    float getFrameTime(void) const;
+private:
+    void flushItemCache(QGraphicsView *view);
+private:
+    ViewportMode  viewport_mode_;
+    QElapsedTimer viewport_timer_;
+    QImage        viewport_image_;
+    qreal         viewport_ratio_;
+    float         viewport_render_scale_;
+    float         viewport_frame_time_;
+};
+
+#endif // FCS_INSTRUCMENT_VIEWPORT_H
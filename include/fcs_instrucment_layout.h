@@ -36,7 +36,8 @@
  *
  * Description:
  * This .h file defines some elements for implementing the square layout of
- * instrucments according to QFlightInstruments project.
+ * instrucments according to QFlightInstruments project, several instrucments
+ * are placed in a grid of square cells.
  *****************************************************************************/
 
 #ifndef FCS_INSTRUCMENT_LAYOUT_H
@@ -44,10 +45,14 @@
 
 #include <QLayout>
 #include <QLayoutItem>
-#include <QPointer>
+#include <QList>
 #include <QRect>
+#include <QTimer>
 #include <QWidgetItem>
 
+// Time window without geometry change before children are resized, in ms.
+#define LAYOUT_SETTLE_DELAY 120
+
 class FCSInstrucmentLayout : public QLayout
 {
     Q_OBJECT
@@ -59,6 +64,11 @@ public:
     void addItem(QLayoutItem *item);
     void addWidget(QWidget *widget);
     void setGeometry(const QRect &rect);
+    // Set number of cells in a row, items wrap into new rows.
+    void setLayoutColumns(int columns);
+    // Set delay before a changed geometry reaches children, 0 applies it at
+    // once.
+    void setLayoutSettleDelay(int msec);
     int count() const;
     bool hasHeightForWidth() const;
     bool hasItem() const;
@@ -70,16 +80,19 @@ public:
     QLayoutItem* take();
     QLayoutItem* takeAt(int index);
     Qt::Orientations expandingDirections() const;
+private slots:
+    void applyGeometry(void);
 private:
     void init(int spacing);
-    void setRectLast(const QRect &rect);
-    bool areRectEqual(const QRect &rect_1, const QRect &rect_2) const;
+    int  getLayoutRows(void) const;
     QPoint calculateCenterPoint(QSize form_size, QSize item_size) const;
     QSize  calculateProperSize(QSize form_size) const;
 private:
-    QRect       *layout_rect_last_;
-    QRect       *layout_geometry_;
-    QLayoutItem *layout_item_;
+    QRect                layout_rect_last_;
+    QRect                layout_geometry_;
+    QList<QLayoutItem *> layout_items_;
+    QTimer               layout_timer_;
+    int                  layout_columns_;
 };
 
 #endif // FCS_INSTRUCMENT_LAYOUT_H
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_widget.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines some elements for implementing the widget which hosts
+ * one instrucment, the scene of instrucment is built when the widget is first
+ * shown and frozen while the widget is hidden.
+ *****************************************************************************/
+
+#ifndef FCS_INSTRUCMENT_WIDGET_H
+#define FCS_INSTRUCMENT_WIDGET_H
+
+#include <QFrame>
+#include <QHideEvent>
+#include <QShowEvent>
+#include <QWidget>
+#include <fcs_instrucment_layout.h>
+#include <fcs_instrucment_view.h>
+
+class FCSInstrucmentWidgetHost : public QWidget
+{
+    Q_OBJECT
+
+public:
+    // param1: instrucment view, owned by widget and hidden until first show.
+    // param2: parent widget.
+    explicit FCSInstrucmentWidgetHost(FCSInstrucmentView *view,
+                                      QWidget *parent = 0);
+    ~FCSInstrucmentWidgetHost();
+    // Set whether instrucment is placed on a black rounded panel, takes
+    // effect when widget is first shown.
+    void setInstrucmentFramed(bool framed);
+    bool isInstrucmentBuilt(void) const;
+    bool isInstrucmentFrozen(void) const;
+protected:
+    void showEvent(QShowEvent *event);
+    void hideEvent(QHideEvent *event);
+    FCSInstrucmentView *getInstrucmentView(void) const;
+private:
+    void setupInstrucment(void);
+    void freezeInstrucment(bool frozen);
+private:
+    FCSInstrucmentLayout *widget_layout_;
+    QFrame               *widget_frame_;
+    FCSInstrucmentView   *widget_view_;
+    bool                  widget_framed_;
+};
+
+template <class T>
+class FCSInstrucmentWidget : public FCSInstrucmentWidgetHost
+{
+public:
+    explicit FCSInstrucmentWidget(QWidget *parent = 0) :
+        FCSInstrucmentWidgetHost(new T(), parent)
+    {
+    }
+    // Get instrucment, it keeps values given before its scene is built on
+    // first show of widget.
+    inline T *getInstrucment(void) const
+    {
+        return static_cast<T *>(getInstrucmentView());
+    }
+};
+
+#endif // FCS_INSTRUCMENT_WIDGET_H
@@ -42,39 +42,29 @@
 #ifndef FCS_INSTRUCMENT_WIDGET_ADI_H
 #define FCS_INSTRUCMENT_WIDGET_ADI_H
 
-#include <QWidget>
 #include <fcs_instrucment_adi.h>
-#include <fcs_instrucment_layout.h>
+#include <fcs_instrucment_widget.h>
 
-namespace Ui {
-class FCSInstrucmentWidgetADI;
-}
-
-class FCSInstrucmentWidgetADI : public QWidget
+class FCSInstrucmentWidgetADI :
+    public FCSInstrucmentWidget<FCSInstrucmentADI>
 {
-    Q_OBJECT
-
 public:
-    explicit FCSInstrucmentWidgetADI(QWidget *parent = 0);
-    ~FCSInstrucmentWidgetADI();
+    explicit FCSInstrucmentWidgetADI(QWidget *parent = 0) :
+        FCSInstrucmentWidget<FCSInstrucmentADI>(parent)
+    {
+    }
     inline void updateADI(void)
     {
-        widget_adi_->updateADI();
+        getInstrucment()->updateADI();
     }
     inline void setADIAngleRoll(float angle_roll)
     {
-        widget_adi_->setADIAngleRoll(angle_roll);
+        getInstrucment()->setADIAngleRoll(angle_roll);
     }
     inline void setADIAnglePitch(float angle_pitch)
     {
-        widget_adi_->setADIAnglePitch(angle_pitch);
+        getInstrucment()->setADIAnglePitch(angle_pitch);
     }
-private:
-    void setupWidgetUi(void);
-private:
-    Ui::FCSInstrucmentWidgetADI *widget_ui_;
-    FCSInstrucmentADI           *widget_adi_;
-    FCSInstrucmentLayout        *widget_layout_;
 };
 
 #endif // FCS_INSTRUCMENT_WIDGET_ADI_H
@@ -42,39 +42,29 @@
 #ifndef FCS_INSTRUCMENT_WIDGET_ALT_H
 #define FCS_INSTRUCMENT_WIDGET_ALT_H
 
-#include <QWidget>
 #include <fcs_instrucment_alt.h>
-#include <fcs_instrucment_layout.h>
+#include <fcs_instrucment_widget.h>
 
-namespace Ui {
-class FCSInstrucmentWidgetALT;
-}
-
-class FCSInstrucmentWidgetALT : public QWidget
+class FCSInstrucmentWidgetALT :
+    public FCSInstrucmentWidget<FCSInstrucmentALT>
 {
-    Q_OBJECT
-
 public:
-    explicit FCSInstrucmentWidgetALT(QWidget *parent = 0);
-    ~FCSInstrucmentWidgetALT();
+    explicit FCSInstrucmentWidgetALT(QWidget *parent = 0) :
+        FCSInstrucmentWidget<FCSInstrucmentALT>(parent)
+    {
+    }
     inline void updateALT(void)
     {
-        widget_alt_->updateALT();
+        getInstrucment()->updateALT();
     }
     inline void setALTAltitude(float altitude)
     {
-        widget_alt_->setALTAltitude(altitude);
+        getInstrucment()->setALTAltitude(altitude);
     }
     inline void setALTPressure(float pressure)
     {
-        widget_alt_->setALTPressure(pressure);
+        getInstrucment()->setALTPressure(pressure);
     }
-private:
-    void setupWidgetUi(void);
-private:
-    Ui::FCSInstrucmentWidgetALT *widget_ui_;
-    FCSInstrucmentALT           *widget_alt_;
-    FCSInstrucmentLayout        *widget_layout_;
 };
 
 #endif // FCS_INSTRUCMENT_WIDGET_ALT_H
@@ -42,35 +42,25 @@
 #ifndef FCS_INSTRUCMENT_WIDGET_HSI_H
 #define FCS_INSTRUCMENT_WIDGET_HSI_H
 
-#include <QWidget>
 #include <fcs_instrucment_hsi.h>
-#include <fcs_instrucment_layout.h>
+#include <fcs_instrucment_widget.h>
 
-namespace Ui {
-class FCSInstrucmentWidgetHSI;
-}
-
-class FCSInstrucmentWidgetHSI : public QWidget
+class FCSInstrucmentWidgetHSI :
+    public FCSInstrucmentWidget<FCSInstrucmentHSI>
 {
-    Q_OBJECT
-
 public:
-    explicit FCSInstrucmentWidgetHSI(QWidget *parent = 0);
-    ~FCSInstrucmentWidgetHSI();
+    explicit FCSInstrucmentWidgetHSI(QWidget *parent = 0) :
+        FCSInstrucmentWidget<FCSInstrucmentHSI>(parent)
+    {
+    }
     inline void updateHSI(void)
     {
-        widget_hsi_->updateHSI();
+        getInstrucment()->updateHSI();
     }
     inline void setHSIHeading(float heading)
     {
-        widget_hsi_->setHSIHeading(heading);
+        getInstrucment()->setHSIHeading(heading);
     }
-private:
-    void setupWidgetUi(void);
-private:
-    Ui::FCSInstrucmentWidgetHSI *widget_ui_;
-    FCSInstrucmentHSI           *widget_hsi_;
-    FCSInstrucmentLayout        *widget_layout_;
 };
 
 #endif // FCS_INSTRUCMENT_WIDGET_HSI_H
@@ -42,86 +42,122 @@
 #ifndef FCS_INSTRUCMENT_WIDGET_PFD_H
 #define FCS_INSTRUCMENT_WIDGET_PFD_H
 
-#include <QWidget>
+#include <communication_data_type.h>
 #include <fcs_instrucment_pfd.h>
-#include <fcs_instrucment_layout.h>
+#include <fcs_instrucment_profiler.h>
+#include <fcs_instrucment_widget.h>
 
-namespace Ui {
-class FCSInstrucmentWidgetPFD;
-}
-
-class FCSInstrucmentWidgetPFD : public QWidget
+class FCSInstrucmentWidgetPFD :
+    public FCSInstrucmentWidget<FCSInstrucmentPFD>
 {
-    Q_OBJECT
-
 public:
-    explicit FCSInstrucmentWidgetPFD(QWidget *parent = 0);
-    ~FCSInstrucmentWidgetPFD();
+    explicit FCSInstrucmentWidgetPFD(QWidget *parent = 0) :
+        FCSInstrucmentWidget<FCSInstrucmentPFD>(parent)
+    {
+        setInstrucmentFramed(true);
+    }
     inline void updatePFD(void)
     {
-        widget_pfd_->updatePFD();
+        getInstrucment()->updatePFD();
+    }
+    inline void setPFDViewportMode(
+        FCSInstrucmentViewport::ViewportMode viewport_mode)
+    {
+        getInstrucment()->setViewportMode(viewport_mode);
+    }
+    inline void setPFDRenderScale(float render_scale)
+    {
+        getInstrucment()->setRenderScale(render_scale);
+    }
+    inline float getPFDFrameTime(void)
+    {
+        return getInstrucment()->getFrameTime();
+    }
+    inline void setPFDFilterMode(
+        FCSInstrucmentValueFilter::FilterMode filter_mode)
+    {
+        getInstrucment()->setPFDFilterMode(filter_mode);
+    }
+    inline void setPFDAngularRate(float roll_rate, float pitch_rate,
+                                  float yaw_rate)
+    {
+        getInstrucment()->setPFDAngularRate(roll_rate, pitch_rate, yaw_rate);
     }
     inline void setPFDAngleRoll(float angle_roll)
     {
-        widget_pfd_->setPFDAngleRoll(angle_roll);
+        getInstrucment()->setPFDAngleRoll(angle_roll);
     }
     inline void setPFDAnglePitch(float angle_pitch)
     {
-        widget_pfd_->setPFDAnglePitch(angle_pitch);
+        getInstrucment()->setPFDAnglePitch(angle_pitch);
     }
     inline void setPFDFlightPathMarker(float angle_attack,
                                        float angle_sideslip)
     {
-        widget_pfd_->setPFDFlightPathMarker(angle_attack, angle_sideslip);
+        getInstrucment()->setPFDFlightPathMarker(angle_attack, angle_sideslip);
     }
     inline void setPFDSlipSkid(float slip_skid)
     {
-        widget_pfd_->setPFDSlipSkid(slip_skid);
+        getInstrucment()->setPFDSlipSkid(slip_skid);
     }
     inline void setPFDDeviatePositionH(float dev_h)
     {
-        widget_pfd_->setPFDDeviateBarPositionH(dev_h);
-        widget_pfd_->setPFDDeviateDotPositionH(dev_h);
+        getInstrucment()->setPFDDeviateBarPositionH(dev_h);
+        getInstrucment()->setPFDDeviateDotPositionH(dev_h);
     }
     inline void setPFDDeviatePositionV(float dev_v)
     {
-        widget_pfd_->setPFDDeviateBarPositionV(dev_v);
-        widget_pfd_->setPFDDeviateDotPositionV(dev_v);
+        getInstrucment()->setPFDDeviateBarPositionV(dev_v);
+        getInstrucment()->setPFDDeviateDotPositionV(dev_v);
     }
     inline void setPFDAltitude(float altitude)
     {
-        widget_pfd_->setPFDAltitude(altitude);
+        getInstrucment()->setPFDAltitude(altitude);
     }
     inline void setPFDPressure(float pressure)
     {
-        widget_pfd_->setPFDPressure(pressure, FCSInstrucmentPFD::IN);
+        getInstrucment()->setPFDPressure(pressure, FCSInstrucmentPFD::IN);
     }
     inline void setPFDAirspeed(float airspeed)
     {
-        widget_pfd_->setPFDAirspeed(airspeed);
+        getInstrucment()->setPFDAirspeed(airspeed);
     }
     inline void setPFDMachNumber(float mach_number)
     {
-        widget_pfd_->setPFDMachNumber(mach_number);
+        getInstrucment()->setPFDMachNumber(mach_number);
     }
     inline void setPFDHeading(float heading)
     {
-        widget_pfd_->setPFDHeading(heading);
+        getInstrucment()->setPFDHeading(heading);
     }
     inline void setPFDTurnRate(float turn_rate)
     {
-        widget_pfd_->setPFDTurnRate(turn_rate);
+        getInstrucment()->setPFDTurnRate(turn_rate);
     }
     inline void setPFDClimbRate(float climb_rate)
     {
-        widget_pfd_->setPFDClimbRate(climb_rate);
+        getInstrucment()->setPFDClimbRate(climb_rate);
+    }
+    inline bool setPFDTerrainFile(const QString &path)
+    {
+        return getInstrucment()->setPFDTerrainFile(path);
+    }
+    inline void setPFDTerrainOrigin(double latitude, double longitude)
+    {
+        getInstrucment()->setPFDTerrainOrigin(latitude, longitude);
+    }
+    inline void setPFDSpacePose(const DataTypeSpacePose &space_pose)
+    {
+        FCS_INSTRUCMENT_PROFILE("telemetry copy");
+
+        FCSInstrucmentPFD *pfd = getInstrucment();
+
+        pfd->setPFDPosition(space_pose.coo.axis_x, space_pose.coo.axis_y,
+                            space_pose.coo.axis_z);
+        pfd->setPFDAngleRoll(space_pose.att.att_r);
+        pfd->setPFDAnglePitch(space_pose.att.att_p);
+        pfd->setPFDHeading(space_pose.att.att_y);
     }
-private:
-    void setupWidgetUi(void);
-private:
-    Ui::FCSInstrucmentWidgetPFD *widget_ui_;
-    FCSInstrucmentPFD           *widget_pfd_;
-    FCSInstrucmentLayout        *widget_layout_;
 };
 
 #endif // FCS_INSTRUCMENT_WIDGET_PFD_H
@@ -43,14 +43,18 @@
 #include <QCamera>
 #include <QCameraInfo>
 #include <QCameraViewfinder>
+#include <QFutureWatcher>
+#include <QLabel>
 #include <QMainWindow>
 #include <QMessageBox>
 #include <QSerialPortInfo>
 #include <QTimer>
+#include <fcs_custom_tab_widget.h>
 
 //#include <communication_serial_interface.h>
 
 #define KEYBOARD_CONTROL 0
+#define INSTRUCMENT_SCALE_REDUCED 0.5f
 
 //using namespace communication_serial;
 
@@ -70,6 +74,15 @@ public:
 protected slots:
     void openAboutWidget(void);
     void openCameraViewFinder(void);
+    void exportFlightLog(void);
+    void finishExportFlightLog(void);
+    void switchInstrucmentViewport(bool checked);
+    void switchInstrucmentResolution(bool checked);
+    void updateInstrucmentFrameTime(void);
+    void switchRenderProfiler(bool checked);
+    void dumpRenderProfile(void);
+    void startPlotReplot(void);
+    void finishPlotReplot(void);
 //    void updateTimerOperation(void);
     void closeCameraViewFinder(void);
 protected:
@@ -105,6 +118,13 @@ private:
     QCamera                      *camera_;
     QList<QCameraInfo>            cameras_info_;
     QCameraViewfinder            *camera_view_finder_;
+    QFutureWatcher<bool>         *export_watcher_;
+    QLabel                       *frame_time_label_;
+    QTimer                       *frame_time_timer_;
+    QWidget                      *profiler_overlay_;
+    int                           plot_replot_probe_;
+    qint64                        plot_replot_start_;
+    FCSCustomTabPlot             *data_plotter_;
     Ui::FlightControlStation     *ui;
 //    CommunicationSerialInterface serial_interface_;
 };
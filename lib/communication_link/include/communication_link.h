@@ -61,14 +61,12 @@
 do {                                                               \
     recv_package_state_[(unsigned char)command_state] = FALSE;     \
     sendData(command_state, single_command, 0);                    \
-    break;                                                         \
 } while(FALSE)
 
 #define WRITE_COMMAND_STATE(type)                                  \
 do {                                                               \
     recv_package_state_[(unsigned char)command_state] = FALSE;     \
     sendData(command_state, (unsigned char *)&type, sizeof(type)); \
-    break;                                                         \
 } while(FALSE)
 
 typedef enum CommunicationMode {
@@ -126,11 +124,15 @@ public:
     void setOwnerID(unsigned char owner_id);
     void setOtherID(unsigned char other_id);
     void setPortNum(unsigned char port_num);
+    void setLinkMode(CommunicationMode link_mode);
     void enableAck(void);
     void disableAck(void);
     unsigned char sendCommandFromMaster(CommunicationCommandState command_state);
     unsigned char analyseReceiveByte(unsigned char recv_byte);
     unsigned char getReceiveState(CommunicationCommandState command_state);
+    CommunicationCommandState getReceiveCommand(void);
+    unsigned char *getReceiveData(void);
+    unsigned short getReceiveLength(void);
     unsigned char *getSerializeData(void);
     unsigned short getSerializedLength(void);
 private:
@@ -154,10 +156,12 @@ private:
     unsigned char              other_id_;
     unsigned char              link_ack_en_;
     unsigned char              send_buffer_[MESSAGE_BUFFER_SIZE + 20];
+    unsigned char             *recv_data_type_;
     unsigned short             send_buffer_length_;
     unsigned short             recv_checksum_;
     unsigned short             recv_message_length_;
     unsigned short             recv_byte_count_;
+    unsigned short             recv_data_type_length_;
     float                      recv_package_count_;
     float                      send_package_count_;
     float                      package_update_freq_;
@@ -74,6 +74,10 @@ CommunicationLink::CommunicationLink(unsigned char owner_id,
     send_package_count_       = 0;
     send_buffer_[0]           = 0;
     send_buffer_length_       = 0;
+    recv_data_type_           = 0;
+    recv_data_type_length_    = 0;
+
+    memset(recv_package_state_, FALSE, sizeof(recv_package_state_));
 }
 
 void CommunicationLink::setOwnerID(unsigned char owner_id)
@@ -91,6 +95,14 @@ void CommunicationLink::setPortNum(unsigned char port_num)
     port_num_ = port_num;
 }
 
+void CommunicationLink::setLinkMode(CommunicationMode link_mode)
+{
+    link_mode_         = link_mode;
+    link_ack_en_       = (link_mode_ == MODE_SLAVE) ? TRUE : FALSE;
+    shake_hands_state_ = FALSE;
+    receive_state_     = WAITING_FF_A;
+}
+
 void CommunicationLink::enableAck(void)
 {
     if (!link_ack_en_) {
@@ -107,7 +119,7 @@ unsigned char CommunicationLink::sendCommandFromMaster(
     CommunicationCommandState command_state)
 {
     unsigned char  analysis_state = TRUE;
-    unsigned char *single_command;
+    unsigned char *single_command = 0;
 
     if (link_mode_ != MODE_MASTER) {
         return FALSE;
@@ -116,69 +128,88 @@ unsigned char CommunicationLink::sendCommandFromMaster(
     switch (command_state) {
         case READ_GLOBAL_COORDINATE: {
             READ_COMMAND_STATE;
+            break;
         }
         case READ_GLOBAL_COORD_SPEED: {
             READ_COMMAND_STATE;
+            break;
         }
         case READ_ROBOT_COORDINATE: {
             READ_COMMAND_STATE;
+            break;
         }
         case READ_ROBOT_COORD_SPEED: {
             READ_COMMAND_STATE;
+            break;
         }
         case READ_ROBOT_IMU: {
             READ_COMMAND_STATE;
+            break;
         }
         case READ_MOTOR_SPEED: {
             READ_COMMAND_STATE;
+            break;
         }
         case READ_MOTOR_MILEAGE: {
             READ_COMMAND_STATE;
+            break;
         }
         case READ_ROBOT_HEIGHT: {
             READ_COMMAND_STATE;
+            break;
         }
         case READ_MOTOR_THRUST: {
             READ_COMMAND_STATE;
+            break;
         }
         case READ_ROBOT_SPACE_POSE: {
             READ_COMMAND_STATE;
+            break;
         }
         case READ_ROBOT_SYSTEM_INFO: {
             READ_COMMAND_STATE;
+            break;
         }
         case SHAKE_HANDS: {
             shake_hands_state_ = TRUE;
             WRITE_COMMAND_STATE(data_type_->global_coordinate_actual_);
+            break;
         }
         case WRITE_GLOBAL_COORD_SPEED: {
             WRITE_COMMAND_STATE(data_type_->global_coord_speed_target_);
+            break;
         }
         case WRITE_ROBOT_COORD_SPEED: {
             WRITE_COMMAND_STATE(data_type_->robot_coord_speed_target_);
+            break;
         }
         case WRITE_MOTOR_SPEED: {
             WRITE_COMMAND_STATE(data_type_->motor_speed_target_);
+            break;
         }
         case WRITE_ROBOT_IMU: {
             WRITE_COMMAND_STATE(data_type_->robot_imu_target_);
+            break;
         }
         case WRITE_ROBOT_HEIGHT: {
             WRITE_COMMAND_STATE(data_type_->robot_height_target_);
+            break;
         }
         case WRITE_MOTOR_THRUST: {
             WRITE_COMMAND_STATE(data_type_->motor_thrust_target_);
+            break;
         }
         case WRITE_ROBOT_SPACE_POSE: {
             WRITE_COMMAND_STATE(data_type_->robot_space_pose_target_);
+            break;
         }
         default: {
             analysis_state = FALSE;
             break;
         }
-
-        return analysis_state;
     }
+
+    return analysis_state;
 }
 
 unsigned char CommunicationLink::analyseReceiveByte(unsigned char recv_byte)
@@ -206,6 +237,21 @@ unsigned char CommunicationLink::getReceiveState(
     return recv_package_state_[command_state];
 }
 
+CommunicationCommandState CommunicationLink::getReceiveCommand(void)
+{
+    return command_state_;
+}
+
+unsigned char *CommunicationLink::getReceiveData(void)
+{
+    return recv_data_type_;
+}
+
+unsigned short CommunicationLink::getReceiveLength(void)
+{
+    return recv_data_type_length_;
+}
+
 unsigned char *CommunicationLink::getSerializeData(void)
 {
     return send_buffer_;
@@ -363,9 +409,11 @@ unsigned char CommunicationLink::analyseReceiveStates(unsigned char recv_data)
 unsigned char CommunicationLink::analyseReceivePackage(void)
 {
     unsigned char  analysis_state = FALSE;
-    unsigned char *single_command;
+    unsigned char *single_command = 0;
 
-    command_state_ = (CommunicationCommandState)recv_message_.data[0];
+    command_state_         = (CommunicationCommandState)recv_message_.data[0];
+    recv_data_type_        = 0;
+    recv_data_type_length_ = 0;
 
     // The slave need to check the state of SHAKE_HANDS.
     if (link_mode_ == MODE_SLAVE) {
@@ -537,6 +585,8 @@ unsigned char CommunicationLink::analyseReadCommand(
         }
         memcpy(data_type, &recv_message_.data[1],
                data_type_length);
+        recv_data_type_        = data_type;
+        recv_data_type_length_ = data_type_length;
         recv_package_state_[(unsigned char)command_state] = TRUE;
     }
     // The master publish a read command to slave, and the slave feedback some
@@ -554,10 +604,10 @@ unsigned char CommunicationLink::analyseWriteCommand(
     unsigned char *data_type,
     unsigned short data_type_length)
 {
-    unsigned char *ack;
+    unsigned char *ack = 0;
 
     // The master receive the slave's ack.
-    if (link_mode_ = MODE_MASTER) {
+    if (link_mode_ == MODE_MASTER) {
         if (command_state == SHAKE_HANDS) {
             shake_hands_state_ = TRUE;
             printf("The slave is waiting master send data!\n");
@@ -569,7 +619,7 @@ unsigned char CommunicationLink::analyseWriteCommand(
     }
     // The master publish a write command to slave, the slave save this package
     // and feedback ack to master.
-    else if (link_mode_ = MODE_SLAVE) {
+    else if (link_mode_ == MODE_SLAVE) {
         if ((recv_message_.length - 1) != data_type_length) {
             printf("Error, the slave can not read message from master!\n");
             return FALSE;
@@ -578,10 +628,9 @@ unsigned char CommunicationLink::analyseWriteCommand(
         if (command_state == SHAKE_HANDS) {
             shake_hands_state_ = TRUE;
         }
-        else {
-            // The slave receive master's write package.
-            sendData(command_state, ack, 0);
-        }
+        // The slave receive master's write package(or shake hands), and the
+        // ack lets master stop resending it.
+        sendData(command_state, ack, 0);
         recv_package_state_[(unsigned char)command_state] = TRUE;
     }
 
@@ -0,0 +1,92 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .h file defines the class for republishing received frames and
+ *  snapshots of data types to local consumers.
+ *
+ *  The URL selects the transport:
+ *  udp://127.0.0.1:20180    unicast to one consumer
+ *  udp://239.255.0.1:20180  multicast to every consumer on this host, which
+ *                           joins the group on 127.0.0.1
+ *  shm:///breeze_telemetry  shared memory ring
+ *
+ *  Every datagram carries one frame with the same layout as the frames of
+ *  recorded flight logs: u64 timestamp(us), u8 command, u8 reserved, u16
+ *  payload length and the payload. Snapshots are sent as frames whose
+ *  command is PUBLISH_SNAPSHOT_COMMAND and payload is the whole data
+ *  type.
+ **********************************************************************/
+
+#ifndef COMMUNICATION_PUBLISHER_H
+#define COMMUNICATION_PUBLISHER_H
+
+#include <sys/types.h>
+#include <string>
+#include <boost/asio.hpp>
+#include <communication_shared_ring.h>
+
+#define PUBLISH_FRAME_HEADER     12
+#define PUBLISH_DEFAULT_URL      "udp://127.0.0.1:20180"
+#define PUBLISH_SNAPSHOT_COMMAND 0xff
+
+class CommunicationPublisher
+{
+public:
+    CommunicationPublisher(std::string publish_url = PUBLISH_DEFAULT_URL);
+    bool getFlagInit(void);
+    void publishFrame(u_int64_t timestamp_us, unsigned char command,
+                      const unsigned char *data, unsigned short length);
+    void publishSnapshot(u_int64_t timestamp_us,
+                         const CommunicationDataType &data_type);
+private:
+    bool initializeUDP(const std::string &address);
+    void sendDatagram(u_int64_t timestamp_us, unsigned char command,
+                      const unsigned char *data, unsigned short length);
+private:
+    bool                           flag_init_;
+    bool                           flag_shared_;
+    std::string                    publish_url_;
+    CommunicationSharedRing        shared_ring_;
+    boost::asio::io_service        io_service_;
+    boost::asio::ip::udp::socket   socket_;
+    boost::asio::ip::udp::endpoint endpoint_;
+};
+
+#endif // COMMUNICATION_PUBLISHER_H
@@ -0,0 +1,132 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .h file defines the shared memory ring for republishing received
+ *  frames and snapshots of data types to local consumers.
+ *
+ *  The ring is written by a single writer(the link thread) and read by any
+ *  number of readers. Every slot and the snapshot are guarded by a sequence
+ *  counter which is odd while being written, readers copy the data out and
+ *  check the counter again, so they never block the writer or each other.
+ *
+ *  +--------+----------+--------+--------+-----+-------------------+
+ *  | header | snapshot | slot 0 | slot 1 | ... | slot(n - 1)       |
+ *  +--------+----------+--------+--------+-----+-------------------+
+ **********************************************************************/
+
+#ifndef COMMUNICATION_SHARED_RING_H
+#define COMMUNICATION_SHARED_RING_H
+
+#include <sys/types.h>
+#include <string>
+#include <communication_data_type.h>
+
+#define SHARED_RING_MAGIC        "BRZSHM01"
+#define SHARED_RING_MAGIC_LENGTH 8
+#define SHARED_RING_VERSION      1
+#define SHARED_RING_SLOT_COUNT   1024
+#define SHARED_RING_SLOT_PAYLOAD 104
+#define SHARED_RING_READ_RETRY   4
+#define SHARED_RING_DEFAULT_NAME "/breeze_telemetry"
+
+typedef struct SharedRingHeader {
+    char      magic[SHARED_RING_MAGIC_LENGTH];
+    u_int32_t version;
+    u_int32_t slot_count;
+    u_int64_t write_index;
+    u_int32_t snapshot_sequence;
+    u_int32_t snapshot_size;
+    u_int64_t snapshot_timestamp_us;
+    u_int64_t reserved[3];
+} SharedRingHeader;
+
+// One slot is 128 bytes, so that a frame never shares cache lines with the
+// frames being written next to it.
+typedef struct SharedRingSlot {
+    u_int32_t     sequence;
+    u_int16_t     length;
+    unsigned char command;
+    unsigned char reserved;
+    u_int64_t     index;
+    u_int64_t     timestamp_us;
+    unsigned char data[SHARED_RING_SLOT_PAYLOAD];
+} SharedRingSlot;
+
+// A frame copied out of ring by reader.
+typedef struct SharedRingFrame {
+    u_int64_t     timestamp_us;
+    unsigned char command;
+    u_int16_t     length;
+    unsigned char data[SHARED_RING_SLOT_PAYLOAD];
+} SharedRingFrame;
+
+class CommunicationSharedRing
+{
+public:
+    CommunicationSharedRing(void);
+    ~CommunicationSharedRing(void);
+    bool createRing(const std::string &ring_name = SHARED_RING_DEFAULT_NAME);
+    bool openRing(const std::string &ring_name = SHARED_RING_DEFAULT_NAME);
+    void closeRing(void);
+    bool getFlagInit(void);
+    void writeFrame(u_int64_t timestamp_us, unsigned char command,
+                    const unsigned char *data, unsigned short length);
+    void writeSnapshot(u_int64_t timestamp_us,
+                       const CommunicationDataType &data_type);
+    bool readFrame(SharedRingFrame &frame);
+    bool readSnapshot(u_int64_t &timestamp_us,
+                      CommunicationDataType &data_type);
+    u_int64_t getLostCount(void);
+private:
+    bool mapRing(const std::string &ring_name, bool flag_create);
+    bool checkRing(void);
+private:
+    bool              flag_init_;
+    bool              flag_owner_;
+    std::string       ring_name_;
+    size_t            map_size_;
+    SharedRingHeader *header_;
+    unsigned char    *snapshot_;
+    SharedRingSlot   *slots_;
+    u_int64_t         read_index_;
+    u_int64_t         lost_count_;
+};
+
+#endif // COMMUNICATION_SHARED_RING_H
@@ -0,0 +1,176 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .cpp file implements the class for republishing received frames and
+ *  snapshots of data types to local consumers.
+ **********************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <boost/array.hpp>
+#include <communication_publisher.h>
+
+CommunicationPublisher::CommunicationPublisher(std::string publish_url) :
+    flag_init_(false),
+    flag_shared_(false),
+    publish_url_(publish_url),
+    socket_(io_service_)
+{
+    size_t position = publish_url_.find("://");
+
+    if (position == std::string::npos) {
+        std::cerr << "URL is error!" << std::endl;
+        return ;
+    }
+
+    std::string publish_mode = publish_url_.substr(0, position);
+    std::string address      = publish_url_.substr(position + 3);
+
+    if (publish_mode == "udp") {
+        flag_init_ = initializeUDP(address);
+    }
+    else if (publish_mode == "shm") {
+        flag_shared_ = true;
+        flag_init_   = shared_ring_.createRing(address);
+    }
+    else {
+        std::cerr << "URL is error!" << std::endl;
+    }
+}
+
+bool CommunicationPublisher::getFlagInit(void)
+{
+    return flag_init_;
+}
+
+void CommunicationPublisher::publishFrame(u_int64_t timestamp_us,
+                                          unsigned char command,
+                                          const unsigned char *data,
+                                          unsigned short length)
+{
+    if (!flag_init_) {
+        return ;
+    }
+
+    if (flag_shared_) {
+        shared_ring_.writeFrame(timestamp_us, command, data, length);
+    }
+    else {
+        sendDatagram(timestamp_us, command, data, length);
+    }
+}
+
+void CommunicationPublisher::publishSnapshot(
+    u_int64_t timestamp_us,
+    const CommunicationDataType &data_type)
+{
+    if (!flag_init_) {
+        return ;
+    }
+
+    if (flag_shared_) {
+        shared_ring_.writeSnapshot(timestamp_us, data_type);
+    }
+    else {
+        sendDatagram(timestamp_us, PUBLISH_SNAPSHOT_COMMAND,
+                     (const unsigned char *)&data_type, sizeof(data_type));
+    }
+}
+
+bool CommunicationPublisher::initializeUDP(const std::string &address)
+{
+    std::string host = address;
+    std::string port = "20180";
+
+    if (address.find(':') != std::string::npos) {
+        host = address.substr(0, address.find(':'));
+        port = address.substr(address.find(':') + 1);
+    }
+
+    try {
+        endpoint_ = boost::asio::ip::udp::endpoint(
+            boost::asio::ip::address::from_string(host), atoi(port.c_str()));
+        socket_.open(endpoint_.protocol());
+        socket_.non_blocking(true);
+
+        // Multicast is sent through the loopback interface and the TTL of
+        // zero keeps it from leaving the host, so the consumers join the
+        // group on 127.0.0.1.
+        if (endpoint_.address().is_multicast()) {
+            socket_.set_option(boost::asio::ip::multicast::outbound_interface(
+                                   boost::asio::ip::address_v4::loopback()));
+            socket_.set_option(boost::asio::ip::multicast::enable_loopback(
+                                   true));
+            socket_.set_option(boost::asio::ip::multicast::hops(0));
+        }
+    }
+    catch (std::exception &exce) {
+        std::cerr << "Failed to open publisher!" << std::endl;
+        std::cerr << "Error information: " << "(" << exce.what() << ")"
+                  << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void CommunicationPublisher::sendDatagram(u_int64_t timestamp_us,
+                                          unsigned char command,
+                                          const unsigned char *data,
+                                          unsigned short length)
+{
+    unsigned char frame_header[PUBLISH_FRAME_HEADER];
+    memcpy(frame_header, &timestamp_us, sizeof(timestamp_us));
+    frame_header[8] = command;
+    frame_header[9] = 0;
+    memcpy(frame_header + 10, &length, sizeof(length));
+
+    // The payload is gathered straight from the data type without copying.
+    boost::array<boost::asio::const_buffer, 2> buffers = {{
+        boost::asio::buffer(frame_header),
+        boost::asio::buffer(data, length)
+    }};
+
+    // Nobody listening or a full socket buffer must never stall the link, so
+    // the frame is simply dropped on error.
+    boost::system::error_code error_code;
+    socket_.send_to(buffers, endpoint_, 0, error_code);
+}
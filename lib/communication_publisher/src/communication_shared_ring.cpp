@@ -0,0 +1,322 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .cpp file implements the shared memory ring for republishing
+ *  received frames and snapshots of data types.
+ **********************************************************************/
+
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <communication_shared_ring.h>
+
+// The snapshot area is rounded up to whole slots, so that slots stay aligned.
+#define SHARED_RING_SNAPSHOT_SIZE                                      \
+    ((sizeof(CommunicationDataType) + sizeof(SharedRingSlot) - 1) /    \
+     sizeof(SharedRingSlot) * sizeof(SharedRingSlot))
+
+CommunicationSharedRing::CommunicationSharedRing(void) :
+    flag_init_(false),
+    flag_owner_(false),
+    map_size_(0),
+    header_(0),
+    snapshot_(0),
+    slots_(0),
+    read_index_(0),
+    lost_count_(0)
+{
+}
+
+CommunicationSharedRing::~CommunicationSharedRing(void)
+{
+    closeRing();
+}
+
+bool CommunicationSharedRing::createRing(const std::string &ring_name)
+{
+    return mapRing(ring_name, true);
+}
+
+bool CommunicationSharedRing::openRing(const std::string &ring_name)
+{
+    return mapRing(ring_name, false);
+}
+
+void CommunicationSharedRing::closeRing(void)
+{
+    if (header_ != 0) {
+        munmap(header_, map_size_);
+    }
+
+    // The readers which still map the ring keep working until they close.
+    if (flag_owner_) {
+        shm_unlink(ring_name_.c_str());
+    }
+
+    flag_init_  = false;
+    flag_owner_ = false;
+    map_size_   = 0;
+    header_     = 0;
+    snapshot_   = 0;
+    slots_      = 0;
+}
+
+bool CommunicationSharedRing::getFlagInit(void)
+{
+    return flag_init_;
+}
+
+void CommunicationSharedRing::writeFrame(u_int64_t timestamp_us,
+                                         unsigned char command,
+                                         const unsigned char *data,
+                                         unsigned short length)
+{
+    if (!flag_init_ || !flag_owner_ || length > SHARED_RING_SLOT_PAYLOAD) {
+        return ;
+    }
+
+    u_int64_t index      = header_->write_index;
+    SharedRingSlot *slot = &slots_[index % SHARED_RING_SLOT_COUNT];
+    u_int32_t sequence   = slot->sequence;
+
+    __atomic_store_n(&slot->sequence, sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    slot->length       = length;
+    slot->command      = command;
+    slot->index        = index;
+    slot->timestamp_us = timestamp_us;
+    memcpy(slot->data, data, length);
+
+    __atomic_store_n(&slot->sequence, sequence + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&header_->write_index, index + 1, __ATOMIC_RELEASE);
+}
+
+void CommunicationSharedRing::writeSnapshot(
+    u_int64_t timestamp_us,
+    const CommunicationDataType &data_type)
+{
+    if (!flag_init_ || !flag_owner_) {
+        return ;
+    }
+
+    u_int32_t sequence = header_->snapshot_sequence;
+
+    __atomic_store_n(&header_->snapshot_sequence, sequence + 1,
+                     __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    header_->snapshot_timestamp_us = timestamp_us;
+    memcpy(snapshot_, &data_type, sizeof(data_type));
+
+    __atomic_store_n(&header_->snapshot_sequence, sequence + 2,
+                     __ATOMIC_RELEASE);
+}
+
+// Read the next frame. A reader which falls more than a whole ring behind
+// skips to the oldest frame still in ring, and gives up after a few torn
+// reads instead of spinning, so the call always returns in bounded time.
+bool CommunicationSharedRing::readFrame(SharedRingFrame &frame)
+{
+    if (!flag_init_) {
+        return false;
+    }
+
+    for (int i = 0; i < SHARED_RING_READ_RETRY; i++) {
+        u_int64_t write_index = __atomic_load_n(&header_->write_index,
+                                                __ATOMIC_ACQUIRE);
+
+        if (read_index_ >= write_index) {
+            return false;
+        }
+
+        if (write_index - read_index_ > SHARED_RING_SLOT_COUNT) {
+            lost_count_ += write_index - SHARED_RING_SLOT_COUNT - read_index_;
+            read_index_  = write_index - SHARED_RING_SLOT_COUNT;
+        }
+
+        const SharedRingSlot *slot =
+            &slots_[read_index_ % SHARED_RING_SLOT_COUNT];
+        u_int32_t sequence = __atomic_load_n(&slot->sequence,
+                                             __ATOMIC_ACQUIRE);
+
+        if ((sequence & 1) == 0) {
+            u_int64_t index    = slot->index;
+            frame.timestamp_us = slot->timestamp_us;
+            frame.command      = slot->command;
+            frame.length       = slot->length;
+
+            if (frame.length <= SHARED_RING_SLOT_PAYLOAD) {
+                memcpy(frame.data, slot->data, frame.length);
+            }
+
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+            if (__atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) ==
+                sequence && index == read_index_ &&
+                frame.length <= SHARED_RING_SLOT_PAYLOAD) {
+                read_index_++;
+                return true;
+            }
+        }
+
+        // The slot is being overwritten, so the reader has been lapped.
+        lost_count_++;
+        read_index_++;
+    }
+
+    return false;
+}
+
+bool CommunicationSharedRing::readSnapshot(u_int64_t &timestamp_us,
+                                           CommunicationDataType &data_type)
+{
+    if (!flag_init_) {
+        return false;
+    }
+
+    for (int i = 0; i < SHARED_RING_READ_RETRY; i++) {
+        u_int32_t sequence = __atomic_load_n(&header_->snapshot_sequence,
+                                             __ATOMIC_ACQUIRE);
+
+        if (sequence & 1) {
+            continue;
+        }
+
+        timestamp_us = header_->snapshot_timestamp_us;
+        memcpy(&data_type, snapshot_, sizeof(data_type));
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        if (__atomic_load_n(&header_->snapshot_sequence, __ATOMIC_RELAXED) ==
+            sequence) {
+            return sequence != 0;
+        }
+    }
+
+    return false;
+}
+
+u_int64_t CommunicationSharedRing::getLostCount(void)
+{
+    return lost_count_;
+}
+
+bool CommunicationSharedRing::mapRing(const std::string &ring_name,
+                                      bool flag_create)
+{
+    closeRing();
+
+    map_size_ = sizeof(SharedRingHeader) + SHARED_RING_SNAPSHOT_SIZE +
+        SHARED_RING_SLOT_COUNT * sizeof(SharedRingSlot);
+
+    int file = shm_open(ring_name.c_str(),
+                        flag_create ? (O_CREAT | O_RDWR) : O_RDONLY, 0644);
+
+    if (file < 0) {
+        std::cerr << "Failed to open shared ring " << ring_name << "!"
+                  << std::endl;
+        return false;
+    }
+
+    if (flag_create && ftruncate(file, map_size_) != 0) {
+        std::cerr << "Failed to resize shared ring " << ring_name << "!"
+                  << std::endl;
+        close(file);
+        return false;
+    }
+
+    void *map_data = mmap(0, map_size_,
+                          flag_create ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                          MAP_SHARED, file, 0);
+    close(file);
+
+    if (map_data == MAP_FAILED) {
+        std::cerr << "Failed to map shared ring " << ring_name << "!"
+                  << std::endl;
+        return false;
+    }
+
+    header_     = (SharedRingHeader *)map_data;
+    snapshot_   = (unsigned char *)map_data + sizeof(SharedRingHeader);
+    slots_      = (SharedRingSlot *)(snapshot_ + SHARED_RING_SNAPSHOT_SIZE);
+    ring_name_  = ring_name;
+    flag_owner_ = flag_create;
+
+    if (flag_create) {
+        // A writer restarted while readers are still attached goes on from
+        // the write index and sequences left in a compatible ring, otherwise
+        // the read indexes would be ahead of it until it caught up.
+        if (!checkRing()) {
+            memset(map_data, 0, map_size_);
+            memcpy(header_->magic, SHARED_RING_MAGIC,
+                   SHARED_RING_MAGIC_LENGTH);
+            header_->version       = SHARED_RING_VERSION;
+            header_->slot_count    = SHARED_RING_SLOT_COUNT;
+            header_->snapshot_size = sizeof(CommunicationDataType);
+        }
+    }
+    else if (!checkRing()) {
+        std::cerr << "Shared ring " << ring_name << " isn't compatible!"
+                  << std::endl;
+        closeRing();
+        return false;
+    }
+    else {
+        // A new reader starts from the latest frame rather than the oldest.
+        read_index_ = __atomic_load_n(&header_->write_index, __ATOMIC_ACQUIRE);
+        lost_count_ = 0;
+    }
+
+    flag_init_ = true;
+
+    return true;
+}
+
+bool CommunicationSharedRing::checkRing(void)
+{
+    return memcmp(header_->magic, SHARED_RING_MAGIC,
+                  SHARED_RING_MAGIC_LENGTH) == 0 &&
+           header_->version == SHARED_RING_VERSION &&
+           header_->slot_count == SHARED_RING_SLOT_COUNT &&
+           header_->snapshot_size == sizeof(CommunicationDataType);
+}
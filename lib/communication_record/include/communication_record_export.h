@@ -0,0 +1,121 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .h file defines the class for exporting flight logs into
+ *  per-channel columnar files, the chunks of log are decoded by a pool
+ *  of threads.
+ *
+ *  A columnar file(.bcol) starts with a header(magic "BRZCOL01", u32
+ *  version, u32 reserved) and is followed by blocks, one per log chunk:
+ *
+ *  +--------------+--------------+------------------+-----------------+
+ *  | sample count | payload size | timestamp deltas | values xor last |
+ *  |     u32      |     u32      |  zigzag varints  |     varints     |
+ *  +--------------+--------------+------------------+-----------------+
+ *
+ *  Every block starts from timestamp 0 and value bits 0, so that blocks
+ *  can be decoded independently.
+ **********************************************************************/
+
+#ifndef COMMUNICATION_RECORD_EXPORT_H
+#define COMMUNICATION_RECORD_EXPORT_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <boost/asio.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread.hpp>
+#include <communication_record_reader.h>
+
+#define EXPORT_COLUMNAR_MAGIC   "BRZCOL01"
+#define EXPORT_COLUMNAR_VERSION 1
+
+typedef enum RecordExportFormat {
+    EXPORT_CSV,
+    EXPORT_COLUMNAR
+} RecordExportFormat;
+
+typedef boost::scoped_ptr<boost::asio::io_service::work> ExportWork;
+
+// The encoded samples of all channels in one chunk, a broken chunk keeps
+// the samples decoded before the damage.
+typedef struct RecordExportColumns {
+    bool        broken;
+    u_int32_t   sample_count[RECORD_CHANNEL_COUNT];
+    std::string payload[RECORD_CHANNEL_COUNT];
+} RecordExportColumns;
+
+class CommunicationRecordExport
+{
+public:
+    CommunicationRecordExport(u_int32_t thread_count = 0);
+    ~CommunicationRecordExport(void);
+    bool exportRecord(const std::string &record_file,
+                      const std::string &output_dir,
+                      RecordExportFormat format);
+    u_int32_t getChunkCount(void);
+    u_int32_t getChunkDone(void);
+    u_int32_t getChunkBroken(void);
+private:
+    void runWorkerThread(void);
+    void runEncodeTask(u_int32_t chunk, RecordExportColumns *columns);
+    void encodeChunk(u_int32_t chunk, RecordExportColumns *columns);
+    bool writeColumns(const RecordExportColumns &columns);
+    bool openChannelFile(int channel);
+    bool closeChannelFiles(void);
+private:
+    u_int32_t                  thread_count_;
+    u_int32_t                  task_count_;
+    u_int32_t                  chunk_count_;
+    u_int32_t                  chunk_done_;
+    u_int32_t                  chunk_broken_;
+    RecordExportFormat         format_;
+    std::string                output_dir_;
+    FILE                      *files_[RECORD_CHANNEL_COUNT];
+    CommunicationRecordReader  reader_;
+    boost::asio::io_service    io_service_;
+    ExportWork                 io_service_work_;
+    boost::thread_group        thread_group_;
+    boost::mutex               mutex_task_;
+    boost::condition_variable  condition_task_;
+};
+
+#endif // COMMUNICATION_RECORD_EXPORT_H
@@ -0,0 +1,124 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .h file defines the file format of recorded flight logs.
+ *
+ *  A record file is made of a header, a sequence of chunks and a
+ *  footer. Every chunk holds the frames received in one interval of
+ *  time. The footer holds a sparse time index (one entry per chunk)
+ *  and a pyramid of per-chunk min/max summaries for every telemetry
+ *  channel, so that seeking and zoomed-out overviews never need to
+ *  decode more than one chunk.
+ *
+ *  +--------+---------+-----+---------+-------+---------+---------+
+ *  | header | chunk 0 | ... | chunk n | index | summary | trailer |
+ *  +--------+---------+-----+---------+-------+---------+---------+
+ **********************************************************************/
+
+#ifndef COMMUNICATION_RECORD_FORMAT_H
+#define COMMUNICATION_RECORD_FORMAT_H
+
+#include <sys/types.h>
+#include <communication_link.h>
+
+#define RECORD_HEADER_MAGIC   "BRZLOG01"
+#define RECORD_TRAILER_MAGIC  "BRZIDX01"
+#define RECORD_MAGIC_LENGTH   8
+#define RECORD_VERSION        1
+#define RECORD_FRAME_HEADER   12
+#define RECORD_CHANNEL_COUNT  37
+
+// The header is placed at the beginning of file.
+typedef struct RecordFileHeader {
+    char      magic[RECORD_MAGIC_LENGTH];
+    u_int32_t version;
+    u_int32_t channel_count;
+    u_int32_t chunk_interval_ms;
+    u_int32_t reserved;
+    u_int64_t time_begin_us;
+} RecordFileHeader;
+
+// One entry of sparse time index, every chunk owns an entry.
+typedef struct RecordIndexEntry {
+    u_int64_t time_begin_us;
+    u_int64_t time_end_us;
+    u_int64_t offset;
+    u_int32_t size;
+    u_int32_t frame_count;
+} RecordIndexEntry;
+
+// The min/max summary of one channel in one chunk(or a group of chunks).
+typedef struct RecordSummaryEntry {
+    float value_min;
+    float value_max;
+} RecordSummaryEntry;
+
+// The trailer is placed at the end of file and locates the footer.
+typedef struct RecordFileTrailer {
+    char      magic[RECORD_MAGIC_LENGTH];
+    u_int64_t footer_offset;
+    u_int32_t chunk_count;
+    u_int32_t channel_count;
+    u_int32_t level_count;
+    u_int32_t reserved;
+} RecordFileTrailer;
+
+// A telemetry channel is one float field of a read command's data type.
+typedef struct RecordChannel {
+    const char    *name;
+    unsigned char  command;
+    unsigned char  index;
+} RecordChannel;
+
+// A frame decoded from chunk, the data points into the mapped file.
+typedef struct RecordFrame {
+    u_int64_t            timestamp_us;
+    unsigned char        command;
+    unsigned short       length;
+    const unsigned char *data;
+} RecordFrame;
+
+extern const RecordChannel RECORD_CHANNEL_TABLE[RECORD_CHANNEL_COUNT];
+
+// Get the first channel of command and the number of its channels, return -1
+// if the command doesn't carry telemetry.
+int getRecordChannelBase(unsigned char command, int *channel_count = 0);
+
+#endif // COMMUNICATION_RECORD_FORMAT_H
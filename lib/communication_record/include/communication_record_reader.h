@@ -0,0 +1,83 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .h file defines the class for seeking and reading indexed flight
+ *  logs, the file is mapped into memory so that opening it is instant.
+ **********************************************************************/
+
+#ifndef COMMUNICATION_RECORD_READER_H
+#define COMMUNICATION_RECORD_READER_H
+
+#include <string>
+#include <vector>
+#include <communication_record_format.h>
+
+class CommunicationRecordReader
+{
+public:
+    CommunicationRecordReader(void);
+    ~CommunicationRecordReader(void);
+    bool openRecord(const std::string &file_name);
+    void closeRecord(void);
+    bool getFlagOpen(void);
+    u_int32_t getChunkCount(void);
+    u_int32_t getChunkIntervalMs(void);
+    u_int64_t getTimeBegin(void);
+    u_int64_t getTimeEnd(void);
+    const RecordIndexEntry *getChunkIndex(u_int32_t chunk);
+    int seekChunk(u_int64_t timestamp_us);
+    bool decodeChunk(u_int32_t chunk, std::vector<RecordFrame> &frames);
+    bool queryRange(int channel, u_int64_t time_begin_us,
+                    u_int64_t time_end_us, float &value_min,
+                    float &value_max);
+private:
+    bool checkRecord(void);
+private:
+    bool                                    flag_open_;
+    int                                     file_;
+    const unsigned char                    *map_data_;
+    u_int64_t                               map_size_;
+    const RecordFileHeader                 *header_;
+    const RecordFileTrailer                *trailer_;
+    const RecordIndexEntry                 *index_;
+    std::vector<const RecordSummaryEntry *> levels_;
+};
+
+#endif // COMMUNICATION_RECORD_READER_H
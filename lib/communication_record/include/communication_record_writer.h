@@ -0,0 +1,84 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .h file defines the class for recording received frames into an
+ *  indexed flight log.
+ **********************************************************************/
+
+#ifndef COMMUNICATION_RECORD_WRITER_H
+#define COMMUNICATION_RECORD_WRITER_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <communication_record_format.h>
+
+class CommunicationRecordWriter
+{
+public:
+    CommunicationRecordWriter(void);
+    ~CommunicationRecordWriter(void);
+    bool openRecord(const std::string &file_name,
+                    u_int32_t chunk_interval_ms = 1000);
+    bool writeFrame(u_int64_t timestamp_us, unsigned char command,
+                    const unsigned char *data, unsigned short length);
+    bool closeRecord(void);
+    bool getFlagOpen(void);
+private:
+    bool writeBytes(const void *data, u_int64_t length);
+    bool flushChunk(void);
+    bool writeFooter(void);
+    bool writeTimeBegin(void);
+    void updateSummary(unsigned char command, const unsigned char *data,
+                       unsigned short length);
+private:
+    bool                            flag_open_;
+    FILE                           *file_;
+    u_int32_t                       chunk_interval_ms_;
+    u_int64_t                       file_offset_;
+    u_int64_t                       time_last_us_;
+    RecordIndexEntry                chunk_entry_;
+    RecordSummaryEntry              chunk_summary_[RECORD_CHANNEL_COUNT];
+    std::vector<unsigned char>      chunk_buffer_;
+    std::vector<RecordIndexEntry>   index_;
+    std::vector<RecordSummaryEntry> summary_;
+};
+
+#endif // COMMUNICATION_RECORD_WRITER_H
@@ -0,0 +1,373 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .cpp file implements the class for exporting flight logs into
+ *  per-channel columnar files.
+ **********************************************************************/
+
+#include <cstring>
+#include <iostream>
+#include <boost/bind.hpp>
+#include <communication_record_export.h>
+
+// Append an unsigned integer as little-endian base-128 varint.
+static void appendVarint(std::string &payload, u_int64_t value)
+{
+    while (value >= 0x80) {
+        payload.push_back((char)((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+
+    payload.push_back((char)value);
+}
+
+CommunicationRecordExport::CommunicationRecordExport(u_int32_t thread_count) :
+    thread_count_(thread_count),
+    task_count_(0),
+    chunk_count_(0),
+    chunk_done_(0),
+    chunk_broken_(0),
+    format_(EXPORT_CSV)
+{
+    if (thread_count_ == 0) {
+        thread_count_ = boost::thread::hardware_concurrency();
+    }
+
+    if (thread_count_ == 0) {
+        thread_count_ = 1;
+    }
+
+    for (int i = 0; i < RECORD_CHANNEL_COUNT; i++) {
+        files_[i] = 0;
+    }
+
+    io_service_work_.reset(new boost::asio::io_service::work(io_service_));
+
+    for (u_int32_t i = 0; i < thread_count_; i++) {
+        thread_group_.create_thread(boost::bind(
+            &CommunicationRecordExport::runWorkerThread, this));
+    }
+}
+
+CommunicationRecordExport::~CommunicationRecordExport(void)
+{
+    io_service_work_.reset();
+    io_service_.stop();
+    thread_group_.join_all();
+    closeChannelFiles();
+}
+
+bool CommunicationRecordExport::exportRecord(const std::string &record_file,
+                                             const std::string &output_dir,
+                                             RecordExportFormat format)
+{
+    if (!reader_.openRecord(record_file)) {
+        return false;
+    }
+
+    format_      = format;
+    output_dir_  = output_dir;
+    chunk_count_  = reader_.getChunkCount();
+    chunk_done_   = 0;
+    chunk_broken_ = 0;
+
+    // Only a few chunks per thread are held in memory at once, the encoded
+    // columns are appended to the files in order of chunks before the next
+    // batch is decoded, so the memory doesn't grow with the size of log.
+    u_int32_t batch_size = thread_count_ * 4;
+    std::vector<RecordExportColumns> batch(batch_size);
+    bool result = true;
+
+    for (u_int32_t batch_begin = 0; batch_begin < chunk_count_ && result;
+         batch_begin += batch_size) {
+        u_int32_t batch_end = batch_begin + batch_size;
+
+        if (batch_end > chunk_count_) {
+            batch_end = chunk_count_;
+        }
+
+        {
+            boost::mutex::scoped_lock lock(mutex_task_);
+            task_count_ = batch_end - batch_begin;
+        }
+
+        for (u_int32_t i = batch_begin; i < batch_end; i++) {
+            io_service_.post(boost::bind(
+                &CommunicationRecordExport::runEncodeTask, this, i,
+                &batch[i - batch_begin]));
+        }
+
+        {
+            boost::mutex::scoped_lock lock(mutex_task_);
+
+            while (task_count_ > 0) {
+                condition_task_.wait(lock);
+            }
+        }
+
+        u_int32_t batch_broken = 0;
+
+        for (u_int32_t i = batch_begin; i < batch_end && result; i++) {
+            result = writeColumns(batch[i - batch_begin]);
+
+            if (batch[i - batch_begin].broken) {
+                batch_broken++;
+            }
+        }
+
+        boost::mutex::scoped_lock lock(mutex_task_);
+        chunk_done_    = batch_end;
+        chunk_broken_ += batch_broken;
+    }
+
+    if (!closeChannelFiles()) {
+        result = false;
+    }
+
+    reader_.closeRecord();
+
+    // The rest of log is still exported, but a log missing some chunks is
+    // not reported as exported.
+    if (chunk_broken_ > 0) {
+        std::cerr << "Skipped " << chunk_broken_ << " broken chunks of "
+                  << "record file " << record_file << "!" << std::endl;
+        result = false;
+    }
+
+    if (!result) {
+        std::cerr << "Failed to export record file " << record_file << "!"
+                  << std::endl;
+    }
+
+    return result;
+}
+
+u_int32_t CommunicationRecordExport::getChunkCount(void)
+{
+    return chunk_count_;
+}
+
+u_int32_t CommunicationRecordExport::getChunkDone(void)
+{
+    boost::mutex::scoped_lock lock(mutex_task_);
+    return chunk_done_;
+}
+
+u_int32_t CommunicationRecordExport::getChunkBroken(void)
+{
+    boost::mutex::scoped_lock lock(mutex_task_);
+    return chunk_broken_;
+}
+
+void CommunicationRecordExport::runWorkerThread(void)
+{
+    io_service_.run();
+}
+
+void CommunicationRecordExport::runEncodeTask(u_int32_t chunk,
+                                              RecordExportColumns *columns)
+{
+    encodeChunk(chunk, columns);
+
+    boost::mutex::scoped_lock lock(mutex_task_);
+
+    if (--task_count_ == 0) {
+        condition_task_.notify_one();
+    }
+}
+
+void CommunicationRecordExport::encodeChunk(u_int32_t chunk,
+                                            RecordExportColumns *columns)
+{
+    std::vector<RecordFrame> frames;
+    u_int64_t time_last_us[RECORD_CHANNEL_COUNT];
+    u_int32_t value_last[RECORD_CHANNEL_COUNT];
+
+    for (int i = 0; i < RECORD_CHANNEL_COUNT; i++) {
+        columns->sample_count[i] = 0;
+        columns->payload[i].clear();
+        time_last_us[i] = 0;
+        value_last[i]   = 0;
+    }
+
+    columns->broken = !reader_.decodeChunk(chunk, frames);
+
+    if (columns->broken) {
+        std::cerr << "Skip broken chunk " << chunk << "!" << std::endl;
+    }
+
+    // The columnar payload keeps timestamps and values apart, so they are
+    // encoded into separate buffers and joined when the chunk is done.
+    std::vector<std::string> values(format_ == EXPORT_COLUMNAR ?
+                                    RECORD_CHANNEL_COUNT : 0);
+    char line[64];
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        const RecordFrame &frame = frames[i];
+        int channel_count        = 0;
+        int channel_base         = getRecordChannelBase(frame.command,
+                                                        &channel_count);
+
+        if (channel_base < 0 ||
+            frame.length < channel_count * sizeof(float)) {
+            continue;
+        }
+
+        for (int j = 0; j < channel_count; j++) {
+            int channel = channel_base + j;
+            float value;
+            memcpy(&value, frame.data + j * sizeof(float), sizeof(float));
+
+            if (format_ == EXPORT_CSV) {
+                int length = snprintf(line, sizeof(line), "%llu,%.9g\n",
+                                      (unsigned long long)frame.timestamp_us,
+                                      value);
+                columns->payload[channel].append(line, length);
+            }
+            else {
+                int64_t time_delta = (int64_t)(frame.timestamp_us -
+                                               time_last_us[channel]);
+                u_int32_t value_bits;
+                memcpy(&value_bits, &value, sizeof(value_bits));
+
+                // Zigzag keeps small negative deltas short, xor with the last
+                // value leaves only the changed low bits of a slow signal.
+                appendVarint(columns->payload[channel],
+                             ((u_int64_t)time_delta << 1) ^
+                             (u_int64_t)(time_delta >> 63));
+                appendVarint(values[channel], value_bits ^ value_last[channel]);
+
+                time_last_us[channel] = frame.timestamp_us;
+                value_last[channel]   = value_bits;
+            }
+
+            columns->sample_count[channel]++;
+        }
+    }
+
+    for (size_t i = 0; i < values.size(); i++) {
+        columns->payload[i].append(values[i]);
+    }
+}
+
+bool CommunicationRecordExport::writeColumns(
+    const RecordExportColumns &columns)
+{
+    for (int i = 0; i < RECORD_CHANNEL_COUNT; i++) {
+        if (columns.sample_count[i] == 0) {
+            continue;
+        }
+
+        if (files_[i] == 0 && !openChannelFile(i)) {
+            return false;
+        }
+
+        const std::string &payload = columns.payload[i];
+
+        if (format_ == EXPORT_COLUMNAR) {
+            u_int32_t block_header[2];
+            block_header[0] = columns.sample_count[i];
+            block_header[1] = payload.size();
+
+            if (fwrite(block_header, sizeof(block_header), 1, files_[i]) != 1) {
+                return false;
+            }
+        }
+
+        if (fwrite(payload.data(), 1, payload.size(), files_[i]) !=
+            payload.size()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool CommunicationRecordExport::openChannelFile(int channel)
+{
+    std::string file_name = output_dir_ + "/" +
+        RECORD_CHANNEL_TABLE[channel].name +
+        (format_ == EXPORT_CSV ? ".csv" : ".bcol");
+
+    files_[channel] = fopen(file_name.c_str(), "wb");
+
+    if (files_[channel] == 0) {
+        std::cerr << "Failed to open export file " << file_name << "!"
+                  << std::endl;
+        return false;
+    }
+
+    if (format_ == EXPORT_CSV) {
+        if (fprintf(files_[channel], "timestamp_us,%s\n",
+                    RECORD_CHANNEL_TABLE[channel].name) < 0) {
+            return false;
+        }
+    }
+    else {
+        u_int32_t file_header[2] = { EXPORT_COLUMNAR_VERSION, 0 };
+
+        if (fwrite(EXPORT_COLUMNAR_MAGIC, 1, 8, files_[channel]) != 8 ||
+            fwrite(file_header, sizeof(file_header), 1,
+                   files_[channel]) != 1) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool CommunicationRecordExport::closeChannelFiles(void)
+{
+    bool result = true;
+
+    // Buffered data is only flushed here, so a full disk may show up first
+    // when a file is closed.
+    for (int i = 0; i < RECORD_CHANNEL_COUNT; i++) {
+        if (files_[i] != 0) {
+            if (fclose(files_[i]) != 0) {
+                result = false;
+            }
+
+            files_[i] = 0;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,105 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .cpp file defines the telemetry channels of recorded flight logs.
+ **********************************************************************/
+
+#include <communication_record_format.h>
+
+const RecordChannel RECORD_CHANNEL_TABLE[RECORD_CHANNEL_COUNT] = {
+    { "global_coordinate.axis_x",  READ_GLOBAL_COORDINATE,  0 },
+    { "global_coordinate.axis_y",  READ_GLOBAL_COORDINATE,  1 },
+    { "global_coordinate.axis_z",  READ_GLOBAL_COORDINATE,  2 },
+    { "global_coord_speed.axis_x", READ_GLOBAL_COORD_SPEED, 0 },
+    { "global_coord_speed.axis_y", READ_GLOBAL_COORD_SPEED, 1 },
+    { "global_coord_speed.axis_z", READ_GLOBAL_COORD_SPEED, 2 },
+    { "robot_coordinate.axis_x",   READ_ROBOT_COORDINATE,   0 },
+    { "robot_coordinate.axis_y",   READ_ROBOT_COORDINATE,   1 },
+    { "robot_coordinate.axis_z",   READ_ROBOT_COORDINATE,   2 },
+    { "robot_coord_speed.axis_x",  READ_ROBOT_COORD_SPEED,  0 },
+    { "robot_coord_speed.axis_y",  READ_ROBOT_COORD_SPEED,  1 },
+    { "robot_coord_speed.axis_z",  READ_ROBOT_COORD_SPEED,  2 },
+    { "robot_imu.acc_x",           READ_ROBOT_IMU,          0 },
+    { "robot_imu.acc_y",           READ_ROBOT_IMU,          1 },
+    { "robot_imu.acc_z",           READ_ROBOT_IMU,          2 },
+    { "robot_imu.att_r",           READ_ROBOT_IMU,          3 },
+    { "robot_imu.att_p",           READ_ROBOT_IMU,          4 },
+    { "robot_imu.att_y",           READ_ROBOT_IMU,          5 },
+    { "motor_speed.motor_a",       READ_MOTOR_SPEED,        0 },
+    { "motor_speed.motor_b",       READ_MOTOR_SPEED,        1 },
+    { "motor_speed.motor_c",       READ_MOTOR_SPEED,        2 },
+    { "motor_speed.motor_d",       READ_MOTOR_SPEED,        3 },
+    { "motor_mileage.motor_a",     READ_MOTOR_MILEAGE,      0 },
+    { "motor_mileage.motor_b",     READ_MOTOR_MILEAGE,      1 },
+    { "motor_mileage.motor_c",     READ_MOTOR_MILEAGE,      2 },
+    { "motor_mileage.motor_d",     READ_MOTOR_MILEAGE,      3 },
+    { "robot_height.alt",          READ_ROBOT_HEIGHT,       0 },
+    { "robot_height.hei",          READ_ROBOT_HEIGHT,       1 },
+    { "motor_thrust.thrust",       READ_MOTOR_THRUST,       0 },
+    { "robot_space_pose.axis_x",   READ_ROBOT_SPACE_POSE,   0 },
+    { "robot_space_pose.axis_y",   READ_ROBOT_SPACE_POSE,   1 },
+    { "robot_space_pose.axis_z",   READ_ROBOT_SPACE_POSE,   2 },
+    { "robot_space_pose.att_r",    READ_ROBOT_SPACE_POSE,   3 },
+    { "robot_space_pose.att_p",    READ_ROBOT_SPACE_POSE,   4 },
+    { "robot_space_pose.att_y",    READ_ROBOT_SPACE_POSE,   5 },
+    { "robot_system_info.battery", READ_ROBOT_SYSTEM_INFO,  0 },
+    { "robot_system_info.link",    READ_ROBOT_SYSTEM_INFO,  1 }
+};
+
+int getRecordChannelBase(unsigned char command, int *channel_count)
+{
+    int channel_base = -1;
+    int count        = 0;
+
+    for (int i = 0; i < RECORD_CHANNEL_COUNT; i++) {
+        if (RECORD_CHANNEL_TABLE[i].command == command) {
+            if (channel_base < 0) {
+                channel_base = i;
+            }
+            count++;
+        }
+    }
+
+    if (channel_count) {
+        *channel_count = count;
+    }
+
+    return channel_base;
+}
@@ -0,0 +1,370 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .cpp file implements the class for seeking and reading indexed
+ *  flight logs.
+ **********************************************************************/
+
+#include <cfloat>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <communication_record_reader.h>
+
+CommunicationRecordReader::CommunicationRecordReader(void) :
+    flag_open_(false),
+    file_(-1),
+    map_data_(0),
+    map_size_(0),
+    header_(0),
+    trailer_(0),
+    index_(0)
+{
+}
+
+CommunicationRecordReader::~CommunicationRecordReader(void)
+{
+    closeRecord();
+}
+
+bool CommunicationRecordReader::openRecord(const std::string &file_name)
+{
+    closeRecord();
+
+    file_ = open(file_name.c_str(), O_RDONLY);
+
+    if (file_ < 0) {
+        std::cerr << "Failed to open record file " << file_name << "!"
+                  << std::endl;
+        return false;
+    }
+
+    struct stat file_stat;
+
+    if (fstat(file_, &file_stat) != 0 ||
+        file_stat.st_size < (off_t)(sizeof(RecordFileHeader) +
+                                    sizeof(RecordFileTrailer))) {
+        std::cerr << "Record file " << file_name << " is too short!"
+                  << std::endl;
+        closeRecord();
+        return false;
+    }
+
+    map_size_ = file_stat.st_size;
+
+    void *map_data = mmap(0, map_size_, PROT_READ, MAP_SHARED, file_, 0);
+
+    if (map_data == MAP_FAILED) {
+        std::cerr << "Failed to map record file " << file_name << "!"
+                  << std::endl;
+        map_size_ = 0;
+        closeRecord();
+        return false;
+    }
+
+    map_data_ = (const unsigned char *)map_data;
+
+    if (!checkRecord()) {
+        std::cerr << "Record file " << file_name << " is broken or wasn't "
+                  << "closed properly!" << std::endl;
+        closeRecord();
+        return false;
+    }
+
+    flag_open_ = true;
+
+    return true;
+}
+
+void CommunicationRecordReader::closeRecord(void)
+{
+    if (map_data_ != 0) {
+        munmap((void *)map_data_, map_size_);
+    }
+
+    if (file_ >= 0) {
+        close(file_);
+    }
+
+    flag_open_ = false;
+    file_      = -1;
+    map_data_  = 0;
+    map_size_  = 0;
+    header_    = 0;
+    trailer_   = 0;
+    index_     = 0;
+
+    levels_.clear();
+}
+
+bool CommunicationRecordReader::getFlagOpen(void)
+{
+    return flag_open_;
+}
+
+u_int32_t CommunicationRecordReader::getChunkCount(void)
+{
+    return flag_open_ ? trailer_->chunk_count : 0;
+}
+
+u_int32_t CommunicationRecordReader::getChunkIntervalMs(void)
+{
+    return flag_open_ ? header_->chunk_interval_ms : 0;
+}
+
+u_int64_t CommunicationRecordReader::getTimeBegin(void)
+{
+    if (getChunkCount() == 0) {
+        return 0;
+    }
+
+    return index_[0].time_begin_us;
+}
+
+u_int64_t CommunicationRecordReader::getTimeEnd(void)
+{
+    if (getChunkCount() == 0) {
+        return 0;
+    }
+
+    return index_[trailer_->chunk_count - 1].time_end_us;
+}
+
+const RecordIndexEntry *CommunicationRecordReader::getChunkIndex(
+    u_int32_t chunk)
+{
+    if (chunk >= getChunkCount()) {
+        return 0;
+    }
+
+    return &index_[chunk];
+}
+
+// Find the chunk which covers the timestamp, or the last chunk beginning
+// before it when the timestamp falls into a gap between two chunks.
+int CommunicationRecordReader::seekChunk(u_int64_t timestamp_us)
+{
+    u_int32_t chunk_count = getChunkCount();
+
+    if (chunk_count == 0) {
+        return -1;
+    }
+
+    u_int32_t low  = 0;
+    u_int32_t high = chunk_count;
+
+    while (low < high) {
+        u_int32_t middle = low + (high - low) / 2;
+
+        if (index_[middle].time_begin_us <= timestamp_us) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    return (low > 0) ? low - 1 : 0;
+}
+
+bool CommunicationRecordReader::decodeChunk(u_int32_t chunk,
+                                            std::vector<RecordFrame> &frames)
+{
+    frames.clear();
+
+    if (chunk >= getChunkCount()) {
+        return false;
+    }
+
+    const RecordIndexEntry &entry = index_[chunk];
+    const unsigned char *data     = map_data_ + entry.offset;
+    const unsigned char *data_end = data + entry.size;
+
+    frames.reserve(entry.frame_count);
+
+    while (data + RECORD_FRAME_HEADER <= data_end) {
+        RecordFrame frame;
+        memcpy(&frame.timestamp_us, data, sizeof(frame.timestamp_us));
+        frame.command = data[8];
+        memcpy(&frame.length, data + 10, sizeof(frame.length));
+        frame.data = data + RECORD_FRAME_HEADER;
+
+        if (frame.data + frame.length > data_end) {
+            std::cerr << "Frame of chunk " << chunk << " is truncated!"
+                      << std::endl;
+            return false;
+        }
+
+        frames.push_back(frame);
+        data = frame.data + frame.length;
+    }
+
+    return frames.size() == entry.frame_count;
+}
+
+// Get the min/max value of channel in a period of time from the summary
+// pyramid. The chunks overlapping the period are located by binary search,
+// then the pyramid is climbed from both ends of chunk range, so that at most
+// two summaries per level are merged.
+bool CommunicationRecordReader::queryRange(int channel,
+                                           u_int64_t time_begin_us,
+                                           u_int64_t time_end_us,
+                                           float &value_min,
+                                           float &value_max)
+{
+    u_int32_t chunk_count = getChunkCount();
+
+    if (chunk_count == 0 || channel < 0 || channel >= RECORD_CHANNEL_COUNT ||
+        time_begin_us > time_end_us) {
+        return false;
+    }
+
+    u_int32_t low  = 0;
+    u_int32_t high = chunk_count;
+
+    while (low < high) {
+        u_int32_t middle = low + (high - low) / 2;
+
+        if (index_[middle].time_end_us < time_begin_us) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    u_int32_t range_begin = low;
+
+    high = chunk_count;
+
+    while (low < high) {
+        u_int32_t middle = low + (high - low) / 2;
+
+        if (index_[middle].time_begin_us <= time_end_us) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    u_int32_t range_end = low;
+
+    value_min =  FLT_MAX;
+    value_max = -FLT_MAX;
+
+    for (u_int32_t level = 0;
+         level < levels_.size() && range_begin < range_end; level++) {
+        const RecordSummaryEntry *summary = levels_[level];
+        const RecordSummaryEntry *entry   = 0;
+
+        if (range_begin & 1) {
+            entry = &summary[(range_begin++) * RECORD_CHANNEL_COUNT + channel];
+            value_min = (entry->value_min < value_min) ?
+                entry->value_min : value_min;
+            value_max = (entry->value_max > value_max) ?
+                entry->value_max : value_max;
+        }
+
+        if (range_end & 1) {
+            entry = &summary[(--range_end) * RECORD_CHANNEL_COUNT + channel];
+            value_min = (entry->value_min < value_min) ?
+                entry->value_min : value_min;
+            value_max = (entry->value_max > value_max) ?
+                entry->value_max : value_max;
+        }
+
+        range_begin >>= 1;
+        range_end   >>= 1;
+    }
+
+    return value_min <= value_max;
+}
+
+bool CommunicationRecordReader::checkRecord(void)
+{
+    header_  = (const RecordFileHeader *)map_data_;
+    trailer_ = (const RecordFileTrailer *)(map_data_ + map_size_ -
+                                           sizeof(RecordFileTrailer));
+
+    if (memcmp(header_->magic, RECORD_HEADER_MAGIC,
+               RECORD_MAGIC_LENGTH) != 0 ||
+        memcmp(trailer_->magic, RECORD_TRAILER_MAGIC,
+               RECORD_MAGIC_LENGTH) != 0 ||
+        header_->version != RECORD_VERSION ||
+        trailer_->channel_count != RECORD_CHANNEL_COUNT ||
+        trailer_->footer_offset % 8 != 0) {
+        return false;
+    }
+
+    u_int64_t footer_offset = trailer_->footer_offset;
+    u_int64_t footer_end    = footer_offset +
+        (u_int64_t)trailer_->chunk_count * sizeof(RecordIndexEntry);
+    u_int64_t level_size    = trailer_->chunk_count;
+
+    index_ = (const RecordIndexEntry *)(map_data_ + footer_offset);
+
+    for (u_int32_t i = 0; i < trailer_->level_count; i++) {
+        if (level_size == 0) {
+            return false;
+        }
+
+        levels_.push_back((const RecordSummaryEntry *)(map_data_ +
+                                                       footer_end));
+        footer_end += level_size * RECORD_CHANNEL_COUNT *
+            sizeof(RecordSummaryEntry);
+        level_size  = (level_size + 1) / 2;
+    }
+
+    if (footer_end != map_size_ - sizeof(RecordFileTrailer)) {
+        return false;
+    }
+
+    for (u_int32_t i = 0; i < trailer_->chunk_count; i++) {
+        if (index_[i].offset + index_[i].size > footer_offset) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,347 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .cpp file implements the class for recording received frames into
+ *  an indexed flight log.
+ **********************************************************************/
+
+#include <cfloat>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <communication_record_writer.h>
+
+CommunicationRecordWriter::CommunicationRecordWriter(void) :
+    flag_open_(false),
+    file_(0),
+    chunk_interval_ms_(1000),
+    file_offset_(0),
+    time_last_us_(0)
+{
+    memset(&chunk_entry_, 0, sizeof(chunk_entry_));
+}
+
+CommunicationRecordWriter::~CommunicationRecordWriter(void)
+{
+    closeRecord();
+}
+
+bool CommunicationRecordWriter::openRecord(const std::string &file_name,
+                                           u_int32_t chunk_interval_ms)
+{
+    if (flag_open_) {
+        closeRecord();
+    }
+
+    file_ = fopen(file_name.c_str(), "wb");
+
+    if (file_ == 0) {
+        std::cerr << "Failed to open record file " << file_name << "!"
+                  << std::endl;
+        return false;
+    }
+
+    chunk_interval_ms_ = (chunk_interval_ms > 0) ? chunk_interval_ms : 1000;
+    file_offset_       = 0;
+    time_last_us_      = 0;
+
+    chunk_buffer_.clear();
+    index_.clear();
+    summary_.clear();
+    memset(&chunk_entry_, 0, sizeof(chunk_entry_));
+
+    // The beginning time is unknown until the first frame arrives, so it is
+    // filled in when the record is closed.
+    RecordFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, RECORD_HEADER_MAGIC, RECORD_MAGIC_LENGTH);
+    header.version           = RECORD_VERSION;
+    header.channel_count     = RECORD_CHANNEL_COUNT;
+    header.chunk_interval_ms = chunk_interval_ms_;
+
+    flag_open_ = true;
+
+    if (!writeBytes(&header, sizeof(header))) {
+        closeRecord();
+        return false;
+    }
+
+    return true;
+}
+
+bool CommunicationRecordWriter::writeFrame(u_int64_t timestamp_us,
+                                           unsigned char command,
+                                           const unsigned char *data,
+                                           unsigned short length)
+{
+    if (!flag_open_) {
+        return false;
+    }
+
+    // Keep the timestamps monotonic, otherwise the index can't be searched.
+    if (timestamp_us < time_last_us_) {
+        timestamp_us = time_last_us_;
+    }
+
+    time_last_us_ = timestamp_us;
+
+    if (chunk_entry_.frame_count > 0 &&
+        timestamp_us >= chunk_entry_.time_begin_us +
+        (u_int64_t)chunk_interval_ms_ * 1000) {
+        if (!flushChunk()) {
+            return false;
+        }
+    }
+
+    if (chunk_entry_.frame_count == 0) {
+        chunk_entry_.time_begin_us = timestamp_us;
+
+        for (int i = 0; i < RECORD_CHANNEL_COUNT; i++) {
+            chunk_summary_[i].value_min =  FLT_MAX;
+            chunk_summary_[i].value_max = -FLT_MAX;
+        }
+    }
+
+    unsigned char frame_header[RECORD_FRAME_HEADER];
+    memcpy(frame_header, &timestamp_us, sizeof(timestamp_us));
+    frame_header[8] = command;
+    frame_header[9] = 0;
+    memcpy(frame_header + 10, &length, sizeof(length));
+
+    chunk_buffer_.insert(chunk_buffer_.end(), frame_header,
+                         frame_header + RECORD_FRAME_HEADER);
+
+    if (length > 0) {
+        chunk_buffer_.insert(chunk_buffer_.end(), data, data + length);
+    }
+
+    chunk_entry_.time_end_us = timestamp_us;
+    chunk_entry_.frame_count++;
+
+    updateSummary(command, data, length);
+
+    return true;
+}
+
+bool CommunicationRecordWriter::closeRecord(void)
+{
+    if (!flag_open_) {
+        return false;
+    }
+
+    bool result = flushChunk() && writeFooter() && writeTimeBegin();
+
+    if (fclose(file_) != 0) {
+        result = false;
+    }
+
+    if (!result) {
+        std::cerr << "Failed to finish record file!" << std::endl;
+    }
+
+    file_      = 0;
+    flag_open_ = false;
+
+    return result;
+}
+
+bool CommunicationRecordWriter::getFlagOpen(void)
+{
+    return flag_open_;
+}
+
+bool CommunicationRecordWriter::writeBytes(const void *data, u_int64_t length)
+{
+    if (length == 0) {
+        return true;
+    }
+
+    if (fwrite(data, 1, length, file_) != length) {
+        std::cerr << "Failed to write record file!" << std::endl;
+        return false;
+    }
+
+    file_offset_ += length;
+
+    return true;
+}
+
+bool CommunicationRecordWriter::flushChunk(void)
+{
+    if (chunk_entry_.frame_count == 0) {
+        return true;
+    }
+
+    chunk_entry_.offset = file_offset_;
+    chunk_entry_.size   = chunk_buffer_.size();
+
+    if (!writeBytes(&chunk_buffer_[0], chunk_buffer_.size())) {
+        return false;
+    }
+
+    index_.push_back(chunk_entry_);
+    summary_.insert(summary_.end(), chunk_summary_,
+                    chunk_summary_ + RECORD_CHANNEL_COUNT);
+
+    chunk_buffer_.clear();
+    memset(&chunk_entry_, 0, sizeof(chunk_entry_));
+
+    return true;
+}
+
+bool CommunicationRecordWriter::writeTimeBegin(void)
+{
+    if (index_.empty()) {
+        return true;
+    }
+
+    // Seeking back leaves file_offset_ alone, nothing is written afterwards.
+    if (fseek(file_, offsetof(RecordFileHeader, time_begin_us),
+              SEEK_SET) != 0 ||
+        fwrite(&index_[0].time_begin_us, sizeof(u_int64_t), 1, file_) != 1) {
+        std::cerr << "Failed to write record file!" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool CommunicationRecordWriter::writeFooter(void)
+{
+    static const unsigned char padding[8] = { 0 };
+
+    if (!writeBytes(padding, (8 - file_offset_ % 8) % 8)) {
+        return false;
+    }
+
+    RecordFileTrailer trailer;
+    memset(&trailer, 0, sizeof(trailer));
+    memcpy(trailer.magic, RECORD_TRAILER_MAGIC, RECORD_MAGIC_LENGTH);
+    trailer.footer_offset = file_offset_;
+    trailer.chunk_count   = index_.size();
+    trailer.channel_count = RECORD_CHANNEL_COUNT;
+    trailer.level_count   = 0;
+
+    if (!index_.empty() &&
+        !writeBytes(&index_[0], index_.size() * sizeof(RecordIndexEntry))) {
+        return false;
+    }
+
+    // Level 0 holds one summary per chunk, every upper level merges pairs of
+    // the level below until a single summary covers the whole flight.
+    std::vector<RecordSummaryEntry> level(summary_);
+    u_int32_t level_size = index_.size();
+
+    while (level_size > 0) {
+        if (!writeBytes(&level[0], level.size() * sizeof(RecordSummaryEntry))) {
+            return false;
+        }
+
+        trailer.level_count++;
+
+        if (level_size == 1) {
+            break;
+        }
+
+        u_int32_t upper_size = (level_size + 1) / 2;
+        std::vector<RecordSummaryEntry> upper(upper_size *
+                                              RECORD_CHANNEL_COUNT);
+
+        for (u_int32_t i = 0; i < upper_size; i++) {
+            for (int j = 0; j < RECORD_CHANNEL_COUNT; j++) {
+                RecordSummaryEntry &entry = upper[i * RECORD_CHANNEL_COUNT + j];
+                entry = level[(2 * i) * RECORD_CHANNEL_COUNT + j];
+
+                if (2 * i + 1 < level_size) {
+                    const RecordSummaryEntry &other =
+                        level[(2 * i + 1) * RECORD_CHANNEL_COUNT + j];
+
+                    if (other.value_min < entry.value_min) {
+                        entry.value_min = other.value_min;
+                    }
+
+                    if (other.value_max > entry.value_max) {
+                        entry.value_max = other.value_max;
+                    }
+                }
+            }
+        }
+
+        level.swap(upper);
+        level_size = upper_size;
+    }
+
+    if (!writeBytes(&trailer, sizeof(trailer))) {
+        return false;
+    }
+
+    return fflush(file_) == 0;
+}
+
+void CommunicationRecordWriter::updateSummary(unsigned char command,
+                                              const unsigned char *data,
+                                              unsigned short length)
+{
+    int channel_count = 0;
+    int channel_base  = getRecordChannelBase(command, &channel_count);
+
+    if (channel_base < 0 || length < channel_count * sizeof(float)) {
+        return ;
+    }
+
+    for (int i = 0; i < channel_count; i++) {
+        float value;
+        memcpy(&value, data + i * sizeof(float), sizeof(float));
+
+        if (value != value) {
+            continue;
+        }
+
+        RecordSummaryEntry &entry = chunk_summary_[channel_base + i];
+
+        if (value < entry.value_min) {
+            entry.value_min = value;
+        }
+
+        if (value > entry.value_max) {
+            entry.value_max = value;
+        }
+    }
+}
@@ -41,16 +41,22 @@
  *  This .cpp file implements serial communication operation base class.
  **********************************************************************/
 
+#include <boost/make_shared.hpp>
 #include <communication_port.h>
 
 namespace communication_serial {
 
 CommunicationPort::CommunicationPort(std::string comm_url) :
+    flag_init_(false),
     comm_url_(comm_url)
 {
     io_service_ = boost::make_shared<boost::asio::io_service>();
 }
 
+CommunicationPort::~CommunicationPort(void)
+{
+}
+
 bool CommunicationPort::getFlagInit(void)
 {
     return flag_init_;
@@ -42,18 +42,38 @@
  *  and interfaces for reading/writing serial port.
  **********************************************************************/
 
+#include <iostream>
+#include <boost/make_shared.hpp>
 #include <communication_serial_interface.h>
 
 namespace communication_serial {
 
 CommunicationSerialInterface::CommunicationSerialInterface(
     std::string serial_url,
-    std::string config_addr)
+    std::string config_addr) :
+    timeout_(500),
+    flag_timeout_(false),
+    flag_init_(false),
+    flag_ack_(false)
 {
     std::string serial_port_mode = serial_url.substr(0, serial_url.find("://"));
 
-    if (serial_port_mode == "serial") {
-        serial_port_ = boost::make_shared<CommunicationSerialPort>(serial_url);
+    for (int i = 0; i < LAST_COMMAND; i++) {
+        link_command_set_[i]         = 0;
+        link_command_set_current_[i] = 0;
+        link_command_frequency_[i]   = 0;
+        link_command_count_[i]       = 0;
+    }
+
+    if (serial_port_mode == "serial" || serial_port_mode == "udp") {
+        if (serial_port_mode == "serial") {
+            serial_port_ = boost::make_shared<CommunicationSerialPort>(
+                serial_url);
+        }
+        else {
+            serial_port_ = boost::make_shared<CommunicationUDPPort>(
+                serial_url);
+        }
         timeout_ = 500;
         serial_link_ = boost::make_shared<CommunicationLink>(0x01, 0x11,
                                                              &data_type_);
@@ -62,6 +82,8 @@ CommunicationSerialInterface::CommunicationSerialInterface(
                              boost::posix_time::milliseconds(timeout_)));
     }
     else {
+        std::cerr << "URL " << serial_url << " isn't supported!" << std::endl;
+        return ;
     }
 
     config_file_.open(config_addr.c_str(), std::fstream::in);
@@ -85,7 +107,7 @@ CommunicationSerialInterface::CommunicationSerialInterface(
 
 void CommunicationSerialInterface::checkShakeHandState(void)
 {
-    if (serial_link_->getReceiveState(SHAKE_HANDS)) {
+    if (!serial_link_->getReceiveState(SHAKE_HANDS)) {
         sendCommand(SHAKE_HANDS);
         std::cout << "Send shake hands command." << std::endl;
     }
@@ -103,26 +125,39 @@ bool CommunicationSerialInterface::updateCommandState(
     boost::asio::deadline_timer circle_timer_(*(serial_port_->getIOInstance()));
     circle_timer_.expires_from_now(boost::posix_time::milliseconds(timeout_));
 
-    if (!link_command_set_[command_state]) {
-        int cnt = count % 100;
-        if (cnt % (100 / link_command_frequency_[command_state]) == 0) {
-            sendCommand(command_state);
-        }
-        else {
-            return false;
-        }
+    // The count increases at 100Hz, so the frequency of command is divided
+    // from it.
+    if (!link_command_set_[command_state] ||
+        link_command_frequency_[command_state] <= 0) {
+        return false;
     }
 
+    int period = 100 / link_command_frequency_[command_state];
+
+    if (period > 0 && (count % 100) % period != 0) {
+        return false;
+    }
+
+    sendCommand(command_state);
+
     Buffer data = serial_port_->readBuffer();
     flag_ack_ = false;
 
     while (!flag_ack_) {
-        for (int i = 0; i < data.size(); i++) {
+        for (size_t i = 0; i < data.size(); i++) {
             if (serial_link_->analyseReceiveByte(data[i])) {
                 flag_ack_ = true;
+                if (receive_callback_) {
+                    receive_callback_(serial_link_->getReceiveCommand(),
+                                      serial_link_->getReceiveData(),
+                                      serial_link_->getReceiveLength());
+                }
             }
         }
         data = serial_port_->readBuffer();
+        if (data.empty() && !flag_ack_) {
+            boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+        }
         if (circle_timer_.expires_from_now().is_negative()) {
             std::cerr << "Timeout, skip this package!" << std::endl;
             return false;
@@ -142,6 +177,12 @@ CommunicationDataType *CommunicationSerialInterface::getDataType(void)
     return &data_type_;
 }
 
+void CommunicationSerialInterface::setReceiveCallback(
+    ReceiveCallback receive_callback)
+{
+    receive_callback_ = receive_callback;
+}
+
 void CommunicationSerialInterface::runTimeoutHandler(
     const boost::system::error_code &error_code)
 {
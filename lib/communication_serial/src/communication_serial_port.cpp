@@ -42,12 +42,14 @@
  **********************************************************************/
 
 #include <iostream>
+#include <boost/bind.hpp>
 #include <communication_serial_port.h>
 
 namespace communication_serial {
 
 CommunicationSerialPort::CommunicationSerialPort(void) :
-    CommunicationPort("serial:///dev/ttyUSB0")
+    CommunicationPort("serial:///dev/ttyUSB0"),
+    flag_write_(false)
 {
     serial_param_.port_ = "/dev/ttyUSB0";
 
@@ -62,7 +64,8 @@ CommunicationSerialPort::CommunicationSerialPort(void) :
 }
 
 CommunicationSerialPort::CommunicationSerialPort(std::string serial_url) :
-    CommunicationPort(serial_url)
+    CommunicationPort(serial_url),
+    flag_write_(false)
 {
     if (comm_url_.substr(0, comm_url_.find("://")) != "serial") {
         std::cerr << "URL is error!" << std::endl;
@@ -83,6 +86,15 @@ CommunicationSerialPort::CommunicationSerialPort(std::string serial_url) :
     }
 }
 
+CommunicationSerialPort::~CommunicationSerialPort(void)
+{
+    io_service_->stop();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
 Buffer CommunicationSerialPort::readBuffer(void)
 {
     boost::mutex::scoped_lock lock(mutex_read_);
@@ -120,14 +132,16 @@ void CommunicationSerialPort::startOneWrite(void)
 {
     boost::mutex::scoped_lock lock(mutex_port_);
 
-    if (!buffer_write_.empty()) {
+    // The front buffer must stay alive until its write is completed, and
+    // only one write may be in flight on the port.
+    if (!flag_write_ && !buffer_write_.empty()) {
+        flag_write_ = true;
         boost::asio::async_write(*serial_port_,
                                  boost::asio::buffer(buffer_write_.front()),
                                  boost::bind(
                                      &CommunicationSerialPort::runWriteHandler,
                                      this,
                                      boost::asio::placeholders::error));
-        buffer_write_.pop();
     }
 }
 
@@ -156,13 +170,19 @@ void CommunicationSerialPort::runReadHandler(
 void CommunicationSerialPort::runWriteHandler(
     const boost::system::error_code &error_code)
 {
+    boost::mutex::scoped_lock lock(mutex_write_);
+
+    {
+        boost::mutex::scoped_lock lock_port(mutex_port_);
+        buffer_write_.pop();
+        flag_write_ = false;
+    }
+
     if (error_code) {
         std::cerr << "Write serial port error!" << std::endl;
         return ;
     }
 
-    boost::mutex::scoped_lock lock(mutex_write_);
-
     if (!buffer_write_.empty()) {
         startOneWrite();
     }
@@ -171,8 +191,8 @@ void CommunicationSerialPort::runWriteHandler(
 bool CommunicationSerialPort::initializeSerialPort(void)
 {
     try {
-        serial_port_ = boost::make_shared<boost::asio::serial_port>(
-             boost::ref(*io_service_), serial_param_.port_);
+        serial_port_.reset(new boost::asio::serial_port(
+            *io_service_, serial_param_.port_));
         serial_port_->set_option(boost::asio::serial_port::baud_rate(
             serial_param_.baud_rate_));
         serial_port_->set_option(boost::asio::serial_port::flow_control(
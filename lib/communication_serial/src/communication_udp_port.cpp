@@ -0,0 +1,220 @@
+/***********************************************************************
+ *  Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2016, Team MicroDynamics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  * Neither the name of the Team MicroDynamics nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ ***********************************************************************
+
+ ***********************************************************************
+ *  History:
+ *  <Authors>        <Date>        <Operation>
+ *  myyerrol         2026.10.18    Create this file
+ *
+ *  Description:
+ *  This .cpp file implements UDP communication operation class.
+ **********************************************************************/
+
+#include <cstdlib>
+#include <iostream>
+#include <boost/bind.hpp>
+#include <communication_udp_port.h>
+
+namespace communication_serial {
+
+CommunicationUDPPort::CommunicationUDPPort(std::string udp_url) :
+    CommunicationPort(udp_url),
+    flag_write_(false)
+{
+    if (comm_url_.substr(0, comm_url_.find("://")) != "udp") {
+        std::cerr << "URL is error!" << std::endl;
+        return ;
+    }
+
+    if (!initializeUDPPort()) {
+        std::cerr << "Failed to initialize udp port!" << std::endl;
+        flag_init_ = false;
+    }
+    else {
+        std::cout << "Initialize udp port successfully!" << std::endl;
+        flag_init_ = true;
+    }
+}
+
+CommunicationUDPPort::~CommunicationUDPPort(void)
+{
+    io_service_->stop();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+Buffer CommunicationUDPPort::readBuffer(void)
+{
+    boost::mutex::scoped_lock lock(mutex_read_);
+    Buffer data;
+
+    if (!buffer_read_.empty()) {
+        data.swap(buffer_read_.front());
+        buffer_read_.pop();
+    }
+
+    return data;
+}
+
+void CommunicationUDPPort::writeBuffer(Buffer &data)
+{
+    boost::mutex::scoped_lock lock(mutex_write_);
+
+    buffer_write_.push(data);
+    startOneWrite();
+}
+
+void CommunicationUDPPort::startOneRead(void)
+{
+    boost::mutex::scoped_lock lock(mutex_port_);
+
+    udp_socket_->async_receive_from(
+        boost::asio::buffer(buffer_temp_), endpoint_sender_,
+        boost::bind(&CommunicationUDPPort::runReadHandler, this,
+                    boost::asio::placeholders::error,
+                    boost::asio::placeholders::bytes_transferred));
+}
+
+void CommunicationUDPPort::startOneWrite(void)
+{
+    boost::mutex::scoped_lock lock(mutex_port_);
+
+    if (!flag_write_ && !buffer_write_.empty()) {
+        flag_write_ = true;
+        udp_socket_->async_send_to(
+            boost::asio::buffer(buffer_write_.front()), endpoint_remote_,
+            boost::bind(&CommunicationUDPPort::runWriteHandler, this,
+                        boost::asio::placeholders::error));
+    }
+}
+
+void CommunicationUDPPort::runMainThread(void)
+{
+    std::cout << "Start thread to read/write udp port!" << std::endl;
+    startOneRead();
+    io_service_->run();
+}
+
+void CommunicationUDPPort::runReadHandler(
+    const boost::system::error_code &error_code,
+    u_int32_t trans_bytes)
+{
+    if (error_code == boost::asio::error::operation_aborted) {
+        return ;
+    }
+
+    // A refused datagram(nobody listening yet) only means the vehicle isn't
+    // up, so keep reading.
+    if (!error_code && endpoint_sender_ == endpoint_remote_) {
+        boost::mutex::scoped_lock lock(mutex_read_);
+        Buffer data(buffer_temp_.begin(), buffer_temp_.begin() + trans_bytes);
+        buffer_read_.push(data);
+    }
+
+    startOneRead();
+}
+
+void CommunicationUDPPort::runWriteHandler(
+    const boost::system::error_code &error_code)
+{
+    boost::mutex::scoped_lock lock(mutex_write_);
+
+    {
+        boost::mutex::scoped_lock lock_port(mutex_port_);
+        buffer_write_.pop();
+        flag_write_ = false;
+    }
+
+    if (error_code) {
+        std::cerr << "Write udp port error!" << std::endl;
+        return ;
+    }
+
+    if (!buffer_write_.empty()) {
+        startOneWrite();
+    }
+}
+
+bool CommunicationUDPPort::initializeUDPPort(void)
+{
+    std::string address = comm_url_.substr(comm_url_.find("://") + 3);
+    std::string port    = "20190";
+
+    if (address.find(':') != std::string::npos) {
+        port    = address.substr(address.find(':') + 1);
+        address = address.substr(0, address.find(':'));
+    }
+
+    try {
+        endpoint_remote_ = boost::asio::ip::udp::endpoint(
+            boost::asio::ip::address::from_string(address),
+            atoi(port.c_str()));
+        udp_socket_.reset(new boost::asio::ip::udp::socket(
+            *io_service_, boost::asio::ip::udp::endpoint(
+                endpoint_remote_.protocol(), 0)));
+    }
+    catch (std::exception &exce) {
+        std::cerr << "Failed to open udp port!" << std::endl;
+        std::cerr << "Error information: " << "(" << exce.what() << ")"
+                  << std::endl;
+        return false;
+    }
+
+    buffer_temp_.resize(1024);
+
+    try {
+        thread_ = boost::thread(boost::bind(
+                                    &CommunicationUDPPort::runMainThread,
+                                    this));
+    }
+    catch (std::exception &exce) {
+        std::cerr << "Failed to create udp port thread!" << std::endl;
+        std::cerr << "Error information: " << "(" << exce.what() << ")"
+                  << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+}
+
+#if !COMMUNICATION_UDP_PORT_LIB
+int main(void)
+{
+    return 0;
+}
+#endif
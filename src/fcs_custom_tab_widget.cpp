@@ -41,13 +41,119 @@
 
 #include <fcs_custom_tab_widget.h>
 #include <fcs_custom_tab_style.h>
+#include <qcustomplot.h>
+
+FCSCustomTabPlot::FCSCustomTabPlot(QCustomPlot *plot) :
+    QObject(plot),
+    tab_plot_(plot),
+    tab_paused_(false),
+    tab_pending_(false)
+{
+}
+
+FCSCustomTabPlot::~FCSCustomTabPlot()
+{
+}
+
+void FCSCustomTabPlot::pauseTabConsumer(void)
+{
+    tab_paused_ = true;
+}
+
+void FCSCustomTabPlot::resumeTabConsumer(void)
+{
+    tab_paused_ = false;
+
+    // Graphs kept all data added meanwhile, one replot shows it at once.
+    if (tab_pending_) {
+        tab_pending_ = false;
+        tab_plot_->replot(QCustomPlot::rpQueuedReplot);
+    }
+    else {
+        ;
+    }
+}
+
+void FCSCustomTabPlot::replotPlot(void)
+{
+    if (tab_paused_) {
+        tab_pending_ = true;
+    }
+    else {
+        tab_plot_->replot(QCustomPlot::rpQueuedReplot);
+    }
+}
 
 FCSCustomTabWidget::FCSCustomTabWidget(QWidget *parent) :
-    QTabWidget(parent)
+    QTabWidget(parent),
+    tab_current_(0)
 {
     this->tabBar()->setStyle(new FCSCustomTabStyle);
+
+    connect(this, SIGNAL(currentChanged(int)), this,
+            SLOT(switchTabConsumers(int)));
 }
 
 FCSCustomTabWidget::~FCSCustomTabWidget()
 {
+    // Pages are deleted by QWidget after this, removing them must not
+    // reach consumers anymore.
+    disconnect(this, SIGNAL(currentChanged(int)), this,
+               SLOT(switchTabConsumers(int)));
+}
+
+void FCSCustomTabWidget::registerTabConsumer(QWidget *tab,
+                                             FCSCustomTabConsumer *consumer)
+{
+    tab_consumers_.insert(tab, consumer);
+
+    if (tab != currentWidget()) {
+        consumer->pauseTabConsumer();
+    }
+    else {
+        ;
+    }
+}
+
+void FCSCustomTabWidget::unregisterTabConsumer(
+    FCSCustomTabConsumer *consumer)
+{
+    QMutableHashIterator<QWidget *, FCSCustomTabConsumer *> it(
+        tab_consumers_);
+
+    while (it.hasNext()) {
+        if (it.next().value() == consumer) {
+            it.remove();
+        }
+        else {
+            ;
+        }
+    }
+}
+
+void FCSCustomTabWidget::switchTabConsumers(int index)
+{
+    QWidget *tab = widget(index);
+
+    if (tab == tab_current_) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    QList<FCSCustomTabConsumer *> consumers = tab_consumers_.values(
+        tab_current_);
+
+    for (int i = 0; i < consumers.size(); i++) {
+        consumers[i]->pauseTabConsumer();
+    }
+
+    consumers = tab_consumers_.values(tab);
+
+    for (int i = 0; i < consumers.size(); i++) {
+        consumers[i]->resumeTabConsumer();
+    }
+
+    tab_current_ = tab;
 }
@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_indicator.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.19     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements the base of indicators, which coalesces
+ * repaints on the render clock and keys the cached layers.
+ *****************************************************************************/
+
+#include <QtMath>
+#include <fcs_indicator.h>
+#include <fcs_instrucment_render_clock.h>
+
+FlightIndicator::FlightIndicator(QWidget *parent) :
+    QWidget(parent)
+{
+    layer_ratio_  = 0.0;
+    layer_size_   = 0;
+    canvas_dirty_ = false;
+
+    connect(FCSInstrucmentRenderClock::getInstance(), SIGNAL(frameTicked()),
+            this, SLOT(updateCanvas()));
+}
+
+FlightIndicator::~FlightIndicator()
+{
+}
+
+void FlightIndicator::updateCanvas(void)
+{
+    if (canvas_dirty_) {
+        canvas_dirty_ = false;
+        update();
+    }
+    else {
+        ;
+    }
+}
+
+void FlightIndicator::checkLayers(int size)
+{
+    // Layers are keyed by size and pixel ratio, the later changes when the
+    // widget moves to another screen without resizing.
+    if (layer_size_ != size || layer_ratio_ != devicePixelRatioF()) {
+        layer_size_  = size;
+        layer_ratio_ = devicePixelRatioF();
+        initLayers();
+    }
+    else {
+        ;
+    }
+}
+
+void FlightIndicator::requestCanvas(void)
+{
+    // Setters only mark state, a burst of telemetry between two frames
+    // costs one repaint.
+    canvas_dirty_ = true;
+    FCSInstrucmentRenderClock::getInstance()->requestFrame();
+}
+
+QPixmap FlightIndicator::createLayer(int width, int height)
+{
+    QPixmap layer(qCeil(width * layer_ratio_), qCeil(height * layer_ratio_));
+
+    layer.setDevicePixelRatio(layer_ratio_);
+    layer.fill(Qt::transparent);
+
+    return layer;
+}
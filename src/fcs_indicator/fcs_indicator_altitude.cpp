@@ -47,9 +47,10 @@
 #include <QtMath>
 #include <QDebug>
 #include <fcs_indicator_altitude.h>
+#include <fcs_instrucment_profiler.h>
 
 FlightAltitudeIndicator::FlightAltitudeIndicator(QWidget *parent) :
-    QWidget(parent)
+    FlightIndicator(parent)
 {
     widget_size_min_    = 200;
     widget_size_max_    = 600;
@@ -64,8 +65,6 @@ FlightAltitudeIndicator::FlightAltitudeIndicator(QWidget *parent) :
 
     altitude_ = 0.0;
     height_   = 0.0;
-
-    connect(this, SIGNAL(replotCanvas(void)), this, SLOT(updateCanvas(void)));
 }
 
 FlightAltitudeIndicator::~FlightAltitudeIndicator()
@@ -77,19 +76,19 @@ void FlightAltitudeIndicator::setAltitudeAndHeight(double altitude,
 {
     altitude_ = altitude;
     height_   = height;
-    emit replotCanvas();
+    requestCanvas();
 }
 
 void FlightAltitudeIndicator::setAltitude(double altitude)
 {
     altitude_ = altitude;
-    emit replotCanvas();
+    requestCanvas();
 }
 
 void FlightAltitudeIndicator::setHeight(double height)
 {
     height_ = height;
-    emit replotCanvas();
+    requestCanvas();
 }
 
 double FlightAltitudeIndicator::getAltitude(void)
@@ -102,34 +101,139 @@ double FlightAltitudeIndicator::getHeight(void)
     return height_;
 }
 
-void FlightAltitudeIndicator::updateCanvas(void)
+void FlightAltitudeIndicator::paintEvent(QPaintEvent *)
+{
+    FCS_INSTRUCMENT_PROFILE("altitude paint");
+
+    checkLayers(widget_size_curr_);
+
+    QPainter painter(this);
+    QPen pen_black(Qt::black);
+
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    painter.translate(width() / 2, height() / 2);
+
+    // Draw the background's color, numbers and lines.
+    do {
+        painter.drawPixmap(QPointF(-layer_dial_.width()  / layer_ratio_ / 2,
+                                   -layer_dial_.height() / layer_ratio_ / 2),
+                           layer_dial_);
+    } while (false);
+
+    // Draw the arrow.
+    do {
+        painter.rotate(-100 * altitude_);
+        painter.drawPixmap(QPointF(-layer_arrow_.width()  / layer_ratio_ / 2,
+                                   -layer_arrow_.height() / layer_ratio_ / 2),
+                           layer_arrow_);
+        painter.rotate(100 * altitude_);
+    } while (false);
+
+    // Draw the text and the frame of altitude and height.
+    do {
+        painter.drawPixmap(
+            QPointF(-layer_readout_.width()  / layer_ratio_ / 2,
+                    -layer_readout_.height() / layer_ratio_ / 2),
+            layer_readout_);
+    } while (false);
+
+    // Draw the altitude and height.
+    do {
+        int     font_size = 15;
+        int     fx, fy, width, height;
+        QString string;
+
+        width  = 120;
+        height = (font_size + 10) * 2;
+        fx     = - width  / 2;
+        fy     = - height / 2;
+
+        painter.setPen(pen_black);
+        painter.setFont(QFont("", font_size));
+
+        if (altitude_ >= 9.99) {
+            altitude_ = 9.99;
+        }
+        if (altitude_ <= -9.99) {
+            altitude_ = -9.99;
+        }
+        if (height_ >= 9.99) {
+            height_ = 9.99;
+        }
+        if (height_ <= -9.99) {
+            height_ = -9.99;
+        }
+
+        string.sprintf("ALT: %.2lf m", altitude_);
+        painter.drawText(QRectF(fx, fy + 2, width, height / 2),
+                         Qt::AlignCenter, string);
+
+        string.sprintf("HEI: %.2lf m", height_);
+        painter.drawText(QRectF(fx, fy + height / 2, width, height / 2),
+                         Qt::AlignCenter, string);
+    } while (false);
+}
+
+void FlightAltitudeIndicator::resizeEvent(QResizeEvent *)
 {
+    widget_size_curr_ = qMin(width(), height()) - 2 * widget_size_offset_;
+
+    checkLayers(widget_size_curr_);
+}
+
+void FlightAltitudeIndicator::keyPressEvent(QKeyEvent *event)
+{
+    switch (event->key()) {
+        case Qt::Key_U: {
+            altitude_ += VALUE_STEP_ALTITUDE;
+            break;
+        }
+        case Qt::Key_I: {
+            altitude_ -= VALUE_STEP_ALTITUDE;
+            break;
+        }
+        case Qt::Key_J: {
+            height_ += VALUE_STEP_HEIGHT;
+            break;
+        }
+        case Qt::Key_K: {
+            height_ -= VALUE_STEP_HEIGHT;
+            break;
+        }
+        default: {
+            FlightIndicator::keyPressEvent(event);
+            break;
+        }
+    }
+
     update();
 }
 
-void FlightAltitudeIndicator::paintEvent(QPaintEvent *)
+void FlightAltitudeIndicator::initLayers(void)
 {
-    QPainter painter(this);
-    QPen pen_black(Qt::black);
+    int    layer_side = widget_size_curr_ + 2 * widget_size_offset_;
+    QPen   pen_black(Qt::black);
     QBrush brush_sky(QColor(48, 172, 220));
 
     pen_black.setWidth(2);
 
-    painter.setRenderHint(QPainter::Antialiasing);
-    painter.translate(width() / 2, height() / 2);
-
-    // Draw the background's color.
+    // Draw the background's color, numbers and lines.
     do {
+        layer_dial_ = createLayer(layer_side, layer_side);
+
+        QPainter painter(&layer_dial_);
+
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.translate(layer_side / 2.0, layer_side / 2.0);
+
         painter.setPen(pen_black);
         painter.setBrush(brush_sky);
         painter.drawEllipse(-widget_size_curr_ / 2,
                             -widget_size_curr_ / 2,
                              widget_size_curr_,
                              widget_size_curr_);
-    } while (false);
 
-    // Draw the background's numbers and lines.
-    do {
         int     yaw_line_number = 36;
         int     yaw_line_length = widget_size_curr_ / 25;
         int     font_size       = 10;
@@ -137,8 +241,6 @@ void FlightAltitudeIndicator::paintEvent(QPaintEvent *)
         double  fx_a, fx_b, fy_a, fy_b;
         QString string;
 
-        pen_black.setWidth(2);
-        painter.setPen(pen_black);
         painter.setFont(QFont("", font_size));
 
         for (int i = 0; i < yaw_line_number; i++) {
@@ -164,12 +266,18 @@ void FlightAltitudeIndicator::paintEvent(QPaintEvent *)
         }
     } while (false);
 
-    // Draw the arrow.
+    // Draw the arrow, it turns with altitude.
     do {
+        layer_arrow_ = createLayer(layer_side, layer_side);
+
+        QPainter painter(&layer_arrow_);
+
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.translate(layer_side / 2.0, layer_side / 2.0);
+
         int    arrow_size = widget_size_curr_ / 12;
         double fx_a, fx_b, fx_c, fy_a, fy_b, fy_c;
 
-        painter.rotate(-100 * altitude_);
         painter.setPen(Qt::NoPen);
         painter.setBrush(QBrush(QColor(Qt::red)));
 
@@ -187,12 +295,20 @@ void FlightAltitudeIndicator::paintEvent(QPaintEvent *)
         };
 
         painter.drawPolygon(points, 3);
-        painter.rotate(100 * altitude_);
     } while (false);
 
-    // Draw the text.
+    // Draw the text and the frame of altitude and height, only the values
+    // inside are painted per frame.
     do {
+        layer_readout_ = createLayer(layer_side, layer_side);
+
+        QPainter painter(&layer_readout_);
+
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.translate(layer_side / 2.0, layer_side / 2.0);
+
         int    font_size = 15;
+        int    fx, fy, width, height;
         double fx_a, fy_a;
 
         fx_a = -50;
@@ -203,77 +319,13 @@ void FlightAltitudeIndicator::paintEvent(QPaintEvent *)
         painter.setFont(QFont("", font_size));
         painter.drawText(QRectF(fx_a, fy_a, 100, font_size + 5),
                          Qt::AlignCenter, "x 0.1m");
-    } while (false);
-
-    // Draw the altitude and height.
-    do {
-        int     font_size = 15;
-        int     fx, fy, width, height;
-        QString string;
 
         width  = 120;
         height = (font_size + 10) * 2;
         fx     = - width  / 2;
         fy     = - height / 2;
 
-        pen_black.setWidth(2);
-        painter.setPen(pen_black);
         painter.setBrush(QBrush(Qt::white));
-        painter.setFont(QFont("", font_size));
         painter.drawRect(fx, fy, width, height);
-
-        if (altitude_ >= 9.99) {
-            altitude_ = 9.99;
-        }
-        if (altitude_ <= -9.99) {
-            altitude_ = -9.99;
-        }
-        if (height_ >= 9.99) {
-            height_ = 9.99;
-        }
-        if (height_ <= -9.99) {
-            height_ = -9.99;
-        }
-
-        string.sprintf("ALT: %.2lf m", altitude_);
-        painter.drawText(QRectF(fx, fy + 2, width, height / 2),
-                         Qt::AlignCenter, string);
-
-        string.sprintf("HEI: %.2lf m", height_);
-        painter.drawText(QRectF(fx, fy + height / 2, width, height / 2),
-                         Qt::AlignCenter, string);
     } while (false);
 }
-
-void FlightAltitudeIndicator::resizeEvent(QResizeEvent *)
-{
-    widget_size_curr_ = qMin(width(), height()) - 2 * widget_size_offset_;
-}
-
-void FlightAltitudeIndicator::keyPressEvent(QKeyEvent *event)
-{
-    switch (event->key()) {
-        case Qt::Key_U: {
-            altitude_ += VALUE_STEP_ALTITUDE;
-            break;
-        }
-        case Qt::Key_I: {
-            altitude_ -= VALUE_STEP_ALTITUDE;
-            break;
-        }
-        case Qt::Key_J: {
-            height_ += VALUE_STEP_HEIGHT;
-            break;
-        }
-        case Qt::Key_K: {
-            height_ -= VALUE_STEP_HEIGHT;
-            break;
-        }
-        default: {
-            QWidget::keyPressEvent(event);
-            break;
-        }
-    }
-
-    update();
-}
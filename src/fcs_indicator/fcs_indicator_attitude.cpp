@@ -46,9 +46,10 @@
 #include <QRegion>
 #include <QtMath>
 #include <fcs_indicator_attitude.h>
+#include <fcs_instrucment_profiler.h>
 
 FlightAttitudeIndicator::FlightAttitudeIndicator(QWidget *parent) :
-    QWidget(parent)
+    FlightIndicator(parent)
 {
     widget_size_min_    = 200;
     widget_size_max_    = 600;
@@ -63,8 +64,6 @@ FlightAttitudeIndicator::FlightAttitudeIndicator(QWidget *parent) :
 
     pitch_ = 0.0;
     roll_  = 0.0;
-
-    connect(this, SIGNAL(replotCanvas(void)), this, SLOT(updateCanvas(void)));
 }
 
 FlightAttitudeIndicator::~FlightAttitudeIndicator()
@@ -89,7 +88,7 @@ void FlightAttitudeIndicator::setPitchAndRoll(double pitch, double roll)
         roll_ = 180;
     }
 
-    emit replotCanvas();
+    requestCanvas();
 }
 
 void FlightAttitudeIndicator::setPitch(double pitch)
@@ -103,7 +102,7 @@ void FlightAttitudeIndicator::setPitch(double pitch)
         pitch_ = 90;
     }
 
-    emit replotCanvas();
+    requestCanvas();
 }
 
 void FlightAttitudeIndicator::setRoll(double roll)
@@ -117,7 +116,7 @@ void FlightAttitudeIndicator::setRoll(double roll)
         roll_ = 180;
     }
 
-    emit replotCanvas();
+    requestCanvas();
 }
 
 double FlightAttitudeIndicator::getPitch(void)
@@ -130,26 +129,21 @@ double FlightAttitudeIndicator::getRoll(void)
     return roll_;
 }
 
-void FlightAttitudeIndicator::updateCanvas(void)
-{
-    update();
-}
-
 void FlightAttitudeIndicator::paintEvent(QPaintEvent *)
 {
+    FCS_INSTRUCMENT_PROFILE("attitude paint");
+
+    checkLayers(widget_size_curr_);
+
     QPainter painter(this);
     QBrush   brush_key(QColor(48, 172, 220));
     QBrush   brush_ground(QColor(247, 168, 21));
-    QPen     pen_white(Qt::white);
     QPen     pen_black(Qt::black);
-    QPen     pen_pitch(Qt::white);
-    QPen     pen_pitch_zero(Qt::green);
 
-    pen_white.setWidth(2);
     pen_black.setWidth(2);
-    pen_pitch_zero.setWidth(3);
 
     painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
     painter.translate(width() / 2, height() / 2);
     painter.rotate(roll_);
 
@@ -200,7 +194,82 @@ void FlightAttitudeIndicator::paintEvent(QPaintEvent *)
                          QRegion::Ellipse);
     painter.setClipRegion(mask_region);
 
-    // Draw the pitch's lines and marker.
+    // Draw the pitch's lines, the ladder only slides along the rolled axis.
+    do {
+        double y = widget_size_curr_ / 2 * -pitch_temp_ / 45.0;
+
+        painter.drawPixmap(QPointF(-layer_ladder_.width()  / layer_ratio_ / 2,
+                                   -layer_ladder_.height() / layer_ratio_ / 2 +
+                                    y), layer_ladder_);
+    } while (false);
+
+    // Draw the roll's degree lines and pitch's marker.
+    do {
+        painter.drawPixmap(QPointF(-layer_dial_.width()  / layer_ratio_ / 2,
+                                   -layer_dial_.height() / layer_ratio_ / 2),
+                           layer_dial_);
+    } while (false);
+
+    // Draw the roll's marker.
+    do {
+        painter.rotate(-roll_);
+        painter.drawPixmap(QPointF(-layer_marker_.width()  / layer_ratio_ / 2,
+                                   -layer_marker_.height() / layer_ratio_ / 2),
+                           layer_marker_);
+    } while (false);
+}
+
+void FlightAttitudeIndicator::resizeEvent(QResizeEvent *)
+{
+    widget_size_curr_ = qMin(width(), height()) - 2 * widget_size_offset_;
+
+    checkLayers(widget_size_curr_);
+}
+
+void FlightAttitudeIndicator::keyPressEvent(QKeyEvent *event)
+{
+    switch (event->key()) {
+        case Qt::Key_W: {
+            if (pitch_ < 90) {
+                pitch_ += VALUE_STEP_ATTITUDE;
+            }
+            break;
+        }
+        case Qt::Key_S: {
+            if (pitch_ > -90) {
+                pitch_ -= VALUE_STEP_ATTITUDE;
+            }
+            break;
+        }
+        case Qt::Key_A: {
+            roll_ -= VALUE_STEP_ATTITUDE;
+            break;
+        }
+        case Qt::Key_D: {
+            roll_ += VALUE_STEP_ATTITUDE;
+            break;
+        }
+        default: {
+            FlightIndicator::keyPressEvent(event);
+            break;
+        }
+    }
+
+    update();
+}
+
+void FlightAttitudeIndicator::initLayers(void)
+{
+    int  layer_side = widget_size_curr_ + 2 * widget_size_offset_;
+    QPen pen_black(Qt::black);
+    QPen pen_pitch(Qt::white);
+    QPen pen_pitch_zero(Qt::green);
+
+    pen_black.setWidth(2);
+    pen_pitch_zero.setWidth(3);
+
+    // Draw the pitch's lines from -90 to 90 degrees, the ladder is twice as
+    // tall as the dial and clipped by it when painted.
     do {
         int     x_a, y_a, x_b, y_b;
         int     text_width;
@@ -208,13 +277,20 @@ void FlightAttitudeIndicator::paintEvent(QPaintEvent *)
         int     line_long = widget_size_curr_ / 8;
         int     font_size = 10;
         double  pitch;
-        double  chord_length;
         QString string;
 
+        layer_ladder_ = createLayer(layer_side,
+                                    2 * widget_size_curr_ + 4 * font_size);
+
+        QPainter painter(&layer_ladder_);
+
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.translate(layer_side / 2.0,
+                          widget_size_curr_ + 2 * font_size);
+
         pen_pitch.setWidth(2);
         painter.setFont(QFont("", font_size));
 
-        // Draw the pitch's lines.
         for (int i = -9; i <= 9; i++) {
             pitch = i * 10;
             string = QString("%1").arg(-pitch);
@@ -233,14 +309,8 @@ void FlightAttitudeIndicator::paintEvent(QPaintEvent *)
                 painter.setPen(pen_pitch);
             }
 
-            y_a = widget_size_curr_ / 2 * pitch       / 45.0 -
-                  widget_size_curr_ / 2 * pitch_temp_ / 45.0;
+            y_a = widget_size_curr_ / 2 * pitch / 45.0;
             x_a = line_short;
-            chord_length = qSqrt(x_a * x_a + y_a * y_a);
-
-            if (chord_length > widget_size_curr_ / 2) {
-                continue;
-            }
 
             painter.drawLine(QPointF(-line_short, 1.0 * y_a),
                              QPointF(+line_short, 1.0 * y_a));
@@ -254,8 +324,17 @@ void FlightAttitudeIndicator::paintEvent(QPaintEvent *)
                                  Qt::AlignRight | Qt::AlignVCenter, string);
             }
         }
+    } while (false);
+
+    // Draw the roll's degree lines and pitch's marker, both turn with roll.
+    do {
+        layer_dial_ = createLayer(layer_side, layer_side);
+
+        QPainter painter(&layer_dial_);
+
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.translate(layer_side / 2.0, layer_side / 2.0);
 
-        // Draw the marker.
         int    marker_size = widget_size_curr_ / 20;
         double fx_a, fx_b, fx_c, fy_a, fy_b, fy_c;
 
@@ -284,18 +363,13 @@ void FlightAttitudeIndicator::paintEvent(QPaintEvent *)
         };
 
         painter.drawPolygon(points_b, 3);
-    } while (false);
 
-    // Draw the roll's degree lines.
-    do {
         int     roll_line_number = 36;
         int     roll_line_length = widget_size_curr_ / 25;
         int     font_size        = 10;
         double  unit_angular     = 360.0 / roll_line_number;
-        double  fx_a, fx_b, fy_a, fy_b;
         QString string;
 
-        pen_black.setWidth(2);
         painter.setPen(pen_black);
         painter.setFont(QFont("", font_size));
 
@@ -327,12 +401,19 @@ void FlightAttitudeIndicator::paintEvent(QPaintEvent *)
         }
     } while (false);
 
-    // Draw the roll's marker.
+    // Draw the roll's marker, it stays upright.
     do {
+        layer_marker_ = createLayer(layer_side, layer_side);
+
+        QPainter painter(&layer_marker_);
+
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.translate(layer_side / 2.0, layer_side / 2.0);
+
         int    roll_marker_size = widget_size_curr_ / 25;
         double fx_a, fx_b, fx_c, fy_a, fy_b, fy_c;
 
-        painter.rotate(-roll_);
+        painter.setPen(pen_black);
         painter.setBrush(QBrush(Qt::black));
 
         fx_a = 0;
@@ -351,40 +432,3 @@ void FlightAttitudeIndicator::paintEvent(QPaintEvent *)
         painter.drawPolygon(points, 3);
     } while (false);
 }
-
-void FlightAttitudeIndicator::resizeEvent(QResizeEvent *)
-{
-    widget_size_curr_ = qMin(width(), height()) - 2 * widget_size_offset_;
-}
-
-void FlightAttitudeIndicator::keyPressEvent(QKeyEvent *event)
-{
-    switch (event->key()) {
-        case Qt::Key_W: {
-            if (pitch_ < 90) {
-                pitch_ += VALUE_STEP_ATTITUDE;
-            }
-            break;
-        }
-        case Qt::Key_S: {
-            if (pitch_ > -90) {
-                pitch_ -= VALUE_STEP_ATTITUDE;
-            }
-            break;
-        }
-        case Qt::Key_A: {
-            roll_ -= VALUE_STEP_ATTITUDE;
-            break;
-        }
-        case Qt::Key_D: {
-            roll_ += VALUE_STEP_ATTITUDE;
-            break;
-        }
-        default: {
-            QWidget::keyPressEvent(event);
-            break;
-        }
-    }
-
-    update();
-}
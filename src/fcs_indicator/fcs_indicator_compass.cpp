@@ -47,9 +47,10 @@
 #include <QtMath>
 #include <QDebug>
 #include <fcs_indicator_compass.h>
+#include <fcs_instrucment_profiler.h>
 
 FlightCompassIndicator::FlightCompassIndicator(QWidget *parent) :
-    QWidget(parent)
+    FlightIndicator(parent)
 {
     widget_size_min_    = 200;
     widget_size_max_    = 600;
@@ -63,8 +64,6 @@ FlightCompassIndicator::FlightCompassIndicator(QWidget *parent) :
     setFocusPolicy(Qt::NoFocus);
 
     yaw_ = 0.0;
-
-    connect(this, SIGNAL(replotCanvas(void)), this, SLOT(updateCanvas(void)));
 }
 
 FlightCompassIndicator::~FlightCompassIndicator()
@@ -82,7 +81,7 @@ void FlightCompassIndicator::setYaw(double yaw)
         yaw_ = yaw_ - 360;
     }
 
-    emit replotCanvas();
+    requestCanvas();
 }
 
 double FlightCompassIndicator::getYaw()
@@ -90,65 +89,117 @@ double FlightCompassIndicator::getYaw()
     return yaw_;
 }
 
-void FlightCompassIndicator::updateCanvas(void)
+void FlightCompassIndicator::paintEvent(QPaintEvent *)
+{
+    FCS_INSTRUCMENT_PROFILE("compass paint");
+
+    checkLayers(widget_size_curr_);
+
+    QPainter painter(this);
+
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    painter.translate(width() / 2, height() / 2);
+
+    // Draw the background's color, numbers and lines.
+    do {
+        painter.rotate(-yaw_);
+        painter.drawPixmap(QPointF(-layer_dial_.width()  / layer_ratio_ / 2,
+                                   -layer_dial_.height() / layer_ratio_ / 2),
+                           layer_dial_);
+        painter.rotate(yaw_);
+    } while (false);
+
+    // Draw the quadrotor and arrow.
+    do {
+        painter.drawPixmap(
+            QPointF(-layer_quadrotor_.width()  / layer_ratio_ / 2,
+                    -layer_quadrotor_.height() / layer_ratio_ / 2),
+            layer_quadrotor_);
+    } while (false);
+}
+
+void FlightCompassIndicator::resizeEvent(QResizeEvent *)
+{
+    widget_size_curr_ = qMin(width(), height()) - 2 * widget_size_offset_;
+
+    checkLayers(widget_size_curr_);
+}
+
+void FlightCompassIndicator::keyPressEvent(QKeyEvent *event)
 {
+    switch (event->key()) {
+        case Qt::Key_Q: {
+            yaw_ -= VALUE_STEP_COMPASS;
+            break;
+        }
+        case Qt::Key_E: {
+            yaw_ += VALUE_STEP_COMPASS;
+            break;
+        }
+        default: {
+            FlightIndicator::keyPressEvent(event);
+            break;
+        }
+    }
+
     update();
 }
 
-void FlightCompassIndicator::paintEvent(QPaintEvent *)
+void FlightCompassIndicator::initLayers(void)
 {
-    QPainter painter(this);
-    QPen pen_black(Qt::black);
+    int    layer_side = widget_size_curr_ + 2 * widget_size_offset_;
+    QPen   pen_black(Qt::black);
     QBrush brush_sky(QColor(48, 172, 220));
 
     pen_black.setWidth(2);
 
-    painter.setRenderHint(QPainter::Antialiasing);
-    painter.translate(width() / 2, height() / 2);
-
-    // Draw the background's color.
+    // Draw the background's color, numbers and lines, the dial turns with
+    // yaw as a whole.
     do {
+        layer_dial_ = createLayer(layer_side, layer_side);
+
+        QPainter painter(&layer_dial_);
+
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.translate(layer_side / 2.0, layer_side / 2.0);
+
         painter.setPen(pen_black);
         painter.setBrush(brush_sky);
         painter.drawEllipse(-widget_size_curr_ / 2,
                             -widget_size_curr_ / 2,
                              widget_size_curr_,
                              widget_size_curr_);
-    } while (false);
 
-    // Draw the background's numbers and lines.
-    do {
         int     yaw_line_number = 36;
         int     yaw_line_length = widget_size_curr_ / 25;
         int     font_size       = 10;
         double  unit_angular    = 360.0 / yaw_line_number;
         double  fx_a, fx_b, fy_a, fy_b;
+        QFont   font_cardinal("Monospace", font_size * 1.2);
+        QFont   font_number("", font_size);
         QString string;
 
-        pen_black.setWidth(2);
-        painter.setPen(pen_black);
-        painter.rotate(-yaw_);
-
         for (int i = 0; i < yaw_line_number; i++) {
             if (i == 0) {
                 string = "N";
-                painter.setFont(QFont("Monospace", font_size * 1.2));
+                painter.setFont(font_cardinal);
             }
             else if (i == 9) {
                 string = "W";
-                painter.setFont(QFont("Monospace", font_size * 1.2));
+                painter.setFont(font_cardinal);
             }
             else if (i == 18) {
                 string = "S";
-                painter.setFont(QFont("Monospace", font_size * 1.2));
+                painter.setFont(font_cardinal);
             }
             else if (i == 27) {
                 string = "E";
-                painter.setFont(QFont("Monospace", font_size * 1.2));
+                painter.setFont(font_cardinal);
             }
             else {
                 string = QString("%1").arg(i * unit_angular);
-                painter.setFont(QFont("", font_size));
+                painter.setFont(font_number);
             }
 
             fx_a = 0.0;
@@ -169,12 +220,17 @@ void FlightCompassIndicator::paintEvent(QPaintEvent *)
 
             painter.rotate(-unit_angular);
         }
-
-        painter.rotate(yaw_);
     } while (false);
 
-    // Draw the quadrotor.
+    // Draw the quadrotor and arrow, both stay upright.
     do {
+        layer_quadrotor_ = createLayer(layer_side, layer_side);
+
+        QPainter painter(&layer_quadrotor_);
+
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.translate(layer_side / 2.0, layer_side / 2.0);
+
         double quadrotor_body_size    = widget_size_curr_ / 10;
         double quadrotor_motor_radius = quadrotor_body_size;
         double quadrotor_motor_point  = quadrotor_body_size * 1.5;
@@ -234,10 +290,7 @@ void FlightCompassIndicator::paintEvent(QPaintEvent *)
                                    quadrotor_motor_radius,
                                    quadrotor_motor_radius * 2,
                                    quadrotor_motor_radius * 2));
-    } while (false);
 
-    // Draw the arrow.
-    do {
         int    arrow_size = widget_size_curr_ / 12;
         double fx_a, fx_b, fx_c, fy_a, fy_b, fy_c;
 
@@ -260,28 +313,3 @@ void FlightCompassIndicator::paintEvent(QPaintEvent *)
         painter.drawPolygon(points, 3);
     } while (false);
 }
-
-void FlightCompassIndicator::resizeEvent(QResizeEvent *)
-{
-    widget_size_curr_ = qMin(width(), height()) - 2 * widget_size_offset_;
-}
-
-void FlightCompassIndicator::keyPressEvent(QKeyEvent *event)
-{
-    switch (event->key()) {
-        case Qt::Key_Q: {
-            yaw_ -= VALUE_STEP_COMPASS;
-            break;
-        }
-        case Qt::Key_E: {
-            yaw_ += VALUE_STEP_COMPASS;
-            break;
-        }
-        default: {
-            QWidget::keyPressEvent(event);
-            break;
-        }
-    }
-
-    update();
-}
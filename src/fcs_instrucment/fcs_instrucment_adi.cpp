@@ -42,7 +42,7 @@
 #include <fcs_instrucment_adi.h>
 
 FCSInstrucmentADI::FCSInstrucmentADI(QWidget *parent) :
-    QGraphicsView(parent),
+    FCSInstrucmentView("adi paint", parent),
     adi_scene_(0),
     adi_item_back_(0),
     adi_item_face_(0),
@@ -71,9 +71,8 @@ FCSInstrucmentADI::FCSInstrucmentADI(QWidget *parent) :
 
     setScene(adi_scene_);
 
-    adi_scene_->clear();
-
-    initADI();
+    connect(FCSInstrucmentRenderClock::getInstance(), SIGNAL(frameTicked()),
+            this, SLOT(updateADI()));
 }
 
 FCSInstrucmentADI::~FCSInstrucmentADI()
@@ -92,7 +91,7 @@ FCSInstrucmentADI::~FCSInstrucmentADI()
 
 void FCSInstrucmentADI::reinitADI(void)
 {
-    if (adi_scene_) {
+    if (adi_scene_ && isInstrucmentBuilt()) {
         adi_scene_->clear();
         initADI();
     }
@@ -103,6 +102,13 @@ void FCSInstrucmentADI::reinitADI(void)
 
 void FCSInstrucmentADI::updateADI(void)
 {
+    if (isViewFrozen()) {
+        return ;
+    }
+    else {
+        ;
+    }
+
     updateADIView();
 
     adi_face_delta_x_old_ = adi_face_delta_x_new_;
@@ -122,6 +128,8 @@ void FCSInstrucmentADI::setADIAngleRoll(float angle_roll)
     else {
         ;
     }
+
+    FCSInstrucmentRenderClock::getInstance()->requestFrame();
 }
 
 void FCSInstrucmentADI::setADIAnglePitch(float angle_pitch)
@@ -137,6 +145,13 @@ void FCSInstrucmentADI::setADIAnglePitch(float angle_pitch)
     else {
         ;
     }
+
+    FCSInstrucmentRenderClock::getInstance()->requestFrame();
+}
+
+void FCSInstrucmentADI::initInstrucment(void)
+{
+    initADI();
 }
 
 void FCSInstrucmentADI::resizeEvent(QResizeEvent *event)
@@ -152,7 +167,7 @@ void FCSInstrucmentADI::initADI(void)
 
     resetADI();
 
-    adi_item_back_ = new QGraphicsSvgItem(
+    adi_item_back_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_adi/adi_back.svg");
     adi_item_back_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_back_->setZValue(adi_back_z_);
@@ -161,7 +176,7 @@ void FCSInstrucmentADI::initADI(void)
     adi_item_back_->setTransformOriginPoint(adi_original_adi_ctr_);
     adi_scene_->addItem(adi_item_back_);
 
-    adi_item_face_ = new QGraphicsSvgItem(
+    adi_item_face_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_adi/adi_face.svg");
     adi_item_face_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_face_->setZValue(adi_face_z_);
@@ -170,7 +185,7 @@ void FCSInstrucmentADI::initADI(void)
     adi_item_face_->setTransformOriginPoint(adi_original_adi_ctr_);
     adi_scene_->addItem(adi_item_face_);
 
-    adi_item_ring_ = new QGraphicsSvgItem(
+    adi_item_ring_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_adi/adi_ring.svg");
     adi_item_ring_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_ring_->setZValue(adi_ring_z_);
@@ -179,7 +194,7 @@ void FCSInstrucmentADI::initADI(void)
     adi_item_ring_->setTransformOriginPoint(adi_original_adi_ctr_);
     adi_scene_->addItem(adi_item_ring_);
 
-    adi_item_case_ = new QGraphicsSvgItem(
+    adi_item_case_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_adi/adi_case.svg");
     adi_item_case_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_case_->setZValue(adi_case_z_);
@@ -199,9 +214,6 @@ void FCSInstrucmentADI::resetADI(void)
     adi_item_ring_ = 0;
     adi_item_case_ = 0;
 
-    adi_angle_roll_  = 0.0f;
-    adi_angle_pitch_ = 0.0f;
-
     adi_face_delta_x_new_ = 0.0f;
     adi_face_delta_x_old_ = 0.0f;
     adi_face_delta_y_new_ = 0.0f;
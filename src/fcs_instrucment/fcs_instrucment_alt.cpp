@@ -42,7 +42,7 @@
 #include <fcs_instrucment_alt.h>
 
 FCSInstrucmentALT::FCSInstrucmentALT(QWidget *parent) :
-    QGraphicsView(parent),
+    FCSInstrucmentView("alt paint", parent),
     alt_scene_(0),
     alt_item_face_1_(0),
     alt_item_face_2_(0),
@@ -70,9 +70,8 @@ FCSInstrucmentALT::FCSInstrucmentALT(QWidget *parent) :
 
     setScene(alt_scene_);
 
-    alt_scene_->clear();
-
-    initALT();
+    connect(FCSInstrucmentRenderClock::getInstance(), SIGNAL(frameTicked()),
+            this, SLOT(updateALT()));
 }
 
 FCSInstrucmentALT::~FCSInstrucmentALT()
@@ -91,7 +90,7 @@ FCSInstrucmentALT::~FCSInstrucmentALT()
 
 void FCSInstrucmentALT::reinitALT(void)
 {
-    if (alt_scene_) {
+    if (alt_scene_ && isInstrucmentBuilt()) {
         alt_scene_->clear();
         initALT();
     }
@@ -102,12 +101,21 @@ void FCSInstrucmentALT::reinitALT(void)
 
 void FCSInstrucmentALT::updateALT(void)
 {
+    if (isViewFrozen()) {
+        return ;
+    }
+    else {
+        ;
+    }
+
     updateALTView();
 }
 
 void FCSInstrucmentALT::setALTAltitude(float altitude)
 {
     alt_altitude_ = altitude;
+
+    FCSInstrucmentRenderClock::getInstance()->requestFrame();
 }
 
 void FCSInstrucmentALT::setALTPressure(float pressure)
@@ -123,6 +131,13 @@ void FCSInstrucmentALT::setALTPressure(float pressure)
     else {
         ;
     }
+
+    FCSInstrucmentRenderClock::getInstance()->requestFrame();
+}
+
+void FCSInstrucmentALT::initInstrucment(void)
+{
+    initALT();
 }
 
 void FCSInstrucmentALT::resizeEvent(QResizeEvent *event)
@@ -138,7 +153,7 @@ void FCSInstrucmentALT::initALT(void)
 
     resetALT();
 
-    alt_item_face_1_ = new QGraphicsSvgItem(
+    alt_item_face_1_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_alt/alt_face_1.svg");
     alt_item_face_1_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_face_1_->setZValue(alt_face_1_z_);
@@ -147,7 +162,7 @@ void FCSInstrucmentALT::initALT(void)
     alt_item_face_1_->setTransformOriginPoint(alt_original_alt_ctr_);
     alt_scene_->addItem(alt_item_face_1_);
 
-    alt_item_face_2_ = new QGraphicsSvgItem(
+    alt_item_face_2_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_alt/alt_face_2.svg");
     alt_item_face_2_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_face_2_->setZValue(alt_face_2_z_);
@@ -155,7 +170,7 @@ void FCSInstrucmentALT::initALT(void)
         QTransform::fromScale(alt_scale_x_, alt_scale_y_), true);
     alt_scene_->addItem(alt_item_face_2_);
 
-    alt_item_face_3_ = new QGraphicsSvgItem(
+    alt_item_face_3_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_alt/alt_face_3.svg");
     alt_item_face_3_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_face_3_->setZValue(alt_face_3_z_);
@@ -164,7 +179,7 @@ void FCSInstrucmentALT::initALT(void)
     alt_item_face_3_->setTransformOriginPoint(alt_original_alt_ctr_);
     alt_scene_->addItem(alt_item_face_3_);
 
-    alt_item_hand_1_ = new QGraphicsSvgItem(
+    alt_item_hand_1_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_alt/alt_hand_1.svg");
     alt_item_hand_1_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_hand_1_->setZValue(alt_hand_1_z_);
@@ -173,7 +188,7 @@ void FCSInstrucmentALT::initALT(void)
     alt_item_hand_1_->setTransformOriginPoint(alt_original_alt_ctr_);
     alt_scene_->addItem(alt_item_hand_1_);
 
-    alt_item_hand_2_ = new QGraphicsSvgItem(
+    alt_item_hand_2_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_alt/alt_hand_2.svg");
     alt_item_hand_2_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_hand_2_->setZValue(alt_hand_2_z_);
@@ -182,7 +197,7 @@ void FCSInstrucmentALT::initALT(void)
     alt_item_hand_2_->setTransformOriginPoint(alt_original_alt_ctr_);
     alt_scene_->addItem(alt_item_hand_2_);
 
-    alt_item_case_ = new QGraphicsSvgItem(
+    alt_item_case_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_alt/alt_case.svg");
     alt_item_case_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_case_->setZValue(alt_case_z_);
@@ -203,9 +218,6 @@ void FCSInstrucmentALT::resetALT(void)
     alt_item_hand_1_ = 0;
     alt_item_hand_2_ = 0;
     alt_item_case_   = 0;
-
-    alt_altitude_ =  0.0f;
-    alt_pressure_ = 28.0f;
 }
 
 void FCSInstrucmentALT::updateALTView(void)
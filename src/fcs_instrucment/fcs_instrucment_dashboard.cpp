@@ -0,0 +1,522 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_dashboard.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements a dashboard hosting several instrucment panels as
+ * item groups of one scene, so they share one viewport and one repaint pass.
+ *****************************************************************************/
+
+#include <math.h>
+#include <fcs_instrucment_dashboard.h>
+
+FCSInstrucmentDashboard::FCSInstrucmentDashboard(QWidget *parent) :
+    FCSInstrucmentView("dashboard paint", parent),
+    dashboard_scene_(0),
+    dashboard_rows_(0),
+    dashboard_columns_(0),
+    dashboard_original_cell_(240)
+{
+    dashboard_scene_ = new QGraphicsScene(this);
+
+    setScene(dashboard_scene_);
+
+    dashboard_scene_->clear();
+
+    connect(FCSInstrucmentRenderClock::getInstance(), SIGNAL(frameTicked()),
+            this, SLOT(updateDashboard()));
+}
+
+FCSInstrucmentDashboard::~FCSInstrucmentDashboard()
+{
+    clearDashboardPanels();
+
+    if (dashboard_scene_) {
+        delete dashboard_scene_;
+        dashboard_scene_ = 0;
+    }
+    else {
+        ;
+    }
+}
+
+int FCSInstrucmentDashboard::addDashboardPanel(PanelType panel_type, int row,
+                                               int column, int span)
+{
+    if (row < 0 || column < 0 || span < 1) {
+        return -1;
+    }
+    else {
+        ;
+    }
+
+    // Panel group carries cell position and span, items inside stay in
+    // original units as the standalone instrucments draw them.
+    QGraphicsItemGroup *group = new QGraphicsItemGroup();
+
+    group->setPos(column * dashboard_original_cell_,
+                  row    * dashboard_original_cell_);
+    group->setScale(span);
+
+    Panel *panel = 0;
+
+    switch (panel_type) {
+        case PANEL_ADI: {
+            panel = new PanelADI(group);
+            break;
+        }
+        case PANEL_ALT: {
+            panel = new PanelALT(group);
+            break;
+        }
+        case PANEL_HSI: {
+            panel = new PanelHSI(group);
+            break;
+        }
+        default: {
+            delete group;
+            return -1;
+        }
+    }
+
+    dashboard_scene_->addItem(group);
+    dashboard_panels_.append(panel);
+
+    dashboard_rows_    = qMax(dashboard_rows_,    row    + span);
+    dashboard_columns_ = qMax(dashboard_columns_, column + span);
+
+    dashboard_scene_->setSceneRect(
+        0, 0, dashboard_columns_ * dashboard_original_cell_,
+        dashboard_rows_ * dashboard_original_cell_);
+
+    reinitDashboard();
+
+    // Panels added before build get their items with the rest of dashboard.
+    if (isInstrucmentBuilt()) {
+        panel->initPanel();
+        panel->updatePanel();
+    }
+    else {
+        ;
+    }
+
+    return dashboard_panels_.size() - 1;
+}
+
+void FCSInstrucmentDashboard::clearDashboardPanels(void)
+{
+    for (int i = 0; i < dashboard_panels_.size(); i++) {
+        delete dashboard_panels_[i];
+    }
+
+    dashboard_panels_.clear();
+
+    // Groups own the items of panels, clearing scene deletes both.
+    if (dashboard_scene_) {
+        dashboard_scene_->clear();
+    }
+    else {
+        ;
+    }
+
+    dashboard_rows_    = 0;
+    dashboard_columns_ = 0;
+}
+
+void FCSInstrucmentDashboard::setDashboardAngleRoll(int panel,
+                                                    float angle_roll)
+{
+    if (getDashboardPanel(panel)) {
+        getDashboardPanel(panel)->setPanelAngleRoll(angle_roll);
+        FCSInstrucmentRenderClock::getInstance()->requestFrame();
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentDashboard::setDashboardAnglePitch(int panel,
+                                                     float angle_pitch)
+{
+    if (getDashboardPanel(panel)) {
+        getDashboardPanel(panel)->setPanelAnglePitch(angle_pitch);
+        FCSInstrucmentRenderClock::getInstance()->requestFrame();
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentDashboard::setDashboardAltitude(int panel, float altitude)
+{
+    if (getDashboardPanel(panel)) {
+        getDashboardPanel(panel)->setPanelAltitude(altitude);
+        FCSInstrucmentRenderClock::getInstance()->requestFrame();
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentDashboard::setDashboardPressure(int panel, float pressure)
+{
+    if (getDashboardPanel(panel)) {
+        getDashboardPanel(panel)->setPanelPressure(pressure);
+        FCSInstrucmentRenderClock::getInstance()->requestFrame();
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentDashboard::setDashboardHeading(int panel, float heading)
+{
+    if (getDashboardPanel(panel)) {
+        getDashboardPanel(panel)->setPanelHeading(heading);
+        FCSInstrucmentRenderClock::getInstance()->requestFrame();
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentDashboard::updateDashboard(void)
+{
+    if (isViewFrozen()) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    // Panels only touch their items when their values changed, the scene
+    // then repaints all dirty regions in one pass.
+    for (int i = 0; i < dashboard_panels_.size(); i++) {
+        dashboard_panels_[i]->updatePanel();
+    }
+}
+
+void FCSInstrucmentDashboard::initInstrucment(void)
+{
+    for (int i = 0; i < dashboard_panels_.size(); i++) {
+        dashboard_panels_[i]->initPanel();
+    }
+}
+
+void FCSInstrucmentDashboard::resizeEvent(QResizeEvent *event)
+{
+    QGraphicsView::resizeEvent(event);
+    reinitDashboard();
+}
+
+void FCSInstrucmentDashboard::reinitDashboard(void)
+{
+    if (dashboard_rows_ == 0 || dashboard_columns_ == 0) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    float width_scene  = dashboard_columns_ * dashboard_original_cell_;
+    float height_scene = dashboard_rows_    * dashboard_original_cell_;
+
+    // Panels keep their aspect, so layout is fitted with uniform scale.
+    float scale = qMin((float)width()  / width_scene,
+                       (float)height() / height_scene);
+
+    setTransform(QTransform::fromScale(scale, scale));
+    centerOn(width_scene / 2.0f, height_scene / 2.0f);
+}
+
+FCSInstrucmentDashboard::Panel *FCSInstrucmentDashboard::getDashboardPanel(
+    int panel) const
+{
+    if (panel < 0 || panel >= dashboard_panels_.size()) {
+        return 0;
+    }
+    else {
+        return dashboard_panels_[panel];
+    }
+}
+
+/*****************************************************************************/
+
+FCSInstrucmentDashboard::Panel::Panel(QGraphicsItemGroup *group) :
+    panel_group_(group),
+    panel_dirty_(true),
+    panel_original_ctr_(120.0f, 120.0f)
+{
+}
+
+FCSInstrucmentDashboard::Panel::~Panel()
+{
+}
+
+void FCSInstrucmentDashboard::Panel::setPanelAngleRoll(float)
+{
+}
+
+void FCSInstrucmentDashboard::Panel::setPanelAnglePitch(float)
+{
+}
+
+void FCSInstrucmentDashboard::Panel::setPanelAltitude(float)
+{
+}
+
+void FCSInstrucmentDashboard::Panel::setPanelPressure(float)
+{
+}
+
+void FCSInstrucmentDashboard::Panel::setPanelHeading(float)
+{
+}
+
+QGraphicsItemGroup *FCSInstrucmentDashboard::Panel::getPanelGroup(void) const
+{
+    return panel_group_;
+}
+
+FCSInstrucmentSvgItem *FCSInstrucmentDashboard::Panel::createPanelItem(
+    const QString &path, int z, bool rotating)
+{
+    FCSInstrucmentSvgItem *item = FCSInstrucmentSvgCache::createItem(path);
+
+    // Static layers are rasterized once per view size, rotating layers
+    // always render from vectors.
+    if (rotating) {
+        item->setCacheMode(QGraphicsItem::NoCache);
+        item->setTransformOriginPoint(panel_original_ctr_);
+    }
+    else {
+        item->setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+    }
+
+    item->setZValue(z);
+    item->setParentItem(panel_group_);
+
+    return item;
+}
+
+/*****************************************************************************/
+
+FCSInstrucmentDashboard::PanelADI::PanelADI(QGraphicsItemGroup *group) :
+    Panel(group),
+    adi_item_back_(0),
+    adi_item_face_(0),
+    adi_item_ring_(0),
+    adi_item_case_(0),
+    adi_angle_roll_ (0.0f),
+    adi_angle_pitch_(0.0f),
+    adi_original_pix_per_deg_(1.7f)
+{
+}
+
+void FCSInstrucmentDashboard::PanelADI::initPanel(void)
+{
+    adi_item_back_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_adi/adi_back.svg", -30, true);
+    adi_item_face_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_adi/adi_face.svg", -20, true);
+    adi_item_ring_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_adi/adi_ring.svg", -10, true);
+    adi_item_case_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_adi/adi_case.svg",  10, false);
+}
+
+void FCSInstrucmentDashboard::PanelADI::updatePanel(void)
+{
+    if (!panel_dirty_) {
+        return ;
+    }
+    else {
+        panel_dirty_ = false;
+    }
+
+    adi_item_back_->setRotation(-adi_angle_roll_);
+    adi_item_face_->setRotation(-adi_angle_roll_);
+    adi_item_ring_->setRotation(-adi_angle_roll_);
+
+    float roll_rad = M_PI * adi_angle_roll_ / 180.0f;
+    float delta    = adi_original_pix_per_deg_ * adi_angle_pitch_;
+
+    adi_item_face_->setPos(delta * sin(roll_rad), delta * cos(roll_rad));
+}
+
+void FCSInstrucmentDashboard::PanelADI::setPanelAngleRoll(float angle_roll)
+{
+    adi_angle_roll_ = angle_roll;
+
+    if (adi_angle_roll_ < -180.0f) {
+        adi_angle_roll_ = -180.0f;
+    }
+    else if (adi_angle_roll_ > 180.0f) {
+        adi_angle_roll_ = 180.0f;
+    }
+    else {
+        ;
+    }
+
+    panel_dirty_ = true;
+}
+
+void FCSInstrucmentDashboard::PanelADI::setPanelAnglePitch(float angle_pitch)
+{
+    adi_angle_pitch_ = angle_pitch;
+
+    if (adi_angle_pitch_ < -25.0f) {
+        adi_angle_pitch_ = -25.0f;
+    }
+    else if (adi_angle_pitch_ > 25.0f) {
+        adi_angle_pitch_ = 25.0f;
+    }
+    else {
+        ;
+    }
+
+    panel_dirty_ = true;
+}
+
+/*****************************************************************************/
+
+FCSInstrucmentDashboard::PanelALT::PanelALT(QGraphicsItemGroup *group) :
+    Panel(group),
+    alt_item_face_1_(0),
+    alt_item_face_2_(0),
+    alt_item_face_3_(0),
+    alt_item_hand_1_(0),
+    alt_item_hand_2_(0),
+    alt_item_case_  (0),
+    alt_altitude_( 0.0f),
+    alt_pressure_(28.0f)
+{
+}
+
+void FCSInstrucmentDashboard::PanelALT::initPanel(void)
+{
+    alt_item_face_1_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_alt/alt_face_1.svg", -50, true);
+    alt_item_face_2_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_alt/alt_face_2.svg", -40,
+        false);
+    alt_item_face_3_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_alt/alt_face_3.svg", -30, true);
+    alt_item_hand_1_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_alt/alt_hand_1.svg", -20, true);
+    alt_item_hand_2_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_alt/alt_hand_2.svg", -10, true);
+    alt_item_case_   = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_alt/alt_case.svg",    10,
+        false);
+}
+
+void FCSInstrucmentDashboard::PanelALT::updatePanel(void)
+{
+    if (!panel_dirty_) {
+        return ;
+    }
+    else {
+        panel_dirty_ = false;
+    }
+
+    int altitude = ceil(alt_altitude_ + 0.5);
+
+    float angle_hand_1 = alt_altitude_ * 0.036f;
+    float angle_hand_2 = (altitude % 1000) * 0.36f;
+    float angle_face_1 = (alt_pressure_ - 28.0f) * 100.0f;
+    float angle_face_3 = alt_altitude_ * 0.0036f;
+
+    alt_item_hand_1_->setRotation( angle_hand_1);
+    alt_item_hand_2_->setRotation( angle_hand_2);
+    alt_item_face_1_->setRotation(-angle_face_1);
+    alt_item_face_3_->setRotation( angle_face_3);
+}
+
+void FCSInstrucmentDashboard::PanelALT::setPanelAltitude(float altitude)
+{
+    alt_altitude_ = altitude;
+    panel_dirty_  = true;
+}
+
+void FCSInstrucmentDashboard::PanelALT::setPanelPressure(float pressure)
+{
+    alt_pressure_ = pressure;
+
+    if (alt_pressure_ < 28.0f) {
+        alt_pressure_ = 28.0f;
+    }
+    else if (alt_pressure_ > 31.5f) {
+        alt_pressure_ = 31.5f;
+    }
+    else {
+        ;
+    }
+
+    panel_dirty_ = true;
+}
+
+/*****************************************************************************/
+
+FCSInstrucmentDashboard::PanelHSI::PanelHSI(QGraphicsItemGroup *group) :
+    Panel(group),
+    hsi_item_face_(0),
+    hsi_item_case_(0),
+    hsi_heading_(0.0f)
+{
+}
+
+void FCSInstrucmentDashboard::PanelHSI::initPanel(void)
+{
+    hsi_item_face_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_hsi/hsi_face.svg", -20, true);
+    hsi_item_case_ = createPanelItem(
+        ":/fcs_instrucment/res/fcs_instrucment_hsi/hsi_case.svg",  10, false);
+}
+
+void FCSInstrucmentDashboard::PanelHSI::updatePanel(void)
+{
+    if (!panel_dirty_) {
+        return ;
+    }
+    else {
+        panel_dirty_ = false;
+    }
+
+    hsi_item_face_->setRotation(-hsi_heading_);
+}
+
+void FCSInstrucmentDashboard::PanelHSI::setPanelHeading(float heading)
+{
+    hsi_heading_ = heading;
+    panel_dirty_ = true;
+}
@@ -0,0 +1,222 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_digit_item.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements a fixed width text item of instrucments, which
+ * draws readouts and scale labels from pre-shaped glyphs instead of laying
+ * out a text document.
+ *****************************************************************************/
+
+#include <QFontMetricsF>
+#include <string.h>
+#include <fcs_instrucment_digit_item.h>
+
+FCSInstrucmentDigitItem::FCSInstrucmentDigitItem(const QFont  &font,
+                                                 const QColor &color,
+                                                 int length,
+                                                 QGraphicsItem *parent) :
+    QGraphicsItem(parent),
+    digit_atlas_(getGlyphAtlas(font)),
+    digit_color_(color),
+    digit_length_(length),
+    digit_number_(0),
+    digit_width_(0),
+    digit_fill_(' '),
+    digit_number_valid_(false),
+    digit_text_length_(0)
+{
+    if (digit_length_ < 1) {
+        digit_length_ = 1;
+    }
+    else if (digit_length_ > DIGIT_ITEM_LENGTH_MAX) {
+        digit_length_ = DIGIT_ITEM_LENGTH_MAX;
+    }
+    else {
+        ;
+    }
+
+    digit_text_[0] = '\0';
+}
+
+FCSInstrucmentDigitItem::~FCSInstrucmentDigitItem()
+{
+}
+
+QRectF FCSInstrucmentDigitItem::boundingRect() const
+{
+    return QRectF(0.0f, 0.0f, digit_atlas_->atlas_advance * digit_length_,
+                  digit_atlas_->atlas_height);
+}
+
+void FCSInstrucmentDigitItem::paint(QPainter *painter,
+                                    const QStyleOptionGraphicsItem *option,
+                                    QWidget *widget)
+{
+    Q_UNUSED(option);
+    Q_UNUSED(widget);
+
+    painter->setFont(digit_atlas_->atlas_font);
+    painter->setPen(digit_color_);
+
+    // Text is centered in cells, as the text items it replaces were
+    // centered on their anchor points.
+    qreal advance = digit_atlas_->atlas_advance;
+    qreal head    = advance * (digit_length_ - digit_text_length_) / 2.0f;
+
+    for (int i = 0; i < digit_text_length_; i++) {
+        int glyph = (unsigned char)digit_text_[i];
+        if (glyph > DIGIT_ITEM_GLYPH_MIN && glyph < DIGIT_ITEM_GLYPH_MAX) {
+            painter->drawStaticText(
+                QPointF(head + advance * i, 0.0f),
+                digit_atlas_->atlas_glyph[glyph - DIGIT_ITEM_GLYPH_MIN]);
+        }
+        else {
+            ;
+        }
+    }
+}
+
+void FCSInstrucmentDigitItem::setDigitNumber(int number, int width, char fill)
+{
+    if (digit_number_valid_ && number == digit_number_ &&
+        width == digit_width_ && fill == digit_fill_) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    char  text[DIGIT_ITEM_LENGTH_MAX + 1];
+    char *head  = text + DIGIT_ITEM_LENGTH_MAX;
+    bool  minus = number < 0;
+
+    unsigned int value = minus ? -(unsigned int)number : number;
+
+    *head = '\0';
+
+    do {
+        *--head = '0' + value % 10;
+        value /= 10;
+    } while (value != 0 && head > text + 1);
+
+    if (minus) {
+        *--head = '-';
+    }
+    else {
+        ;
+    }
+
+    while (text + DIGIT_ITEM_LENGTH_MAX - head < width && head > text) {
+        *--head = fill;
+    }
+
+    setDigitText(head);
+
+    digit_number_       = number;
+    digit_width_        = width;
+    digit_fill_         = fill;
+    digit_number_valid_ = true;
+}
+
+void FCSInstrucmentDigitItem::setDigitText(const char *text)
+{
+    int length = strlen(text);
+
+    if (length > digit_length_) {
+        length = digit_length_;
+    }
+    else {
+        ;
+    }
+
+    digit_number_valid_ = false;
+
+    if (length == digit_text_length_ &&
+        memcmp(text, digit_text_, length) == 0) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    memcpy(digit_text_, text, length);
+    digit_text_[length] = '\0';
+    digit_text_length_  = length;
+
+    update();
+}
+
+void FCSInstrucmentDigitItem::setDigitCenter(const QPointF &center)
+{
+    setPos(center.x() - digit_atlas_->atlas_advance * digit_length_ / 2.0f,
+           center.y() - digit_atlas_->atlas_height / 2.0f);
+}
+
+FCSInstrucmentDigitItem::GlyphAtlas *FCSInstrucmentDigitItem::getGlyphAtlas(
+    const QFont &font)
+{
+    static QHash<QString, GlyphAtlas *> atlas_table;
+
+    QString key = font.key();
+
+    GlyphAtlas *atlas = atlas_table.value(key, 0);
+
+    if (atlas) {
+        return atlas;
+    }
+    else {
+        ;
+    }
+
+    QFontMetricsF metrics(font);
+
+    atlas = new GlyphAtlas;
+    atlas->atlas_font    = font;
+    atlas->atlas_advance = 0.0f;
+    atlas->atlas_height  = metrics.height();
+
+    // Cells take the widest glyph, so a fallback font that is not
+    // monospaced still keeps readouts from overlapping.
+    for (int i = DIGIT_ITEM_GLYPH_MIN; i < DIGIT_ITEM_GLYPH_MAX; i++) {
+        QStaticText &glyph = atlas->atlas_glyph[i - DIGIT_ITEM_GLYPH_MIN];
+        glyph.setText(QString(QChar(i)));
+        glyph.setPerformanceHint(QStaticText::AggressiveCaching);
+        glyph.prepare(QTransform(), font);
+        atlas->atlas_advance = qMax(atlas->atlas_advance,
+                                    metrics.width(QChar(i)));
+    }
+
+    atlas_table.insert(key, atlas);
+
+    return atlas;
+}
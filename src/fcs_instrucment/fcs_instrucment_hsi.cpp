@@ -42,7 +42,7 @@
 #include <fcs_instrucment_hsi.h>
 
 FCSInstrucmentHSI::FCSInstrucmentHSI(QWidget *parent) :
-    QGraphicsView(parent),
+    FCSInstrucmentView("hsi paint", parent),
     hsi_scene_(0),
     hsi_item_face_(0),
     hsi_item_case_(0),
@@ -61,9 +61,8 @@ FCSInstrucmentHSI::FCSInstrucmentHSI(QWidget *parent) :
 
     setScene(hsi_scene_);
 
-    hsi_scene_->clear();
-
-    initHSI();
+    connect(FCSInstrucmentRenderClock::getInstance(), SIGNAL(frameTicked()),
+            this, SLOT(updateHSI()));
 }
 
 FCSInstrucmentHSI::~FCSInstrucmentHSI()
@@ -82,7 +81,7 @@ FCSInstrucmentHSI::~FCSInstrucmentHSI()
 
 void FCSInstrucmentHSI::reinitHSI(void)
 {
-    if (hsi_scene_) {
+    if (hsi_scene_ && isInstrucmentBuilt()) {
         hsi_scene_->clear();
         initHSI();
     }
@@ -93,12 +92,26 @@ void FCSInstrucmentHSI::reinitHSI(void)
 
 void FCSInstrucmentHSI::updateHSI(void)
 {
+    if (isViewFrozen()) {
+        return ;
+    }
+    else {
+        ;
+    }
+
     updateHSIView();
 }
 
 void FCSInstrucmentHSI::setHSIHeading(float heading)
 {
     hsi_heading_ = heading;
+
+    FCSInstrucmentRenderClock::getInstance()->requestFrame();
+}
+
+void FCSInstrucmentHSI::initInstrucment(void)
+{
+    initHSI();
 }
 
 void FCSInstrucmentHSI::resizeEvent(QResizeEvent *event)
@@ -114,7 +127,7 @@ void FCSInstrucmentHSI::initHSI(void)
 
     resetHSI();
 
-    hsi_item_face_ = new QGraphicsSvgItem(
+    hsi_item_face_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_hsi/hsi_face.svg");
     hsi_item_face_->setCacheMode(QGraphicsItem::NoCache);
     hsi_item_face_->setZValue(hsi_face_z_);
@@ -123,7 +136,7 @@ void FCSInstrucmentHSI::initHSI(void)
     hsi_item_face_->setTransformOriginPoint(hsi_original_hsi_ctr_);
     hsi_scene_->addItem(hsi_item_face_);
 
-    hsi_item_case_ = new QGraphicsSvgItem(
+    hsi_item_case_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_hsi/hsi_case.svg");
     hsi_item_case_->setCacheMode(QGraphicsItem::NoCache);
     hsi_item_case_->setZValue(hsi_case_z_);
@@ -140,8 +153,6 @@ void FCSInstrucmentHSI::resetHSI(void)
 {
     hsi_item_face_ = 0;
     hsi_item_case_ = 0;
-
-    hsi_heading_ = 0.0f;
 }
 
 void FCSInstrucmentHSI::updateHSIView(void)
@@ -39,9 +39,12 @@
  * according to QFlightInstruments project.
  *****************************************************************************/
 
+#include <stdio.h>
 #include <fcs_instrucment_pfd.h>
+#include <fcs_instrucment_profiler.h>
 
-FCSInstrucmentPFD::FCSInstrucmentPFD(QWidget *parent) : QGraphicsView(parent),
+FCSInstrucmentPFD::FCSInstrucmentPFD(QWidget *parent) :
+    FCSInstrucmentView("pfd paint", parent),
     pfd_scene_(0),
     pfd_panel_adi_(0),
     pfd_panel_alt_(0),
@@ -52,6 +55,10 @@ FCSInstrucmentPFD::FCSInstrucmentPFD(QWidget *parent) : QGraphicsView(parent),
     pfd_item_mask_(0),
     pfd_scale_x_(1.0f),
     pfd_scale_y_(1.0f),
+    pfd_render_mode_(CACHED),
+    pfd_filter_mode_(FCSInstrucmentValueFilter::INTERPOLATE),
+    pfd_filter_roll_(-180.0f, 180.0f),
+    pfd_filter_heading_(0.0f, 360.0f),
     pfd_original_height_(300),
     pfd_original_width_(300),
     pfd_back_z_(0),
@@ -60,17 +67,21 @@ FCSInstrucmentPFD::FCSInstrucmentPFD(QWidget *parent) : QGraphicsView(parent),
     resetPFD();
 
     pfd_scene_ = new QGraphicsScene(this);
+    pfd_scene_->setSceneRect(0, 0, pfd_original_width_, pfd_original_height_);
     setScene(pfd_scene_);
 
-    pfd_scene_->clear();
-
     pfd_panel_adi_ = new PanelADI(pfd_scene_);
     pfd_panel_alt_ = new PanelALT(pfd_scene_);
     pfd_panel_asi_ = new PanelASI(pfd_scene_);
     pfd_panel_hsi_ = new PanelHSI(pfd_scene_);
     pfd_panel_vsi_ = new PanelVSI(pfd_scene_);
 
-    initPFD();
+    pfd_filter_timer_.start();
+
+    setPFDFilterMode(pfd_filter_mode_);
+
+    connect(FCSInstrucmentRenderClock::getInstance(), SIGNAL(frameTicked()),
+            this, SLOT(updatePFD()));
 }
 
 FCSInstrucmentPFD::~FCSInstrucmentPFD()
@@ -107,15 +118,134 @@ FCSInstrucmentPFD::~FCSInstrucmentPFD()
 
 void FCSInstrucmentPFD::reinitPFD(void)
 {
-    if (pfd_scene_) {
-        pfd_scene_->clear();
-        initPFD();
-    }
+    // Items stay in original units of scene, so fitting widget size only
+    // needs view transform.
+    pfd_scale_x_ = (float)width()  / (float)pfd_original_width_;
+    pfd_scale_y_ = (float)height() / (float)pfd_original_height_;
+
+    setTransform(QTransform::fromScale(pfd_scale_x_, pfd_scale_y_));
+    centerOn(pfd_original_width_ / 2.0f, pfd_original_height_ / 2.0f);
 }
 
 void FCSInstrucmentPFD::updatePFD(void)
 {
+    if (isViewFrozen()) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    qint64 time = getPFDTime();
+
+    pfd_panel_adi_->setADIAngleRoll(pfd_filter_roll_.getValue(time));
+    pfd_panel_adi_->setADIAnglePitch(pfd_filter_pitch_.getValue(time));
+    pfd_panel_alt_->setALTAltitude(pfd_filter_altitude_.getValue(time));
+    pfd_panel_asi_->setASIAirspeed(pfd_filter_airspeed_.getValue(time));
+    float heading = pfd_filter_heading_.getValue(time);
+
+    pfd_panel_adi_->setADIHeading(heading);
+    pfd_panel_hsi_->setHSIHeading(heading);
+    pfd_panel_vsi_->setVSIClimbRate(pfd_filter_climb_rate_.getValue(time));
+
     updatePFDView();
+
+    // Filtered values keep moving between samples, so next frame is asked
+    // for until all of them settle.
+    if (pfd_filter_roll_.isMoving(time)     ||
+        pfd_filter_pitch_.isMoving(time)    ||
+        pfd_filter_altitude_.isMoving(time) ||
+        pfd_filter_airspeed_.isMoving(time) ||
+        pfd_filter_heading_.isMoving(time)  ||
+        pfd_filter_climb_rate_.isMoving(time)) {
+        requestPFDFrame();
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentPFD::setPFDRenderMode(RenderMode render_mode)
+{
+    pfd_render_mode_ = render_mode;
+
+    // Static and translation-only layers are rasterized once per view size
+    // and blitted afterwards, rotating layers always render from vectors.
+    QGraphicsItem::CacheMode cache_mode = QGraphicsItem::NoCache;
+
+    if (pfd_render_mode_ == CACHED) {
+        cache_mode = QGraphicsItem::DeviceCoordinateCache;
+    }
+    else {
+        ;
+    }
+
+    pfd_panel_adi_->setADICacheMode(cache_mode);
+    pfd_panel_alt_->setALTCacheMode(cache_mode);
+    pfd_panel_asi_->setASICacheMode(cache_mode);
+    pfd_panel_hsi_->setHSICacheMode(cache_mode);
+    pfd_panel_vsi_->setVSICacheMode(cache_mode);
+
+    if (pfd_item_back_ && pfd_item_mask_) {
+        pfd_item_back_->setCacheMode(cache_mode);
+        pfd_item_mask_->setCacheMode(cache_mode);
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentPFD::setPFDFilterMode(
+    FCSInstrucmentValueFilter::FilterMode filter_mode)
+{
+    pfd_filter_mode_ = filter_mode;
+
+    pfd_filter_roll_.setFilterMode(pfd_filter_mode_);
+    pfd_filter_pitch_.setFilterMode(pfd_filter_mode_);
+    pfd_filter_altitude_.setFilterMode(pfd_filter_mode_);
+    pfd_filter_airspeed_.setFilterMode(pfd_filter_mode_);
+    pfd_filter_heading_.setFilterMode(pfd_filter_mode_);
+    pfd_filter_climb_rate_.setFilterMode(pfd_filter_mode_);
+
+    requestPFDFrame();
+}
+
+void FCSInstrucmentPFD::setPFDAngularRate(float roll_rate, float pitch_rate,
+                                          float yaw_rate)
+{
+    pfd_filter_roll_.setRate(roll_rate);
+    pfd_filter_pitch_.setRate(pitch_rate);
+    // Yaw rate stands for heading rate, which holds for small bank.
+    pfd_filter_heading_.setRate(yaw_rate);
+}
+
+bool FCSInstrucmentPFD::setPFDTerrainFile(const QString &path)
+{
+    bool result = false;
+
+    if (path.isEmpty()) {
+        pfd_terrain_map_.clearTerrain();
+    }
+    else {
+        result = pfd_terrain_map_.loadTerrainFile(path);
+    }
+
+    pfd_panel_adi_->setADITerrainMap(&pfd_terrain_map_);
+    requestPFDFrame();
+
+    return result;
+}
+
+void FCSInstrucmentPFD::setPFDTerrainOrigin(double latitude, double longitude)
+{
+    pfd_terrain_map_.setTerrainOrigin(latitude, longitude);
+    pfd_panel_adi_->setADITerrainMap(&pfd_terrain_map_);
+    requestPFDFrame();
+}
+
+void FCSInstrucmentPFD::initInstrucment(void)
+{
+    initPFD();
 }
 
 void FCSInstrucmentPFD::resizeEvent(QResizeEvent *event)
@@ -126,32 +256,32 @@ void FCSInstrucmentPFD::resizeEvent(QResizeEvent *event)
 
 void FCSInstrucmentPFD::initPFD(void)
 {
-    pfd_scale_x_ = (float)width()  / (float)pfd_original_width_;
-    pfd_scale_y_ = (float)height() / (float)pfd_original_height_;
-
-    pfd_panel_adi_->initADI(pfd_scale_x_, pfd_scale_y_);
-    pfd_panel_alt_->initALT(pfd_scale_x_, pfd_scale_y_);
-    pfd_panel_asi_->initASI(pfd_scale_x_, pfd_scale_y_);
-    pfd_panel_hsi_->initHSI(pfd_scale_x_, pfd_scale_y_);
-    pfd_panel_vsi_->initVSI(pfd_scale_x_, pfd_scale_y_);
-
-    pfd_item_back_ = new QGraphicsSvgItem(
+    pfd_panel_adi_->initADI();
+    tagPFDItems(PANEL_ADI);
+    pfd_panel_alt_->initALT();
+    tagPFDItems(PANEL_ALT);
+    pfd_panel_asi_->initASI();
+    tagPFDItems(PANEL_ASI);
+    pfd_panel_hsi_->initHSI();
+    tagPFDItems(PANEL_HSI);
+    pfd_panel_vsi_->initVSI();
+    tagPFDItems(PANEL_VSI);
+
+    pfd_item_back_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_back.svg");
-    pfd_item_back_->setCacheMode(QGraphicsItem::NoCache);
     pfd_item_back_->setZValue(pfd_back_z_);
-    pfd_item_back_->setTransform(
-        QTransform::fromScale(pfd_scale_x_, pfd_scale_y_), true);
     pfd_scene_->addItem(pfd_item_back_);
 
-    pfd_item_mask_ = new QGraphicsSvgItem(
+    pfd_item_mask_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_mask.svg");
-    pfd_item_mask_->setCacheMode(QGraphicsItem::NoCache);
     pfd_item_mask_->setZValue(pfd_mask_z_);
-    pfd_item_mask_->setTransform(
-        QTransform::fromScale(pfd_scale_x_, pfd_scale_y_), true);
     pfd_scene_->addItem(pfd_item_mask_);
 
-    centerOn(width() / 2.0f, height() / 2.0f);
+    tagPFDItems(PANEL_PFD);
+
+    setPFDRenderMode(pfd_render_mode_);
+
+    reinitPFD();
 
     updatePFDView();
 }
@@ -164,16 +294,29 @@ void FCSInstrucmentPFD::resetPFD(void)
 
 void FCSInstrucmentPFD::updatePFDView(void)
 {
-    pfd_scale_x_ = (float)width()  / (float)pfd_original_width_;
-    pfd_scale_y_ = (float)height() / (float)pfd_original_height_;
+    FCS_INSTRUCMENT_PROFILE("pfd update");
 
-    pfd_panel_adi_->updateADI(pfd_scale_x_, pfd_scale_y_);
-    pfd_panel_alt_->updateALT(pfd_scale_x_, pfd_scale_y_);
-    pfd_panel_asi_->updateASI(pfd_scale_x_, pfd_scale_y_);
-    pfd_panel_hsi_->updateHSI(pfd_scale_x_, pfd_scale_y_);
-    pfd_panel_vsi_->updateVSI(pfd_scale_x_, pfd_scale_y_);
+    pfd_panel_adi_->updateADI();
+    pfd_panel_alt_->updateALT();
+    pfd_panel_asi_->updateASI();
+    pfd_panel_hsi_->updateHSI();
+    pfd_panel_vsi_->updateVSI();
+}
+
+void FCSInstrucmentPFD::tagPFDItems(PanelType panel_type)
+{
+    // Panels add items in turn, so untagged items belong to the panel
+    // initialized last.
+    QList<QGraphicsItem *> items = pfd_scene_->items();
 
-    pfd_scene_->update();
+    for (int i = 0; i < items.size(); i++) {
+        if (!items[i]->data(PFD_ITEM_PANEL_KEY).isValid()) {
+            items[i]->setData(PFD_ITEM_PANEL_KEY, panel_type);
+        }
+        else {
+            ;
+        }
+    }
 }
 
 /*****************************************************************************/
@@ -181,6 +324,7 @@ void FCSInstrucmentPFD::updatePFDView(void)
 FCSInstrucmentPFD::PanelADI::PanelADI(QGraphicsScene *scene) :
     adi_scene_(scene),
     adi_item_back_   (0),
+    adi_item_terrain_(0),
     adi_item_ladd_   (0),
     adi_item_roll_   (0),
     adi_item_slip_   (0),
@@ -194,6 +338,15 @@ FCSInstrucmentPFD::PanelADI::PanelADI(QGraphicsScene *scene) :
     adi_item_mask_   (0),
     adi_item_scale_h_(0),
     adi_item_scale_v_(0),
+    adi_cache_mode_(QGraphicsItem::NoCache),
+    adi_dirty_         (true),
+    adi_dirty_attitude_(true),
+    adi_dirty_slip_    (true),
+    adi_dirty_turn_    (true),
+    adi_dirty_path_    (true),
+    adi_dirty_bars_    (true),
+    adi_dirty_dots_    (true),
+    adi_dirty_terrain_ (true),
     adi_angle_roll_    (0.0f),
     adi_angle_pitch_   (0.0f),
     adi_angle_attack_  (0.0f),
@@ -204,44 +357,17 @@ FCSInstrucmentPFD::PanelADI::PanelADI(QGraphicsScene *scene) :
     adi_bar_v_         (0.0f),
     adi_dot_h_         (0.0f),
     adi_dot_v_         (0.0f),
+    adi_terrain_map_(0),
+    adi_position_x_ (0.0f),
+    adi_position_y_ (0.0f),
+    adi_position_z_ (0.0f),
+    adi_heading_    (0.0f),
     adi_path_valid_   (true),
     adi_path_visible_ (true),
     adi_bar_h_visible_(true),
     adi_bar_v_visible_(true),
     adi_dot_h_visible_(true),
     adi_dot_v_visible_(true),
-    adi_ladd_delta_x_new_     (0.0f),
-    adi_ladd_delta_x_old_     (0.0f),
-    adi_ladd_delta_y_new_     (0.0f),
-    adi_ladd_delta_y_old_     (0.0f),
-    adi_ladd_back_delta_x_new_(0.0f),
-    adi_ladd_back_delta_x_old_(0.0f),
-    adi_ladd_back_delta_y_new_(0.0f),
-    adi_ladd_back_delta_y_old_(0.0f),
-    adi_slip_delta_x_new_     (0.0f),
-    adi_slip_delta_x_old_     (0.0f),
-    adi_slip_delta_y_new_     (0.0f),
-    adi_slip_delta_y_old_     (0.0f),
-    adi_turn_delta_x_new_     (0.0f),
-    adi_turn_delta_x_old_     (0.0f),
-    adi_path_delta_x_new_     (0.0f),
-    adi_path_delta_x_old_     (0.0f),
-    adi_path_delta_y_new_     (0.0f),
-    adi_path_delta_y_old_     (0.0f),
-    adi_mark_delta_x_new_     (0.0f),
-    adi_mark_delta_x_old_     (0.0f),
-    adi_mark_delta_y_new_     (0.0f),
-    adi_mark_delta_y_old_     (0.0f),
-    adi_bar_h_delta_x_new_    (0.0f),
-    adi_bar_h_delta_x_old_    (0.0f),
-    adi_bar_v_delta_y_new_    (0.0f),
-    adi_bar_v_delta_y_old_    (0.0f),
-    adi_dot_h_delta_x_new_    (0.0f),
-    adi_dot_h_delta_x_old_    (0.0f),
-    adi_dot_v_delta_y_new_    (0.0f),
-    adi_dot_v_delta_y_old_    (0.0f),
-    adi_scale_x_(1.0f),
-    adi_scale_y_(1.0f),
     adi_original_pix_per_deg_(  3.0f),
     adi_delta_ladd_back_max_ ( 52.5f),
     adi_delta_ladd_back_min_ (-52.5f),
@@ -249,8 +375,10 @@ FCSInstrucmentPFD::PanelADI::PanelADI(QGraphicsScene *scene) :
     adi_max_turn_deflection_ ( 55.0f),
     adi_max_bars_deflection_ ( 40.0f),
     adi_max_dots_deflection_ ( 50.0f),
+    adi_original_terrain_size_(210.0f),
     adi_original_adi_ctr_    (150.0f,  125.0f),
     adi_original_back_pos_   ( 45.0f,  -85.0f),
+    adi_original_terrain_pos_( 45.0f,   20.0f),
     adi_original_ladd_pos_   ( 110.f, -175.0f),
     adi_original_roll_pos_   ( 45.0f,   20.0f),
     adi_original_slip_pos_   (145.5f,   68.5f),
@@ -263,6 +391,7 @@ FCSInstrucmentPFD::PanelADI::PanelADI(QGraphicsScene *scene) :
     adi_original_scale_h_pos_(  0.0f,    0.0f),
     adi_original_scale_v_pos_(  0.0f,    0.0f),
     adi_back_z_  (10),
+    adi_terrain_z_(15),
     adi_ladd_z_  (20),
     adi_roll_z_  (30),
     adi_slip_z_  (40),
@@ -280,166 +409,130 @@ FCSInstrucmentPFD::PanelADI::~PanelADI()
 {
 }
 
-void FCSInstrucmentPFD::PanelADI::initADI(float scale_x, float scale_y)
+void FCSInstrucmentPFD::PanelADI::initADI(void)
 {
-    adi_scale_x_ = scale_x;
-    adi_scale_y_ = scale_y;
-
     resetADI();
 
-    adi_item_back_ = new QGraphicsSvgItem(
+    adi_item_back_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_back.svg");
     adi_item_back_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_back_->setZValue(adi_back_z_);
-    adi_item_back_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
     adi_item_back_->setTransformOriginPoint(
         adi_original_adi_ctr_ - adi_original_back_pos_);
-    adi_item_back_->moveBy(adi_scale_x_ * adi_original_back_pos_.x(),
-                           adi_scale_y_ * adi_original_back_pos_.y());
+    adi_item_back_->setPos(adi_original_back_pos_);
     adi_scene_->addItem(adi_item_back_);
 
-    adi_item_ladd_ = new QGraphicsSvgItem(
+    // Terrain is centered on ADI and only rolls, pitch and heading are
+    // rendered into it.
+    adi_item_terrain_ = new FCSInstrucmentTerrainItem(
+        adi_original_terrain_size_, adi_original_pix_per_deg_);
+    adi_item_terrain_->setCacheMode(QGraphicsItem::NoCache);
+    adi_item_terrain_->setZValue(adi_terrain_z_);
+    adi_item_terrain_->setTransformOriginPoint(
+        adi_original_adi_ctr_ - adi_original_terrain_pos_);
+    adi_item_terrain_->setPos(adi_original_terrain_pos_);
+    adi_scene_->addItem(adi_item_terrain_);
+    setADITerrainMap(adi_terrain_map_);
+
+    adi_item_ladd_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_ladd.svg");
     adi_item_ladd_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_ladd_->setZValue(adi_ladd_z_);
-    adi_item_ladd_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
     adi_item_ladd_->setTransformOriginPoint(
         adi_original_adi_ctr_ - adi_original_ladd_pos_);
-    adi_item_ladd_->moveBy(adi_scale_x_ * adi_original_ladd_pos_.x(),
-                           adi_scale_y_ * adi_original_ladd_pos_.y());
+    adi_item_ladd_->setPos(adi_original_ladd_pos_);
     adi_scene_->addItem(adi_item_ladd_);
 
-    adi_item_roll_ = new QGraphicsSvgItem(
+    adi_item_roll_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_roll.svg");
     adi_item_roll_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_roll_->setZValue(adi_roll_z_);
-    adi_item_roll_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
     adi_item_roll_->setTransformOriginPoint(
         adi_original_adi_ctr_ - adi_original_roll_pos_);
-    adi_item_roll_->moveBy(adi_scale_x_ * adi_original_roll_pos_.x(),
-                           adi_scale_y_ * adi_original_roll_pos_.y());
+    adi_item_roll_->setPos(adi_original_roll_pos_);
     adi_scene_->addItem(adi_item_roll_);
 
-    adi_item_slip_ = new QGraphicsSvgItem(
+    adi_item_slip_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_slip.svg");
     adi_item_slip_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_slip_->setZValue(adi_slip_z_);
-    adi_item_slip_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
     adi_item_slip_->setTransformOriginPoint(
         adi_original_adi_ctr_ - adi_original_slip_pos_);
-    adi_item_slip_->moveBy(adi_scale_x_ * adi_original_slip_pos_.x(),
-                           adi_scale_y_ * adi_original_slip_pos_.y());
+    adi_item_slip_->setPos(adi_original_slip_pos_);
     adi_scene_->addItem(adi_item_slip_);
 
-    adi_item_turn_ = new QGraphicsSvgItem(
+    adi_item_turn_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_turn.svg");
-    adi_item_turn_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_turn_->setZValue(adi_turn_z_);
-    adi_item_turn_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
-    adi_item_turn_->moveBy(adi_scale_x_ * adi_original_turn_pos_.x(),
-                           adi_scale_y_ * adi_original_turn_pos_.y());
+    adi_item_turn_->setPos(adi_original_turn_pos_);
     adi_scene_->addItem(adi_item_turn_);
 
-    adi_item_path_ = new QGraphicsSvgItem(
+    adi_item_path_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_path.svg");
-    adi_item_path_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_path_->setZValue(adi_path_z_);
-    adi_item_path_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
-    adi_item_path_->moveBy(adi_scale_x_ * adi_original_path_pos_.x(),
-                           adi_scale_y_ * adi_original_path_pos_.y());
+    adi_item_path_->setPos(adi_original_path_pos_);
     adi_scene_->addItem(adi_item_path_);
 
-    adi_item_mark_ = new QGraphicsSvgItem(
+    adi_item_mark_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_mark.svg");
-    adi_item_mark_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_mark_->setZValue(adi_path_z_);
-    adi_item_mark_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
-    adi_item_mark_->moveBy(adi_scale_x_ * adi_original_path_pos_.x(),
-                           adi_scale_y_ * adi_original_path_pos_.y());
+    adi_item_mark_->setPos(adi_original_path_pos_);
     adi_scene_->addItem(adi_item_mark_);
 
-    adi_item_bar_h_ = new QGraphicsSvgItem(
+    adi_item_bar_h_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_bar_h.svg");
-    adi_item_bar_h_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_bar_h_->setZValue(adi_bars_z_);
-    adi_item_bar_h_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
-    adi_item_bar_h_->moveBy(adi_scale_x_ * adi_original_bar_h_pos_.x(),
-                            adi_scale_y_ * adi_original_bar_h_pos_.y());
+    adi_item_bar_h_->setPos(adi_original_bar_h_pos_);
     adi_scene_->addItem(adi_item_bar_h_);
 
-    adi_item_bar_v_ = new QGraphicsSvgItem(
+    adi_item_bar_v_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_bar_v.svg");
-    adi_item_bar_v_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_bar_v_->setZValue(adi_bars_z_);
-    adi_item_bar_v_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
-    adi_item_bar_v_->moveBy(adi_scale_x_ * adi_original_bar_v_pos_.x(),
-                            adi_scale_y_ * adi_original_bar_v_pos_.y());
+    adi_item_bar_v_->setPos(adi_original_bar_v_pos_);
     adi_scene_->addItem(adi_item_bar_v_);
 
-    adi_item_dot_h_ = new QGraphicsSvgItem(
+    adi_item_dot_h_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_dot_h.svg");
-    adi_item_dot_h_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_dot_h_->setZValue(adi_dots_z_);
-    adi_item_dot_h_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
-    adi_item_dot_h_->moveBy(adi_scale_x_ * adi_original_dot_h_pos_.x(),
-                            adi_scale_y_ * adi_original_dot_h_pos_.y());
+    adi_item_dot_h_->setPos(adi_original_dot_h_pos_);
     adi_scene_->addItem(adi_item_dot_h_);
 
-    adi_item_dot_v_ = new QGraphicsSvgItem(
+    adi_item_dot_v_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_dot_v.svg");
-    adi_item_dot_v_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_dot_v_->setZValue(adi_dots_z_);
-    adi_item_dot_v_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
-    adi_item_dot_v_->moveBy(adi_scale_x_ * adi_original_dot_v_pos_.x(),
-                            adi_scale_y_ * adi_original_dot_v_pos_.y());
+    adi_item_dot_v_->setPos(adi_original_dot_v_pos_);
     adi_scene_->addItem(adi_item_dot_v_);
 
-    adi_item_scale_h_ = new QGraphicsSvgItem(
+    adi_item_scale_h_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_scale_h.svg");
-    adi_item_scale_h_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_scale_h_->setZValue(adi_scales_z_);
-    adi_item_scale_h_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
-    adi_item_scale_h_->moveBy(adi_scale_x_ * adi_original_scale_h_pos_.x(),
-                              adi_scale_y_ * adi_original_scale_h_pos_.y());
+    adi_item_scale_h_->setPos(adi_original_scale_h_pos_);
     adi_scene_->addItem(adi_item_scale_h_);
 
-    adi_item_scale_v_ = new QGraphicsSvgItem(
+    adi_item_scale_v_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_scale_v.svg");
-    adi_item_scale_v_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_scale_v_->setZValue(adi_scales_z_);
-    adi_item_scale_v_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
-    adi_item_scale_v_->moveBy(adi_scale_x_ * adi_original_scale_v_pos_.x(),
-                              adi_scale_y_ * adi_original_scale_v_pos_.y());
+    adi_item_scale_v_->setPos(adi_original_scale_v_pos_);
     adi_scene_->addItem(adi_item_scale_v_);
 
-    adi_item_mask_ = new QGraphicsSvgItem(
+    adi_item_mask_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_adi_mask.svg");
-    adi_item_mask_->setCacheMode(QGraphicsItem::NoCache);
     adi_item_mask_->setZValue(adi_mask_z_);
-    adi_item_mask_->setTransform(
-        QTransform::fromScale(adi_scale_x_, adi_scale_y_), true);
     adi_scene_->addItem(adi_item_mask_);
 
-    updateADI(scale_x, scale_y);
+    setADICacheMode(adi_cache_mode_);
+
+    updateADI();
 }
 
-void FCSInstrucmentPFD::PanelADI::updateADI(float scale_x, float scale_y)
+void FCSInstrucmentPFD::PanelADI::updateADI(void)
 {
-    adi_scale_x_ = scale_x;
-    adi_scale_y_ = scale_y;
+    if (!adi_dirty_) {
+        return ;
+    }
+    else {
+        ;
+    }
 
     float delta    = adi_original_pix_per_deg_ * adi_angle_pitch_;
     float roll_rad = M_PI * adi_angle_roll_ / 180.0f;
@@ -447,34 +540,71 @@ void FCSInstrucmentPFD::PanelADI::updateADI(float scale_x, float scale_y)
     float roll_sin = sin(roll_rad);
     float roll_cos = cos(roll_rad);
 
-    updateADILadd(delta, roll_sin, roll_cos);
-    updateADILaddBack(delta, roll_sin, roll_cos);
-    updateADIAngleRoll();
-    updateADiSlipSkip(roll_sin, roll_cos);
-    updateADITurnRate();
-    updateADIBars();
-    updateADIDots();
-    updateADIFlightPath();
-
-    adi_ladd_delta_x_old_      = adi_ladd_delta_x_new_;
-    adi_ladd_delta_y_old_      = adi_ladd_delta_y_new_;
-    adi_ladd_back_delta_x_old_ = adi_ladd_back_delta_x_new_;
-    adi_ladd_back_delta_y_old_ = adi_ladd_back_delta_y_new_;
-    adi_slip_delta_x_old_      = adi_slip_delta_x_new_;
-    adi_slip_delta_y_old_      = adi_slip_delta_y_new_;
-    adi_turn_delta_x_old_      = adi_turn_delta_x_new_;
-    adi_path_delta_x_old_      = adi_path_delta_x_new_;
-    adi_path_delta_y_old_      = adi_path_delta_y_new_;
-    adi_mark_delta_x_old_      = adi_mark_delta_x_new_;
-    adi_mark_delta_y_old_      = adi_mark_delta_y_new_;
-    adi_bar_h_delta_x_old_     = adi_bar_h_delta_x_new_;
-    adi_bar_v_delta_y_old_     = adi_bar_v_delta_y_new_;
-    adi_dot_h_delta_x_old_     = adi_dot_h_delta_x_new_;
-    adi_dot_v_delta_y_old_     = adi_dot_v_delta_y_new_;
+    if (adi_dirty_attitude_) {
+        updateADILadd(delta, roll_sin, roll_cos);
+        updateADILaddBack(delta, roll_sin, roll_cos);
+        updateADIAngleRoll();
+    }
+    else {
+        ;
+    }
+
+    if (adi_dirty_slip_) {
+        updateADiSlipSkip(roll_sin, roll_cos);
+    }
+    else {
+        ;
+    }
+
+    if (adi_dirty_turn_) {
+        updateADITurnRate();
+    }
+    else {
+        ;
+    }
+
+    if (adi_dirty_bars_) {
+        updateADIBars();
+    }
+    else {
+        ;
+    }
+
+    if (adi_dirty_dots_) {
+        updateADIDots();
+    }
+    else {
+        ;
+    }
+
+    if (adi_dirty_path_) {
+        updateADIFlightPath();
+    }
+    else {
+        ;
+    }
+
+    if (adi_dirty_terrain_ || adi_dirty_attitude_) {
+        updateADITerrain();
+    }
+    else {
+        ;
+    }
+
+    adi_dirty_          = false;
+    adi_dirty_attitude_ = false;
+    adi_dirty_slip_     = false;
+    adi_dirty_turn_     = false;
+    adi_dirty_path_     = false;
+    adi_dirty_bars_     = false;
+    adi_dirty_dots_     = false;
+    adi_dirty_terrain_  = false;
 }
 
 void FCSInstrucmentPFD::PanelADI::setADIAngleRoll(float angle_roll)
 {
+    float angle_roll_old = adi_angle_roll_;
+
     adi_angle_roll_ = angle_roll;
 
     if (adi_angle_roll_ < -180.0f) {
@@ -486,10 +616,21 @@ void FCSInstrucmentPFD::PanelADI::setADIAngleRoll(float angle_roll)
     else {
         ;
     }
+
+    if (adi_angle_roll_ != angle_roll_old) {
+        adi_dirty_          = true;
+        adi_dirty_attitude_ = true;
+        adi_dirty_slip_     = true;
+    }
+    else {
+        ;
+    }
 }
 
 void FCSInstrucmentPFD::PanelADI::setADIAnglePitch(float angle_pitch)
 {
+    float angle_pitch_old = adi_angle_pitch_;
+
     adi_angle_pitch_ = angle_pitch;
 
     if (adi_angle_pitch_ < -90.0f) {
@@ -501,12 +642,25 @@ void FCSInstrucmentPFD::PanelADI::setADIAnglePitch(float angle_pitch)
     else {
         ;
     }
+
+    if (adi_angle_pitch_ != angle_pitch_old) {
+        adi_dirty_          = true;
+        adi_dirty_attitude_ = true;
+    }
+    else {
+        ;
+    }
 }
 
 void FCSInstrucmentPFD::PanelADI::setADIFlightPathMarker(float angle_attack,
                                                          float angle_sideslip,
                                                          bool  visible)
 {
+    float angle_attack_old   = adi_angle_attack_;
+    float angle_sideslip_old = adi_angle_sideslip_;
+    bool  path_valid_old     = adi_path_valid_;
+    bool  path_visible_old   = adi_path_visible_;
+
     adi_angle_attack_   = angle_attack;
     adi_angle_sideslip_ = angle_sideslip;
 
@@ -537,10 +691,23 @@ void FCSInstrucmentPFD::PanelADI::setADIFlightPathMarker(float angle_attack,
     }
 
     adi_path_visible_ = visible;
+
+    if (adi_angle_attack_ != angle_attack_old ||
+        adi_angle_sideslip_ != angle_sideslip_old ||
+        adi_path_valid_ != path_valid_old ||
+        adi_path_visible_ != path_visible_old) {
+        adi_dirty_      = true;
+        adi_dirty_path_ = true;
+    }
+    else {
+        ;
+    }
 }
 
 void FCSInstrucmentPFD::PanelADI::setADISlipSkid(float slip_skid)
 {
+    float slip_skid_old = adi_slip_skid_;
+
     adi_slip_skid_ = slip_skid;
 
     if (adi_slip_skid_ < -1.0f) {
@@ -552,10 +719,20 @@ void FCSInstrucmentPFD::PanelADI::setADISlipSkid(float slip_skid)
     else {
         ;
     }
+
+    if (adi_slip_skid_ != slip_skid_old) {
+        adi_dirty_      = true;
+        adi_dirty_slip_ = true;
+    }
+    else {
+        ;
+    }
 }
 
 void FCSInstrucmentPFD::PanelADI::setADITurnRate(float turn_rate)
 {
+    float turn_rate_old = adi_turn_rate_;
+
     adi_turn_rate_ = turn_rate;
 
     if (adi_turn_rate_ < -1.0f) {
@@ -567,11 +744,22 @@ void FCSInstrucmentPFD::PanelADI::setADITurnRate(float turn_rate)
     else {
         ;
     }
+
+    if (adi_turn_rate_ != turn_rate_old) {
+        adi_dirty_      = true;
+        adi_dirty_turn_ = true;
+    }
+    else {
+        ;
+    }
 }
 
 void FCSInstrucmentPFD::PanelADI::setADIDeviateBarPositionH(float bar_h,
                                                             bool  visible)
 {
+    float bar_h_old         = adi_bar_h_;
+    bool  bar_h_visible_old = adi_bar_h_visible_;
+
     adi_bar_h_ = bar_h;
 
     if (adi_bar_h_ < -1.0f) {
@@ -585,11 +773,23 @@ void FCSInstrucmentPFD::PanelADI::setADIDeviateBarPositionH(float bar_h,
     }
 
     adi_bar_h_visible_ = visible;
+
+    if (adi_bar_h_ != bar_h_old ||
+        adi_bar_h_visible_ != bar_h_visible_old) {
+        adi_dirty_      = true;
+        adi_dirty_bars_ = true;
+    }
+    else {
+        ;
+    }
 }
 
 void FCSInstrucmentPFD::PanelADI::setADIDeviateBarPositionV(float bar_v,
                                                             bool  visible)
 {
+    float bar_v_old         = adi_bar_v_;
+    bool  bar_v_visible_old = adi_bar_v_visible_;
+
     adi_bar_v_ = bar_v;
 
     if (adi_bar_v_ < -1.0f) {
@@ -603,11 +803,23 @@ void FCSInstrucmentPFD::PanelADI::setADIDeviateBarPositionV(float bar_v,
     }
 
     adi_bar_v_visible_ = visible;
+
+    if (adi_bar_v_ != bar_v_old ||
+        adi_bar_v_visible_ != bar_v_visible_old) {
+        adi_dirty_      = true;
+        adi_dirty_bars_ = true;
+    }
+    else {
+        ;
+    }
 }
 
 void FCSInstrucmentPFD::PanelADI::setADIDeviateDotPositionH(float dot_h,
                                                             bool  visible)
 {
+    float dot_h_old         = adi_dot_h_;
+    bool  dot_h_visible_old = adi_dot_h_visible_;
+
     adi_dot_h_ = dot_h;
 
     if (adi_dot_h_ < -1.0f) {
@@ -621,11 +833,23 @@ void FCSInstrucmentPFD::PanelADI::setADIDeviateDotPositionH(float dot_h,
     }
 
     adi_dot_h_visible_ = visible;
+
+    if (adi_dot_h_ != dot_h_old ||
+        adi_dot_h_visible_ != dot_h_visible_old) {
+        adi_dirty_      = true;
+        adi_dirty_dots_ = true;
+    }
+    else {
+        ;
+    }
 }
 
 void FCSInstrucmentPFD::PanelADI::setADIDeviateDotPositionV(float dot_v,
                                                             bool  visible)
 {
+    float dot_v_old         = adi_dot_v_;
+    bool  dot_v_visible_old = adi_dot_v_visible_;
+
     adi_dot_v_ = dot_v;
 
     if (adi_dot_v_ < -1.0f) {
@@ -639,11 +863,94 @@ void FCSInstrucmentPFD::PanelADI::setADIDeviateDotPositionV(float dot_v,
     }
 
     adi_dot_v_visible_ = visible;
+
+    if (adi_dot_v_ != dot_v_old ||
+        adi_dot_v_visible_ != dot_v_visible_old) {
+        adi_dirty_      = true;
+        adi_dirty_dots_ = true;
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentPFD::PanelADI::setADITerrainMap(
+    const FCSInstrucmentTerrainMap *terrain_map)
+{
+    adi_terrain_map_ = terrain_map;
+
+    if (!adi_item_terrain_) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    adi_item_terrain_->setTerrainMap(adi_terrain_map_);
+    adi_item_terrain_->setVisible(adi_terrain_map_ != 0 &&
+                                  adi_terrain_map_->isTerrainValid());
+
+    adi_dirty_         = true;
+    adi_dirty_terrain_ = true;
+}
+
+void FCSInstrucmentPFD::PanelADI::setADIPosition(float x, float y, float z)
+{
+    if (x != adi_position_x_ || y != adi_position_y_ ||
+        z != adi_position_z_) {
+        adi_position_x_ = x;
+        adi_position_y_ = y;
+        adi_position_z_ = z;
+
+        adi_dirty_         = true;
+        adi_dirty_terrain_ = true;
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentPFD::PanelADI::setADIHeading(float heading)
+{
+    if (heading != adi_heading_) {
+        adi_heading_ = heading;
+
+        adi_dirty_         = true;
+        adi_dirty_terrain_ = true;
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentPFD::PanelADI::setADICacheMode(
+    QGraphicsItem::CacheMode cache_mode)
+{
+    adi_cache_mode_ = cache_mode;
+
+    if (!adi_item_turn_) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    adi_item_turn_->setCacheMode(adi_cache_mode_);
+    adi_item_path_->setCacheMode(adi_cache_mode_);
+    adi_item_mark_->setCacheMode(adi_cache_mode_);
+    adi_item_bar_h_->setCacheMode(adi_cache_mode_);
+    adi_item_bar_v_->setCacheMode(adi_cache_mode_);
+    adi_item_dot_h_->setCacheMode(adi_cache_mode_);
+    adi_item_dot_v_->setCacheMode(adi_cache_mode_);
+    adi_item_scale_h_->setCacheMode(adi_cache_mode_);
+    adi_item_scale_v_->setCacheMode(adi_cache_mode_);
+    adi_item_mask_->setCacheMode(adi_cache_mode_);
 }
 
 void FCSInstrucmentPFD::PanelADI::resetADI(void)
 {
     adi_item_back_    = 0;
+    adi_item_terrain_ = 0;
     adi_item_ladd_    = 0;
     adi_item_roll_    = 0;
     adi_item_slip_    = 0;
@@ -658,54 +965,14 @@ void FCSInstrucmentPFD::PanelADI::resetADI(void)
     adi_item_scale_h_ = 0;
     adi_item_scale_v_ = 0;
 
-    adi_angle_roll_     = 0.0f;
-    adi_angle_pitch_    = 0.0f;
-    adi_angle_attack_   = 0.0f;
-    adi_angle_sideslip_ = 0.0f;
-    adi_slip_skid_      = 0.0f;
-    adi_turn_rate_      = 0.0f;
-    adi_bar_h_          = 0.0f;
-    adi_bar_v_          = 0.0f;
-    adi_dot_h_          = 0.0f;
-    adi_dot_v_          = 0.0f;
-
-    adi_path_valid_    = true;
-    adi_path_visible_  = true;
-    adi_bar_h_visible_ = true;
-    adi_bar_v_visible_ = true;
-    adi_dot_h_visible_ = true;
-    adi_dot_v_visible_ = true;
-
-    adi_ladd_delta_x_new_      = 0.0f;
-    adi_ladd_delta_x_old_      = 0.0f;
-    adi_ladd_delta_y_new_      = 0.0f;
-    adi_ladd_delta_y_old_      = 0.0f;
-    adi_ladd_back_delta_x_new_ = 0.0f;
-    adi_ladd_back_delta_x_old_ = 0.0f;
-    adi_ladd_back_delta_y_new_ = 0.0f;
-    adi_ladd_back_delta_y_old_ = 0.0f;
-    adi_slip_delta_x_new_      = 0.0f;
-    adi_slip_delta_x_old_      = 0.0f;
-    adi_slip_delta_y_new_      = 0.0f;
-    adi_slip_delta_y_old_      = 0.0f;
-    adi_turn_delta_x_new_      = 0.0f;
-    adi_turn_delta_x_old_      = 0.0f;
-    adi_path_delta_x_new_      = 0.0f;
-    adi_path_delta_x_old_      = 0.0f;
-    adi_path_delta_y_new_      = 0.0f;
-    adi_path_delta_y_old_      = 0.0f;
-    adi_mark_delta_x_new_      = 0.0f;
-    adi_mark_delta_x_old_      = 0.0f;
-    adi_mark_delta_y_new_      = 0.0f;
-    adi_mark_delta_y_old_      = 0.0f;
-    adi_bar_h_delta_x_new_     = 0.0f;
-    adi_bar_h_delta_x_old_     = 0.0f;
-    adi_bar_v_delta_y_new_     = 0.0f;
-    adi_bar_v_delta_y_old_     = 0.0f;
-    adi_dot_h_delta_x_new_     = 0.0f;
-    adi_dot_h_delta_x_old_     = 0.0f;
-    adi_dot_v_delta_y_new_     = 0.0f;
-    adi_dot_v_delta_y_old_     = 0.0f;
+    adi_dirty_          = true;
+    adi_dirty_attitude_ = true;
+    adi_dirty_slip_     = true;
+    adi_dirty_turn_     = true;
+    adi_dirty_path_     = true;
+    adi_dirty_bars_     = true;
+    adi_dirty_dots_     = true;
+    adi_dirty_terrain_  = true;
 }
 
 void FCSInstrucmentPFD::PanelADI::updateADILadd(float delta,
@@ -713,14 +980,11 @@ void FCSInstrucmentPFD::PanelADI::updateADILadd(float delta,
                                                 float roll_cos)
 {
     adi_item_ladd_->setRotation(-adi_angle_roll_);
-
-    adi_ladd_delta_x_new_ = adi_scale_x_ * delta * roll_sin;
-    adi_ladd_delta_y_new_ = adi_scale_y_ * delta * roll_cos;
-
-    adi_item_ladd_->moveBy(adi_ladd_delta_x_new_ - adi_ladd_delta_x_old_,
-                           adi_ladd_delta_y_new_ - adi_ladd_delta_y_old_);
+    adi_item_ladd_->setPos(adi_original_ladd_pos_.x() + delta * roll_sin,
+                           adi_original_ladd_pos_.y() + delta * roll_cos);
 }
 
+
 void FCSInstrucmentPFD::PanelADI::updateADILaddBack(float delta,
                                                     float roll_sin,
                                                     float roll_cos)
@@ -739,14 +1003,12 @@ void FCSInstrucmentPFD::PanelADI::updateADILaddBack(float delta,
         delta_ladd_back = delta;
     }
 
-    adi_ladd_back_delta_x_new_ = adi_scale_x_ * delta_ladd_back * roll_sin;
-    adi_ladd_back_delta_y_new_ = adi_scale_y_ * delta_ladd_back * roll_cos;
-
-    adi_item_back_->moveBy(
-        adi_ladd_back_delta_x_new_ - adi_ladd_back_delta_x_old_,
-        adi_ladd_back_delta_y_new_ - adi_ladd_back_delta_y_old_);
+    adi_item_back_->setPos(
+        adi_original_back_pos_.x() + delta_ladd_back * roll_sin,
+        adi_original_back_pos_.y() + delta_ladd_back * roll_cos);
 }
 
+
 void FCSInstrucmentPFD::PanelADI::updateADIAngleRoll(void)
 {
     adi_item_roll_->setRotation(-adi_angle_roll_);
@@ -759,117 +1021,113 @@ void FCSInstrucmentPFD::PanelADI::updateADiSlipSkip(float roll_sin,
 
     float delta_slip = adi_max_slip_deflection_ * adi_slip_skid_;
 
-    adi_slip_delta_x_new_ =  adi_scale_x_ * delta_slip * roll_cos;
-    adi_slip_delta_y_new_ = -adi_scale_y_ * delta_slip * roll_sin;
-
-    adi_item_slip_->moveBy(adi_slip_delta_x_new_ - adi_slip_delta_x_old_,
-                           adi_slip_delta_y_new_ - adi_slip_delta_y_old_);
+    adi_item_slip_->setPos(adi_original_slip_pos_.x() + delta_slip * roll_cos,
+                           adi_original_slip_pos_.y() - delta_slip * roll_sin);
 }
 
+
 void FCSInstrucmentPFD::PanelADI::updateADITurnRate(void)
 {
-    adi_turn_delta_x_new_ = adi_scale_x_ * adi_max_turn_deflection_ *
-        adi_turn_rate_;
-    adi_item_turn_->moveBy(adi_turn_delta_x_new_ - adi_turn_delta_x_old_, 0.0);
+    adi_item_turn_->setPos(
+        adi_original_turn_pos_.x() + adi_max_turn_deflection_ * adi_turn_rate_,
+        adi_original_turn_pos_.y());
 }
 
+
 void FCSInstrucmentPFD::PanelADI::updateADIFlightPath(void)
 {
     if (adi_path_visible_) {
+        QPointF path_pos(
+            adi_original_path_pos_.x() +
+            adi_original_pix_per_deg_ * adi_angle_sideslip_,
+            adi_original_path_pos_.y() +
+            adi_original_pix_per_deg_ * adi_angle_attack_);
         adi_item_path_->setVisible(true);
-        adi_path_delta_x_new_ = adi_scale_x_ * adi_original_pix_per_deg_ *
-            adi_angle_sideslip_;
-        adi_path_delta_y_new_ = adi_scale_y_ * adi_original_pix_per_deg_ *
-            adi_angle_attack_;
-        adi_item_path_->moveBy(adi_path_delta_x_new_ - adi_path_delta_x_old_,
-                               adi_path_delta_y_new_ - adi_path_delta_y_old_);
+        adi_item_path_->setPos(path_pos);
         if (!adi_path_valid_) {
             adi_item_mark_->setVisible(true);
-            adi_mark_delta_x_new_ = adi_path_delta_x_new_;
-            adi_mark_delta_y_new_ = adi_path_delta_y_new_;
-            adi_item_mark_->moveBy(
-                adi_mark_delta_x_new_ - adi_mark_delta_x_old_,
-                adi_mark_delta_y_new_ - adi_mark_delta_y_old_);
+            adi_item_mark_->setPos(path_pos);
         }
         else {
             adi_item_mark_->setVisible(false);
-            adi_mark_delta_x_new_ = adi_mark_delta_x_old_;
-            adi_mark_delta_y_new_ = adi_mark_delta_y_old_;
         }
     }
     else {
         adi_item_path_->setVisible(false);
-        adi_path_delta_x_new_ = adi_path_delta_x_old_;
-        adi_path_delta_y_new_ = adi_path_delta_y_old_;
-
         adi_item_mark_->setVisible(false);
-        adi_mark_delta_x_new_ = adi_mark_delta_x_old_;
-        adi_mark_delta_y_new_ = adi_mark_delta_y_old_;
     }
 }
 
+
 void FCSInstrucmentPFD::PanelADI::updateADIBars(void)
 {
     if (adi_bar_v_visible_) {
         adi_item_bar_v_->setVisible(true);
-        adi_bar_v_delta_y_new_ = adi_scale_y_ * adi_max_bars_deflection_ *
-            adi_bar_v_;
-        adi_item_bar_v_->moveBy(
-            0.0f,
-            adi_bar_v_delta_y_old_ - adi_bar_v_delta_y_new_);
+        adi_item_bar_v_->setPos(
+            adi_original_bar_v_pos_.x(),
+            adi_original_bar_v_pos_.y() -
+            adi_max_bars_deflection_ * adi_bar_v_);
     }
     else {
         adi_item_bar_v_->setVisible(false);
-        adi_bar_v_delta_y_new_ = adi_bar_v_delta_y_old_;
     }
 
     if (adi_bar_h_visible_) {
         adi_item_bar_h_->setVisible(true);
-        adi_bar_h_delta_x_new_ = adi_scale_x_ * adi_max_bars_deflection_ *
-            adi_bar_h_;
-        adi_item_bar_h_->moveBy(
-            adi_bar_h_delta_x_new_ - adi_bar_h_delta_x_old_,
-            0.0f);
+        adi_item_bar_h_->setPos(
+            adi_original_bar_h_pos_.x() + adi_max_bars_deflection_ * adi_bar_h_,
+            adi_original_bar_h_pos_.y());
     }
     else {
         adi_item_bar_h_->setVisible(false);
-        adi_bar_h_delta_x_new_ = adi_bar_h_delta_x_old_;
     }
 }
 
+
 void FCSInstrucmentPFD::PanelADI::updateADIDots(void)
 {
     if (adi_dot_h_visible_) {
         adi_item_dot_h_->setVisible(true);
         adi_item_scale_h_->setVisible(true);
-        adi_dot_h_delta_x_new_ = adi_scale_x_ * adi_max_dots_deflection_ *
-            adi_dot_h_;
-        adi_item_dot_h_->moveBy(
-            adi_dot_h_delta_x_new_ - adi_dot_h_delta_x_old_,
-            0.0f);
+        adi_item_dot_h_->setPos(
+            adi_original_dot_h_pos_.x() + adi_max_dots_deflection_ * adi_dot_h_,
+            adi_original_dot_h_pos_.y());
     }
     else {
         adi_item_dot_h_->setVisible(false);
         adi_item_scale_h_->setVisible(false);
-        adi_dot_h_delta_x_new_ = adi_dot_h_delta_x_old_;
     }
 
     if (adi_dot_v_visible_) {
         adi_item_dot_v_->setVisible(true);
         adi_item_scale_v_->setVisible(true);
-        adi_dot_v_delta_y_new_ = adi_scale_y_ * adi_max_dots_deflection_ *
-            adi_dot_v_;
-        adi_item_dot_v_->moveBy(
-            0.0f,
-            adi_dot_v_delta_y_old_ - adi_dot_v_delta_y_new_);
+        adi_item_dot_v_->setPos(
+            adi_original_dot_v_pos_.x(),
+            adi_original_dot_v_pos_.y() -
+            adi_max_dots_deflection_ * adi_dot_v_);
     }
     else {
         adi_item_dot_v_->setVisible(false);
         adi_item_scale_v_->setVisible(false);
-        adi_dot_v_delta_y_new_ = adi_dot_v_delta_y_old_;
     }
 }
 
+void FCSInstrucmentPFD::PanelADI::updateADITerrain(void)
+{
+    if (!adi_item_terrain_->isVisible()) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    adi_item_terrain_->setRotation(-adi_angle_roll_);
+    adi_item_terrain_->setTerrainPose(adi_position_x_, adi_position_y_,
+                                      adi_position_z_, adi_heading_,
+                                      adi_angle_pitch_);
+}
+
+
 /*****************************************************************************/
 
 FCSInstrucmentPFD::PanelALT::PanelALT(QGraphicsScene *scene) :
@@ -884,22 +1142,16 @@ FCSInstrucmentPFD::PanelALT::PanelALT(QGraphicsScene *scene) :
     alt_item_frame_   (0),
     alt_item_altitude_(0),
     alt_item_pressure_(0),
+    alt_cache_mode_(QGraphicsItem::NoCache),
+    alt_dirty_         (true),
+    alt_dirty_altitude_(true),
+    alt_dirty_pressure_(true),
     alt_frame_text_color_(255, 255, 255),
     alt_press_text_color_(  0, 255,   0),
     alt_labels_color_    (255, 255, 255),
     alt_altitude_(0.0f),
     alt_pressure_(0.0f),
     alt_pressure_unit_(0),
-    alt_scale1_delta_y_new_(0.0f),
-    alt_scale1_delta_y_old_(0.0f),
-    alt_scale2_delta_y_new_(0.0f),
-    alt_scale2_delta_y_old_(0.0f),
-    alt_ground_delta_y_new_(0.0f),
-    alt_ground_delta_y_old_(0.0f),
-    alt_labels_delta_y_new_(0.0f),
-    alt_labels_delta_y_old_(0.0f),
-    alt_scale_x_(1.0f),
-    alt_scale_y_(1.0f),
     alt_original_pix_per_alt_ (0.150f),
     alt_original_scale_height_(300.0f),
     alt_original_labels_x_    (250.0f),
@@ -937,162 +1189,107 @@ FCSInstrucmentPFD::PanelALT::~PanelALT()
 {
 }
 
-void FCSInstrucmentPFD::PanelALT::initALT(float scale_x, float scale_y)
+void FCSInstrucmentPFD::PanelALT::initALT(void)
 {
-    alt_scale_x_ = scale_x;
-    alt_scale_y_ = scale_y;
-
     resetALT();
 
-    alt_item_back_ = new QGraphicsSvgItem(
+    alt_item_back_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_alt_back.svg");
-    alt_item_back_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_back_->setZValue(alt_back_z_);
-    alt_item_back_->setTransform(
-        QTransform::fromScale(alt_scale_x_, alt_scale_y_),
-        true);
-    alt_item_back_->moveBy(alt_scale_x_ * alt_original_back_pos_.x(),
-                           alt_scale_y_ * alt_original_back_pos_.y());
+    alt_item_back_->setPos(alt_original_back_pos_);
     alt_scene_->addItem(alt_item_back_);
 
-    alt_item_scale1_ = new QGraphicsSvgItem(
+    alt_item_scale1_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_alt_scale.svg");
-    alt_item_scale1_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_scale1_->setZValue(alt_scale_z_);
-    alt_item_scale1_->setTransform(
-        QTransform::fromScale(alt_scale_x_, alt_scale_y_),
-        true);
-    alt_item_scale1_->moveBy(alt_scale_x_ * alt_original_scale1_pos_.x(),
-                             alt_scale_y_ * alt_original_scale1_pos_.y());
+    alt_item_scale1_->setPos(alt_original_scale1_pos_);
     alt_scene_->addItem(alt_item_scale1_);
 
-    alt_item_scale2_ = new QGraphicsSvgItem(
+    alt_item_scale2_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_alt_scale.svg");
-    alt_item_scale2_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_scale2_->setZValue(alt_scale_z_);
-    alt_item_scale2_->setTransform(
-        QTransform::fromScale(alt_scale_x_, alt_scale_y_),
-        true);
-    alt_item_scale2_->moveBy(alt_scale_x_ * alt_original_scale2_pos_.x(),
-                             alt_scale_y_ * alt_original_scale2_pos_.y());
+    alt_item_scale2_->setPos(alt_original_scale2_pos_);
     alt_scene_->addItem(alt_item_scale2_);
 
-    alt_item_label1_ = new QGraphicsTextItem(QString("99999"));
-    alt_item_label1_->setCacheMode(QGraphicsItem::NoCache);
+    alt_item_label1_ = new FCSInstrucmentDigitItem(alt_labels_font_,
+                                                   alt_labels_color_, 6);
     alt_item_label1_->setZValue(alt_labels_z_);
-    alt_item_label1_->setDefaultTextColor(alt_labels_color_);
-    alt_item_label1_->setFont(alt_labels_font_);
-    alt_item_label1_->setTransform(
-        QTransform::fromScale(alt_scale_x_, alt_scale_y_),
-        true);
-    alt_item_label1_->moveBy(
-        alt_scale_x_ * (alt_original_labels_x_ -
-                        alt_item_label1_->boundingRect().width()  / 2.0f),
-        alt_scale_y_ * (alt_original_label1_y_ -
-                        alt_item_label1_->boundingRect().height() / 2.0f));
     alt_scene_->addItem(alt_item_label1_);
 
-    alt_item_label2_ = new QGraphicsTextItem(QString("99999"));
-    alt_item_label2_->setCacheMode(QGraphicsItem::NoCache);
+    alt_item_label2_ = new FCSInstrucmentDigitItem(alt_labels_font_,
+                                                   alt_labels_color_, 6);
     alt_item_label2_->setZValue(alt_labels_z_);
-    alt_item_label2_->setDefaultTextColor(alt_labels_color_);
-    alt_item_label2_->setFont(alt_labels_font_);
-    alt_item_label2_->setTransform(
-        QTransform::fromScale(alt_scale_x_, alt_scale_y_),
-        true);
-    alt_item_label2_->moveBy(
-        alt_scale_x_ * (alt_original_labels_x_ -
-                        alt_item_label2_->boundingRect().width()  / 2.0f),
-        alt_scale_y_ * (alt_original_label2_y_ -
-                        alt_item_label2_->boundingRect().height() / 2.0f));
     alt_scene_->addItem(alt_item_label2_);
 
-    alt_item_label3_ = new QGraphicsTextItem(QString("99999"));
-    alt_item_label3_->setCacheMode(QGraphicsItem::NoCache);
+    alt_item_label3_ = new FCSInstrucmentDigitItem(alt_labels_font_,
+                                                   alt_labels_color_, 6);
     alt_item_label3_->setZValue(alt_labels_z_);
-    alt_item_label3_->setDefaultTextColor(alt_labels_color_);
-    alt_item_label3_->setFont(alt_labels_font_);
-    alt_item_label3_->setTransform(
-        QTransform::fromScale(alt_scale_x_, alt_scale_y_),
-        true);
-    alt_item_label3_->moveBy(
-        alt_scale_x_ * (alt_original_labels_x_ -
-                        alt_item_label3_->boundingRect().width()  / 2.0f),
-        alt_scale_y_ * (alt_original_label3_y_ -
-                        alt_item_label3_->boundingRect().height() / 2.0f));
     alt_scene_->addItem(alt_item_label3_);
 
-    alt_item_ground_ = new QGraphicsSvgItem(
+    alt_item_ground_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_alt_ground.svg");
-    alt_item_ground_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_ground_->setZValue(alt_ground_z_);
-    alt_item_ground_->setTransform(
-        QTransform::fromScale(alt_scale_x_, alt_scale_y_),
-        true);
-    alt_item_ground_->moveBy(alt_scale_x_ * alt_original_ground_pos_.x(),
-                             alt_scale_y_ * alt_original_ground_pos_.y());
+    alt_item_ground_->setPos(alt_original_ground_pos_);
     alt_scene_->addItem(alt_item_ground_);
 
-    alt_item_frame_ = new QGraphicsSvgItem(
+    alt_item_frame_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_alt_frame.svg");
-    alt_item_frame_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_frame_->setZValue(alt_frame_z_);
-    alt_item_frame_->setTransform(
-        QTransform::fromScale(alt_scale_x_, alt_scale_y_),
-        true);
-    alt_item_frame_->moveBy(alt_scale_x_ * alt_original_frame_pos_.x(),
-                            alt_scale_y_ * alt_original_frame_pos_.y());
+    alt_item_frame_->setPos(alt_original_frame_pos_);
     alt_scene_->addItem(alt_item_frame_);
 
-    alt_item_altitude_ = new QGraphicsTextItem(QString("0"));
+    alt_item_altitude_ = new FCSInstrucmentDigitItem(alt_frame_text_font_,
+                                                     alt_frame_text_color_, 5);
     alt_item_altitude_->setCacheMode(QGraphicsItem::NoCache);
     alt_item_altitude_->setZValue(alt_frame_text_z_);
-    alt_item_altitude_->setDefaultTextColor(alt_frame_text_color_);
-    alt_item_altitude_->setFont(alt_frame_text_font_);
-    alt_item_altitude_->setTransform(
-        QTransform::fromScale(alt_scale_x_, alt_scale_y_),
-        true);
-    alt_item_altitude_->moveBy(
-        alt_scale_x_ * (alt_original_altitude_ctr_.x() -
-                        alt_item_altitude_->boundingRect().width()  / 2.0f),
-        alt_scale_y_ * (alt_original_altitude_ctr_.y() -
-                        alt_item_altitude_->boundingRect().height() / 2.0f));
+    alt_item_altitude_->setDigitNumber(0);
+    alt_item_altitude_->setDigitCenter(alt_original_altitude_ctr_);
     alt_scene_->addItem(alt_item_altitude_);
 
-    alt_item_pressure_ = new QGraphicsTextItem(QString("STD"));
-    alt_item_pressure_->setCacheMode(QGraphicsItem::NoCache);
+    alt_item_pressure_ = new FCSInstrucmentDigitItem(alt_frame_text_font_,
+                                                     alt_press_text_color_, 10);
     alt_item_pressure_->setZValue(alt_frame_text_z_);
-    alt_item_pressure_->setDefaultTextColor(alt_press_text_color_);
-    alt_item_pressure_->setFont(alt_frame_text_font_);
-    alt_item_pressure_->setTransform(
-        QTransform::fromScale(alt_scale_x_, alt_scale_y_),
-        true);
-    alt_item_pressure_->moveBy(
-        alt_scale_x_ * (alt_original_pressure_ctr_.x() -
-                        alt_item_pressure_->boundingRect().width()  / 2.0f),
-        alt_scale_y_ * (alt_original_pressure_ctr_.y() -
-                        alt_item_pressure_->boundingRect().height() / 2.0f));
+    alt_item_pressure_->setDigitText("STD");
+    alt_item_pressure_->setDigitCenter(alt_original_pressure_ctr_);
     alt_scene_->addItem(alt_item_pressure_);
 
-    updateALT(scale_x, scale_y);
+    setALTCacheMode(alt_cache_mode_);
+
+    updateALT();
 }
 
-void FCSInstrucmentPFD::PanelALT::updateALT(float scale_x, float scale_y)
+void FCSInstrucmentPFD::PanelALT::updateALT(void)
 {
-    alt_scale_x_ = scale_x;
-    alt_scale_y_ = scale_y;
+    if (!alt_dirty_) {
+        return ;
+    }
+    else {
+        ;
+    }
 
-    updateALTAltitude();
-    updateALTPressure();
+    if (alt_dirty_altitude_) {
+        updateALTAltitude();
+    }
+    else {
+        ;
+    }
+
+    if (alt_dirty_pressure_) {
+        updateALTPressure();
+    }
+    else {
+        ;
+    }
 
-    alt_scale1_delta_y_old_ = alt_scale1_delta_y_new_;
-    alt_scale2_delta_y_old_ = alt_scale2_delta_y_new_;
-    alt_ground_delta_y_old_ = alt_ground_delta_y_new_;
-    alt_labels_delta_y_old_ = alt_labels_delta_y_new_;
+    alt_dirty_          = false;
+    alt_dirty_altitude_ = false;
+    alt_dirty_pressure_ = false;
 }
 
 void FCSInstrucmentPFD::PanelALT::setALTAltitude(float altitude)
 {
+    float altitude_old = alt_altitude_;
+
     alt_altitude_ = altitude;
 
     if (alt_altitude_ < 0.0f) {
@@ -1104,11 +1301,22 @@ void FCSInstrucmentPFD::PanelALT::setALTAltitude(float altitude)
     else {
         ;
     }
+
+    if (alt_altitude_ != altitude_old) {
+        alt_dirty_          = true;
+        alt_dirty_altitude_ = true;
+    }
+    else {
+        ;
+    }
 }
 
 void FCSInstrucmentPFD::PanelALT::setALTPressure(float pressure,
                                                  int   pressure_unit)
 {
+    float pressure_old      = alt_pressure_;
+    int   pressure_unit_old = alt_pressure_unit_;
+
     alt_pressure_ = pressure;
 
     if (alt_pressure_ < 0.0f) {
@@ -1132,6 +1340,38 @@ void FCSInstrucmentPFD::PanelALT::setALTPressure(float pressure,
     else {
         ;
     }
+
+    if (alt_pressure_ != pressure_old ||
+        alt_pressure_unit_ != pressure_unit_old) {
+        alt_dirty_          = true;
+        alt_dirty_pressure_ = true;
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentPFD::PanelALT::setALTCacheMode(
+    QGraphicsItem::CacheMode cache_mode)
+{
+    alt_cache_mode_ = cache_mode;
+
+    if (!alt_item_back_) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    alt_item_back_->setCacheMode(alt_cache_mode_);
+    alt_item_scale1_->setCacheMode(alt_cache_mode_);
+    alt_item_scale2_->setCacheMode(alt_cache_mode_);
+    alt_item_label1_->setCacheMode(alt_cache_mode_);
+    alt_item_label2_->setCacheMode(alt_cache_mode_);
+    alt_item_label3_->setCacheMode(alt_cache_mode_);
+    alt_item_ground_->setCacheMode(alt_cache_mode_);
+    alt_item_frame_->setCacheMode(alt_cache_mode_);
+    alt_item_pressure_->setCacheMode(alt_cache_mode_);
 }
 
 void FCSInstrucmentPFD::PanelALT::resetALT(void)
@@ -1147,25 +1387,15 @@ void FCSInstrucmentPFD::PanelALT::resetALT(void)
     alt_item_altitude_ = 0;
     alt_item_pressure_ = 0;
 
-    alt_altitude_ = 0.0f;
-    alt_pressure_ = 0.0f;
-
-    alt_pressure_unit_ = 0;
-
-    alt_scale1_delta_y_new_ = 0.0f;
-    alt_scale1_delta_y_old_ = 0.0f;
-    alt_scale2_delta_y_new_ = 0.0f;
-    alt_scale2_delta_y_old_ = 0.0f;
-    alt_ground_delta_y_new_ = 0.0f;
-    alt_ground_delta_y_old_ = 0.0f;
-    alt_labels_delta_y_new_ = 0.0f;
-    alt_labels_delta_y_old_ = 0.0f;
+    alt_dirty_          = true;
+    alt_dirty_altitude_ = true;
+    alt_dirty_pressure_ = true;
 }
 
 void FCSInstrucmentPFD::PanelALT::updateALTAltitude(void)
 {
-    alt_item_altitude_->setPlainText(
-        QString("%1").arg(alt_altitude_, 5, 'f', 0, QChar('.')));
+    alt_item_altitude_->setDigitNumber((int)floor(alt_altitude_ + 0.5f), 5,
+                                       '.');
 
     updateALTScale();
     updateALTScaleLabels();
@@ -1173,16 +1403,18 @@ void FCSInstrucmentPFD::PanelALT::updateALTAltitude(void)
 
 void FCSInstrucmentPFD::PanelALT::updateALTPressure(void)
 {
+    char pressure[DIGIT_ITEM_LENGTH_MAX + 1];
+
     if (alt_pressure_unit_ == 0) {
-        alt_item_pressure_->setPlainText(QString("STD"));
+        alt_item_pressure_->setDigitText("STD");
     }
     else if (alt_pressure_unit_ == 1) {
-        alt_item_pressure_->setPlainText(
-            QString::number(alt_pressure_, 'f', 0) + QString(" MB"));
+        snprintf(pressure, sizeof(pressure), "%.0f MB", alt_pressure_);
+        alt_item_pressure_->setDigitText(pressure);
     }
     else if (alt_pressure_unit_ == 2) {
-        alt_item_pressure_->setPlainText(
-            QString::number(alt_pressure_, 'f', 2) + QString(" IN"));
+        snprintf(pressure, sizeof(pressure), "%.2f IN", alt_pressure_);
+        alt_item_pressure_->setDigitText(pressure);
     }
     else {
         ;
@@ -1191,44 +1423,37 @@ void FCSInstrucmentPFD::PanelALT::updateALTPressure(void)
 
 void FCSInstrucmentPFD::PanelALT::updateALTScale(void)
 {
-    alt_scale1_delta_y_new_ = alt_scale_y_ * alt_original_pix_per_alt_ *
-        alt_altitude_;
-    alt_scale2_delta_y_new_ = alt_scale1_delta_y_new_;
-    alt_ground_delta_y_new_ = alt_scale1_delta_y_new_;
+    float scale1_delta_y = alt_original_pix_per_alt_ * alt_altitude_;
+    float scale2_delta_y = scale1_delta_y;
+    float ground_delta_y = scale1_delta_y;
 
-    float scale_single_height = alt_scale_y_ * alt_original_scale_height_;
+    float scale_single_height = alt_original_scale_height_;
     float scale_double_height = scale_single_height * 2.0f;
 
-    while (alt_scale1_delta_y_new_ >
-            scale_single_height + alt_scale_y_ * 74.5f) {
-        alt_scale1_delta_y_new_ = alt_scale1_delta_y_new_ -
-            scale_double_height;
+    while (scale1_delta_y > scale_single_height + 74.5f) {
+        scale1_delta_y -= scale_double_height;
     }
 
-    while (alt_scale2_delta_y_new_ >
-            scale_double_height + alt_scale_y_ * 74.5f) {
-        alt_scale2_delta_y_new_ = alt_scale2_delta_y_new_ -
-            scale_double_height;
+    while (scale2_delta_y > scale_double_height + 74.5f) {
+        scale2_delta_y -= scale_double_height;
     }
 
-    if (alt_ground_delta_y_new_ > alt_scale_y_ * 100.0f) {
-        alt_ground_delta_y_new_ = alt_scale_y_ * 100.0f;
+    if (ground_delta_y > 100.0f) {
+        ground_delta_y = 100.0f;
     }
     else {
         ;
     }
 
-    alt_item_scale1_->moveBy(
-        0.0f,
-        alt_scale1_delta_y_new_ - alt_scale1_delta_y_old_);
-    alt_item_scale2_->moveBy(
-        0.0f,
-        alt_scale2_delta_y_new_ - alt_scale2_delta_y_old_);
-    alt_item_ground_->moveBy(
-        0.0f,
-        alt_ground_delta_y_new_ - alt_ground_delta_y_old_);
+    alt_item_scale1_->setPos(alt_original_scale1_pos_.x(),
+                             alt_original_scale1_pos_.y() + scale1_delta_y);
+    alt_item_scale2_->setPos(alt_original_scale2_pos_.x(),
+                             alt_original_scale2_pos_.y() + scale2_delta_y);
+    alt_item_ground_->setPos(alt_original_ground_pos_.x(),
+                             alt_original_ground_pos_.y() + ground_delta_y);
 }
 
+
 void FCSInstrucmentPFD::PanelALT::updateALTScaleLabels(void)
 {
     int tmp = floor(alt_altitude_ + 0.5f);
@@ -1238,15 +1463,13 @@ void FCSInstrucmentPFD::PanelALT::updateALTScaleLabels(void)
     float alt2 = (float)alt;
     float alt3 = (float)alt - 500.0f;
 
-    alt_labels_delta_y_new_ = alt_scale_y_ * alt_original_pix_per_alt_ *
-        alt_altitude_;
+    float labels_delta_y = alt_original_pix_per_alt_ * alt_altitude_;
 
-    while (alt_labels_delta_y_new_ > alt_scale_y_ * 37.5f) {
-        alt_labels_delta_y_new_ = alt_labels_delta_y_new_ - alt_scale_y_ *
-            75.0f;
+    while (labels_delta_y > 37.5f) {
+        labels_delta_y -= 75.0f;
     }
 
-    if (alt_labels_delta_y_new_ < 0.0f && alt_altitude_ > alt2) {
+    if (labels_delta_y < 0.0f && alt_altitude_ > alt2) {
         alt1 += 500.0f;
         alt2 += 500.0f;
         alt3 += 500.0f;
@@ -1255,20 +1478,16 @@ void FCSInstrucmentPFD::PanelALT::updateALTScaleLabels(void)
         ;
     }
 
-    alt_item_label1_->moveBy(
-        0.0f,
-        alt_labels_delta_y_new_ - alt_labels_delta_y_old_);
-    alt_item_label2_->moveBy(
-        0.0f,
-        alt_labels_delta_y_new_ - alt_labels_delta_y_old_);
-    alt_item_label3_->moveBy(
-        0.0f,
-        alt_labels_delta_y_new_ - alt_labels_delta_y_old_);
+    alt_item_label1_->setDigitCenter(QPointF(
+        alt_original_labels_x_, alt_original_label1_y_ + labels_delta_y));
+    alt_item_label2_->setDigitCenter(QPointF(
+        alt_original_labels_x_, alt_original_label2_y_ + labels_delta_y));
+    alt_item_label3_->setDigitCenter(QPointF(
+        alt_original_labels_x_, alt_original_label3_y_ + labels_delta_y));
 
     if (alt1 > 0.0f && alt1 <= 100000.0f) {
         alt_item_label1_->setVisible(true);
-        alt_item_label1_->setPlainText(
-            QString("%1").arg(alt1, 5, 'f', 0, QChar(' ')));
+        alt_item_label1_->setDigitNumber((int)alt1, 5, ' ');
     }
     else {
         alt_item_label1_->setVisible(false);
@@ -1276,8 +1495,7 @@ void FCSInstrucmentPFD::PanelALT::updateALTScaleLabels(void)
 
     if (alt2 > 0.0f && alt2 <= 100000.0f) {
         alt_item_label2_->setVisible(true);
-        alt_item_label2_->setPlainText(
-            QString("%1").arg(alt2, 5, 'f', 0, QChar(' ')));
+        alt_item_label2_->setDigitNumber((int)alt2, 5, ' ');
     }
     else {
         alt_item_label2_->setVisible(false);
@@ -1285,8 +1503,7 @@ void FCSInstrucmentPFD::PanelALT::updateALTScaleLabels(void)
 
     if (alt3 > 0.0f && alt3 <= 100000.0f) {
         alt_item_label3_->setVisible(true);
-        alt_item_label3_->setPlainText(
-            QString("%1").arg(alt3, 5, 'f', 0, QChar(' ')));
+        alt_item_label3_->setDigitNumber((int)alt3, 5, ' ');
     }
     else {
         alt_item_label3_->setVisible(false);
@@ -1310,18 +1527,14 @@ FCSInstrucmentPFD::PanelASI::PanelASI(QGraphicsScene *scene) :
     asi_item_frame_      (0),
     asi_item_airspeed_   (0),
     asi_item_mach_number_(0),
+    asi_cache_mode_(QGraphicsItem::NoCache),
+    asi_dirty_            (true),
+    asi_dirty_airspeed_   (true),
+    asi_dirty_mach_number_(true),
     asi_frame_text_color_(255, 255, 255),
     asi_labels_color_    (255, 255, 255),
     asi_airspeed_   (0.0f),
     asi_mach_number_(0.0f),
-    asi_scale1_delta_y_new_(0.0f),
-    asi_scale1_delta_y_old_(0.0f),
-    asi_scale2_delta_y_new_(0.0f),
-    asi_scale2_delta_y_old_(0.0f),
-    asi_labels_delta_y_new_(0.0f),
-    asi_labels_delta_y_old_(0.0f),
-    asi_scale_x_(1.0f),
-    asi_scale_y_(1.0f),
     asi_original_pix_rer_spd_ (  1.5f),
     asi_original_scale_height_(300.0f),
     asi_original_labels_x_    ( 43.0f),
@@ -1361,208 +1574,122 @@ FCSInstrucmentPFD::PanelASI::~PanelASI()
 {
 }
 
-void FCSInstrucmentPFD::PanelASI::initASI(float scale_x, float scale_y)
+void FCSInstrucmentPFD::PanelASI::initASI(void)
 {
-    asi_scale_x_ = scale_x;
-    asi_scale_y_ = scale_y;
-
     resetASI();
 
-    asi_item_back_ = new QGraphicsSvgItem(
+    asi_item_back_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_asi_back.svg");
-    asi_item_back_->setCacheMode(QGraphicsItem::NoCache);
     asi_item_back_->setZValue(asi_back_z_);
-    asi_item_back_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_), true);
-    asi_item_back_->moveBy(asi_scale_x_ * asi_original_back_pos_.x(),
-                           asi_scale_y_ * asi_original_back_pos_.y());
+    asi_item_back_->setPos(asi_original_back_pos_);
     asi_scene_->addItem(asi_item_back_);
 
-    asi_item_scale1_ = new QGraphicsSvgItem(
+    asi_item_scale1_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_asi_scale.svg");
-    asi_item_scale1_->setCacheMode(QGraphicsItem::NoCache);
     asi_item_scale1_->setZValue(asi_scale_z_);
-    asi_item_scale1_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_), true);
-    asi_item_scale1_->moveBy(asi_scale_x_ * asi_original_scale1_pos_.x(),
-                             asi_scale_y_ * asi_original_scale1_pos_.y());
+    asi_item_scale1_->setPos(asi_original_scale1_pos_);
     asi_scene_->addItem(asi_item_scale1_);
 
-    asi_item_scale2_ = new QGraphicsSvgItem(
+    asi_item_scale2_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_asi_scale.svg");
-    asi_item_scale2_->setCacheMode(QGraphicsItem::NoCache);
     asi_item_scale2_->setZValue(asi_scale_z_);
-    asi_item_scale2_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_), true);
-    asi_item_scale1_->moveBy(asi_scale_x_ * asi_original_scale2_pos_.x(),
-                             asi_scale_y_ * asi_original_scale2_pos_.y());
+    asi_item_scale2_->setPos(asi_original_scale2_pos_);
     asi_scene_->addItem(asi_item_scale2_);
 
-    asi_item_label1_ = new QGraphicsTextItem(QString("999"));
-    asi_item_label1_->setCacheMode(QGraphicsItem::NoCache);
+    asi_item_label1_ = new FCSInstrucmentDigitItem(asi_labels_font_,
+                                                   asi_labels_color_, 5);
     asi_item_label1_->setZValue(asi_labels_z_);
-    asi_item_label1_->setDefaultTextColor(asi_labels_color_);
-    asi_item_label1_->setFont(asi_labels_font_);
-    asi_item_label1_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_),
-        true);
-    asi_item_label1_->moveBy(
-        asi_scale_x_ * (asi_original_labels_x_ -
-                        asi_item_label1_->boundingRect().width()  / 2.0f),
-        asi_scale_y_ * (asi_original_label1_y_ -
-                        asi_item_label1_->boundingRect().height() / 2.0f));
     asi_scene_->addItem(asi_item_label1_);
 
-    asi_item_label2_ = new QGraphicsTextItem(QString("999"));
-    asi_item_label2_->setCacheMode(QGraphicsItem::NoCache);
+    asi_item_label2_ = new FCSInstrucmentDigitItem(asi_labels_font_,
+                                                   asi_labels_color_, 5);
     asi_item_label2_->setZValue(asi_labels_z_);
-    asi_item_label2_->setDefaultTextColor(asi_labels_color_);
-    asi_item_label2_->setFont(asi_labels_font_);
-    asi_item_label2_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_),
-        true);
-    asi_item_label2_->moveBy(
-        asi_scale_x_ * (asi_original_labels_x_ -
-                        asi_item_label2_->boundingRect().width()  / 2.0f),
-        asi_scale_y_ * (asi_original_label2_y_ -
-                        asi_item_label2_->boundingRect().height() / 2.0f));
     asi_scene_->addItem(asi_item_label2_);
 
-    asi_item_label3_ = new QGraphicsTextItem(QString("999"));
-    asi_item_label3_->setCacheMode(QGraphicsItem::NoCache);
+    asi_item_label3_ = new FCSInstrucmentDigitItem(asi_labels_font_,
+                                                   asi_labels_color_, 5);
     asi_item_label3_->setZValue(asi_labels_z_);
-    asi_item_label3_->setDefaultTextColor(asi_labels_color_);
-    asi_item_label3_->setFont(asi_labels_font_);
-    asi_item_label3_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_),
-        true);
-    asi_item_label3_->moveBy(
-        asi_scale_x_ * (asi_original_labels_x_ -
-                        asi_item_label3_->boundingRect().width()  / 2.0f),
-        asi_scale_y_ * (asi_original_label3_y_ -
-                        asi_item_label3_->boundingRect().height() / 2.0f));
     asi_scene_->addItem(asi_item_label3_);
 
-    asi_item_label4_ = new QGraphicsTextItem(QString("999"));
-    asi_item_label4_->setCacheMode(QGraphicsItem::NoCache);
+    asi_item_label4_ = new FCSInstrucmentDigitItem(asi_labels_font_,
+                                                   asi_labels_color_, 5);
     asi_item_label4_->setZValue(asi_labels_z_);
-    asi_item_label4_->setDefaultTextColor(asi_labels_color_);
-    asi_item_label4_->setFont(asi_labels_font_);
-    asi_item_label4_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_),
-        true);
-    asi_item_label4_->moveBy(
-        asi_scale_x_ * (asi_original_labels_x_ -
-                        asi_item_label4_->boundingRect().width()  / 2.0f),
-        asi_scale_y_ * (asi_original_label4_y_ -
-                        asi_item_label4_->boundingRect().height() / 2.0f));
     asi_scene_->addItem(asi_item_label4_);
 
-    asi_item_label5_ = new QGraphicsTextItem(QString("999"));
-    asi_item_label5_->setCacheMode(QGraphicsItem::NoCache);
+    asi_item_label5_ = new FCSInstrucmentDigitItem(asi_labels_font_,
+                                                   asi_labels_color_, 5);
     asi_item_label5_->setZValue(asi_labels_z_);
-    asi_item_label5_->setDefaultTextColor(asi_labels_color_);
-    asi_item_label5_->setFont(asi_labels_font_);
-    asi_item_label5_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_),
-        true);
-    asi_item_label5_->moveBy(
-        asi_scale_x_ * (asi_original_labels_x_ -
-                        asi_item_label5_->boundingRect().width()  / 2.0f),
-        asi_scale_y_ * (asi_original_label5_y_ -
-                        asi_item_label5_->boundingRect().height() / 2.0f));
     asi_scene_->addItem(asi_item_label5_);
 
-    asi_item_label6_ = new QGraphicsTextItem(QString("999"));
-    asi_item_label6_->setCacheMode(QGraphicsItem::NoCache);
+    asi_item_label6_ = new FCSInstrucmentDigitItem(asi_labels_font_,
+                                                   asi_labels_color_, 5);
     asi_item_label6_->setZValue(asi_labels_z_);
-    asi_item_label6_->setDefaultTextColor(asi_labels_color_);
-    asi_item_label6_->setFont(asi_labels_font_);
-    asi_item_label6_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_),
-        true);
-    asi_item_label6_->moveBy(
-        asi_scale_x_ * (asi_original_labels_x_ -
-                        asi_item_label6_->boundingRect().width()  / 2.0f),
-        asi_scale_y_ * (asi_original_label6_y_ -
-                        asi_item_label6_->boundingRect().height() / 2.0f));
     asi_scene_->addItem(asi_item_label6_);
 
-    asi_item_label7_ = new QGraphicsTextItem(QString("999"));
-    asi_item_label7_->setCacheMode(QGraphicsItem::NoCache);
+    asi_item_label7_ = new FCSInstrucmentDigitItem(asi_labels_font_,
+                                                   asi_labels_color_, 5);
     asi_item_label7_->setZValue(asi_labels_z_);
-    asi_item_label7_->setDefaultTextColor(asi_labels_color_);
-    asi_item_label7_->setFont(asi_labels_font_);
-    asi_item_label7_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_),
-        true);
-    asi_item_label7_->moveBy(
-        asi_scale_x_ * (asi_original_labels_x_ -
-                        asi_item_label7_->boundingRect().width()  / 2.0f),
-        asi_scale_y_ * (asi_original_label7_y_ -
-                        asi_item_label7_->boundingRect().height() / 2.0f));
     asi_scene_->addItem(asi_item_label7_);
 
-    asi_item_frame_ = new QGraphicsSvgItem(
+    asi_item_frame_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_asi_frame.svg");
-    asi_item_frame_->setCacheMode(QGraphicsItem::NoCache);
     asi_item_frame_->setZValue(asi_frame_z_);
-    asi_item_frame_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_),
-        true);
-    asi_item_frame_->moveBy(asi_scale_x_ * asi_original_frame_pos_.x(),
-                            asi_scale_y_ * asi_original_frame_pos_.y());
+    asi_item_frame_->setPos(asi_original_frame_pos_);
     asi_scene_->addItem(asi_item_frame_);
 
-    asi_item_airspeed_ = new QGraphicsTextItem(QString("000"));
+    asi_item_airspeed_ = new FCSInstrucmentDigitItem(asi_frame_text_font_,
+                                                     asi_frame_text_color_, 4);
     asi_item_airspeed_->setCacheMode(QGraphicsItem::NoCache);
     asi_item_airspeed_->setZValue(asi_frame_text_z_);
-    asi_item_airspeed_->setTextInteractionFlags(Qt::NoTextInteraction);
-    asi_item_airspeed_->setDefaultTextColor(asi_frame_text_color_);
-    asi_item_airspeed_->setFont(asi_frame_text_font_);
-    asi_item_airspeed_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_),
-        true);
-    asi_item_airspeed_->moveBy(
-        asi_scale_x_ * (asi_original_airspeed_ctr_.x() -
-                        asi_item_airspeed_->boundingRect().width()  / 2.0f),
-        asi_scale_y_ * (asi_original_airspeed_ctr_.y() -
-                        asi_item_airspeed_->boundingRect().height() / 2.0f));
+    asi_item_airspeed_->setDigitNumber(0, 3, '0');
+    asi_item_airspeed_->setDigitCenter(asi_original_airspeed_ctr_);
     asi_scene_->addItem(asi_item_airspeed_);
 
-    asi_item_mach_number_ = new QGraphicsTextItem(QString("000"));
+    asi_item_mach_number_ = new FCSInstrucmentDigitItem(
+        asi_frame_text_font_, asi_frame_text_color_, 5);
     asi_item_mach_number_->setCacheMode(QGraphicsItem::NoCache);
     asi_item_mach_number_->setZValue(asi_frame_text_z_);
-    asi_item_mach_number_->setTextInteractionFlags(Qt::NoTextInteraction);
-    asi_item_mach_number_->setDefaultTextColor(asi_frame_text_color_);
-    asi_item_mach_number_->setFont(asi_frame_text_font_);
-    asi_item_mach_number_->setTransform(
-        QTransform::fromScale(asi_scale_x_, asi_scale_y_),
-        true);
-    asi_item_mach_number_->moveBy(
-        asi_scale_x_ * (asi_original_mach_number_ctr_.x() -
-                        asi_item_mach_number_->boundingRect().width()  / 2.0f),
-        asi_scale_y_ * (asi_original_mach_number_ctr_.y() -
-                        asi_item_mach_number_->boundingRect().height() / 2.0f));
+    asi_item_mach_number_->setDigitText(".000");
+    asi_item_mach_number_->setDigitCenter(asi_original_mach_number_ctr_);
     asi_scene_->addItem(asi_item_mach_number_);
 
-    updateASI(scale_x, scale_y);
+    setASICacheMode(asi_cache_mode_);
+
+    updateASI();
 }
 
-void FCSInstrucmentPFD::PanelASI::updateASI(float scale_x, float scale_y)
+void FCSInstrucmentPFD::PanelASI::updateASI(void)
 {
-    asi_scale_x_ = scale_x;
-    asi_scale_y_ = scale_y;
+    if (!asi_dirty_) {
+        return ;
+    }
+    else {
+        ;
+    }
 
-    updateASIAirspeed();
+    if (asi_dirty_airspeed_) {
+        updateASIAirspeed();
+    }
+    else {
+        ;
+    }
 
-    asi_scale1_delta_y_old_ = asi_scale1_delta_y_new_;
-    asi_scale2_delta_y_old_ = asi_scale2_delta_y_new_;
-    asi_labels_delta_y_old_ = asi_labels_delta_y_new_;
+    if (asi_dirty_mach_number_) {
+        updateASIMachNumber();
+    }
+    else {
+        ;
+    }
+
+    asi_dirty_             = false;
+    asi_dirty_airspeed_    = false;
+    asi_dirty_mach_number_ = false;
 }
 
 void FCSInstrucmentPFD::PanelASI::setASIAirspeed(float airspeed)
 {
+    float airspeed_old = asi_airspeed_;
+
     asi_airspeed_ = airspeed;
 
     if (asi_airspeed_ < 0.0f) {
@@ -1574,10 +1701,20 @@ void FCSInstrucmentPFD::PanelASI::setASIAirspeed(float airspeed)
     else {
         ;
     }
+
+    if (asi_airspeed_ != airspeed_old) {
+        asi_dirty_          = true;
+        asi_dirty_airspeed_ = true;
+    }
+    else {
+        ;
+    }
 }
 
 void FCSInstrucmentPFD::PanelASI::setASIMachNumber(float mach_number)
 {
+    float mach_number_old = asi_mach_number_;
+
     asi_mach_number_ = mach_number;
 
     if (asi_mach_number_ < 0.0f) {
@@ -1589,6 +1726,39 @@ void FCSInstrucmentPFD::PanelASI::setASIMachNumber(float mach_number)
     else {
         ;
     }
+
+    if (asi_mach_number_ != mach_number_old) {
+        asi_dirty_             = true;
+        asi_dirty_mach_number_ = true;
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentPFD::PanelASI::setASICacheMode(
+    QGraphicsItem::CacheMode cache_mode)
+{
+    asi_cache_mode_ = cache_mode;
+
+    if (!asi_item_back_) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    asi_item_back_->setCacheMode(asi_cache_mode_);
+    asi_item_scale1_->setCacheMode(asi_cache_mode_);
+    asi_item_scale2_->setCacheMode(asi_cache_mode_);
+    asi_item_label1_->setCacheMode(asi_cache_mode_);
+    asi_item_label2_->setCacheMode(asi_cache_mode_);
+    asi_item_label3_->setCacheMode(asi_cache_mode_);
+    asi_item_label4_->setCacheMode(asi_cache_mode_);
+    asi_item_label5_->setCacheMode(asi_cache_mode_);
+    asi_item_label6_->setCacheMode(asi_cache_mode_);
+    asi_item_label7_->setCacheMode(asi_cache_mode_);
+    asi_item_frame_->setCacheMode(asi_cache_mode_);
 }
 
 void FCSInstrucmentPFD::PanelASI::resetASI(void)
@@ -1607,75 +1777,68 @@ void FCSInstrucmentPFD::PanelASI::resetASI(void)
     asi_item_airspeed_    = 0;
     asi_item_mach_number_ = 0;
 
-    asi_airspeed_    = 0.0f;
-    asi_mach_number_ = 0.0f;
-
-    asi_scale1_delta_y_new_ = 0.0f;
-    asi_scale1_delta_y_old_ = 0.0f;
-    asi_scale2_delta_y_new_ = 0.0f;
-    asi_scale2_delta_y_old_ = 0.0f;
-    asi_labels_delta_y_new_ = 0.0f;
-    asi_labels_delta_y_old_ = 0.0f;
+    asi_dirty_             = true;
+    asi_dirty_airspeed_    = true;
+    asi_dirty_mach_number_ = true;
 }
 
 void FCSInstrucmentPFD::PanelASI::updateASIAirspeed(void)
 {
-    asi_item_airspeed_->setPlainText(
-        QString("%1").arg(asi_airspeed_, 3, 'f', 0, QChar('0')));
+    asi_item_airspeed_->setDigitNumber((int)floor(asi_airspeed_ + 0.5f), 3,
+                                       '0');
+
+    updateASIScale();
+    updateASIScaleLabels();
+}
+
+void FCSInstrucmentPFD::PanelASI::updateASIMachNumber(void)
+{
+    char mach_number[DIGIT_ITEM_LENGTH_MAX + 1];
 
     if (asi_mach_number_ < 1.0f) {
-        float mach_number = 1000.0f * asi_mach_number_;
-        asi_item_mach_number_->setPlainText(
-            QString(".%1").arg(mach_number, 3, 'f', 0, QChar('0')));
+        snprintf(mach_number, sizeof(mach_number), ".%03.0f",
+                 1000.0f * asi_mach_number_);
     }
     else {
         if (asi_mach_number_ < 10.0f) {
-            asi_item_mach_number_->setPlainText(
-                QString::number(asi_mach_number_, 'f', 2));
+            snprintf(mach_number, sizeof(mach_number), "%.2f",
+                     asi_mach_number_);
         }
         else {
-            asi_item_mach_number_->setPlainText(
-                QString::number(asi_mach_number_, 'f', 1));
+            snprintf(mach_number, sizeof(mach_number), "%.1f",
+                     asi_mach_number_);
         }
     }
 
-    updateASIScale();
-    updateASIScaleLabels();
+    asi_item_mach_number_->setDigitText(mach_number);
 }
 
 void FCSInstrucmentPFD::PanelASI::updateASIScale(void)
 {
-    asi_scale1_delta_y_new_ = asi_scale_y_ * asi_original_pix_rer_spd_ *
-        asi_airspeed_;
-    asi_scale2_delta_y_new_ = asi_scale1_delta_y_new_;
+    float scale1_delta_y = asi_original_pix_rer_spd_ * asi_airspeed_;
+    float scale2_delta_y = scale1_delta_y;
 
-    float scale_single_height = asi_scale_y_ * asi_original_scale_height_;
+    float scale_single_height = asi_original_scale_height_;
     float scale_double_height = scale_single_height * 2.0f;
 
-    while (asi_scale1_delta_y_new_ >
-            scale_single_height + asi_scale_y_ * 74.5f) {
-        asi_scale1_delta_y_new_ = asi_scale1_delta_y_new_ -
-            scale_double_height;
+    while (scale1_delta_y > scale_single_height + 74.5f) {
+        scale1_delta_y -= scale_double_height;
     }
 
-    while (asi_scale2_delta_y_new_ >
-            scale_double_height + asi_scale_y_ * 74.5f) {
-        asi_scale2_delta_y_new_ = asi_scale2_delta_y_new_ -
-            scale_double_height;
+    while (scale2_delta_y > scale_double_height + 74.5f) {
+        scale2_delta_y -= scale_double_height;
     }
 
-    asi_item_scale1_->moveBy(
-        0.0f,
-        asi_scale1_delta_y_new_ - asi_scale1_delta_y_old_);
-    asi_item_scale2_->moveBy(
-        0.0f,
-        asi_scale2_delta_y_new_ - asi_scale2_delta_y_old_);
+    asi_item_scale1_->setPos(asi_original_scale1_pos_.x(),
+                             asi_original_scale1_pos_.y() + scale1_delta_y);
+    asi_item_scale2_->setPos(asi_original_scale2_pos_.x(),
+                             asi_original_scale2_pos_.y() + scale2_delta_y);
 }
 
+
 void FCSInstrucmentPFD::PanelASI::updateASIScaleLabels(void)
 {
-    asi_labels_delta_y_new_ = asi_scale_y_ * asi_original_pix_rer_spd_ *
-        asi_airspeed_;
+    float labels_delta_y = asi_original_pix_rer_spd_ * asi_airspeed_;
 
     int tmp = floor(asi_airspeed_ + 0.5f);
     int spd = tmp - (tmp % 20);
@@ -1688,12 +1851,11 @@ void FCSInstrucmentPFD::PanelASI::updateASIScaleLabels(void)
     float spd6 = (float)spd - 40.0f;
     float spd7 = (float)spd - 60.0f;
 
-    while (asi_labels_delta_y_new_ > asi_scale_y_ * 15.0f) {
-        asi_labels_delta_y_new_ = asi_labels_delta_y_new_ - asi_scale_y_ *
-            30.0f;
+    while (labels_delta_y > 15.0f) {
+        labels_delta_y -= 30.0f;
     }
 
-    if (asi_labels_delta_y_new_ < 0.0 && asi_airspeed_ > spd4) {
+    if (labels_delta_y < 0.0 && asi_airspeed_ > spd4) {
         spd1 += 20.0f;
         spd2 += 20.0f;
         spd3 += 20.0f;
@@ -1706,32 +1868,24 @@ void FCSInstrucmentPFD::PanelASI::updateASIScaleLabels(void)
         ;
     }
 
-    asi_item_label1_->moveBy(
-        0.0f,
-        asi_labels_delta_y_new_ - asi_labels_delta_y_old_);
-    asi_item_label2_->moveBy(
-        0.0f,
-        asi_labels_delta_y_new_ - asi_labels_delta_y_old_);
-    asi_item_label3_->moveBy(
-        0.0f,
-        asi_labels_delta_y_new_ - asi_labels_delta_y_old_);
-    asi_item_label4_->moveBy(
-        0.0f,
-        asi_labels_delta_y_new_ - asi_labels_delta_y_old_);
-    asi_item_label5_->moveBy(
-        0.0f,
-        asi_labels_delta_y_new_ - asi_labels_delta_y_old_);
-    asi_item_label6_->moveBy(
-        0.0f,
-        asi_labels_delta_y_new_ - asi_labels_delta_y_old_);
-    asi_item_label7_->moveBy(
-        0.0f,
-        asi_labels_delta_y_new_ - asi_labels_delta_y_old_);
+    asi_item_label1_->setDigitCenter(QPointF(
+        asi_original_labels_x_, asi_original_label1_y_ + labels_delta_y));
+    asi_item_label2_->setDigitCenter(QPointF(
+        asi_original_labels_x_, asi_original_label2_y_ + labels_delta_y));
+    asi_item_label3_->setDigitCenter(QPointF(
+        asi_original_labels_x_, asi_original_label3_y_ + labels_delta_y));
+    asi_item_label4_->setDigitCenter(QPointF(
+        asi_original_labels_x_, asi_original_label4_y_ + labels_delta_y));
+    asi_item_label5_->setDigitCenter(QPointF(
+        asi_original_labels_x_, asi_original_label5_y_ + labels_delta_y));
+    asi_item_label6_->setDigitCenter(QPointF(
+        asi_original_labels_x_, asi_original_label6_y_ + labels_delta_y));
+    asi_item_label7_->setDigitCenter(QPointF(
+        asi_original_labels_x_, asi_original_label7_y_ + labels_delta_y));
 
     if (spd1 >= 0.0f && spd1 <= 10000.0f) {
         asi_item_label1_->setVisible(true);
-        asi_item_label1_->setPlainText(
-            QString("%1").arg(spd1, 3, 'f', 0, QChar('.')));
+        asi_item_label1_->setDigitNumber((int)spd1, 3, '.');
     }
     else {
         asi_item_label1_->setVisible(false);
@@ -1739,8 +1893,7 @@ void FCSInstrucmentPFD::PanelASI::updateASIScaleLabels(void)
 
     if (spd2 >= 0.0f && spd2 <= 10000.0f) {
         asi_item_label2_->setVisible(true);
-        asi_item_label2_->setPlainText(
-            QString("%1").arg(spd2, 3, 'f', 0, QChar('.')));
+        asi_item_label2_->setDigitNumber((int)spd2, 3, '.');
     }
     else {
         asi_item_label2_->setVisible(false);
@@ -1748,8 +1901,7 @@ void FCSInstrucmentPFD::PanelASI::updateASIScaleLabels(void)
 
     if (spd3 >= 0.0f && spd3 <= 10000.0f) {
         asi_item_label3_->setVisible(true);
-        asi_item_label3_->setPlainText(
-            QString("%1").arg(spd3, 3, 'f', 0, QChar('.')));
+        asi_item_label3_->setDigitNumber((int)spd3, 3, '.');
     }
     else {
         asi_item_label3_->setVisible(false);
@@ -1757,8 +1909,7 @@ void FCSInstrucmentPFD::PanelASI::updateASIScaleLabels(void)
 
     if (spd4 >= 0.0f && spd4 <= 10000.0f) {
         asi_item_label4_->setVisible(true);
-        asi_item_label4_->setPlainText(
-            QString("%1").arg(spd4, 3, 'f', 0, QChar('.')));
+        asi_item_label4_->setDigitNumber((int)spd4, 3, '.');
     }
     else {
         asi_item_label4_->setVisible(false);
@@ -1766,8 +1917,7 @@ void FCSInstrucmentPFD::PanelASI::updateASIScaleLabels(void)
 
     if (spd5 >= 0.0f && spd5 <= 10000.0f) {
         asi_item_label5_->setVisible(true);
-        asi_item_label5_->setPlainText(
-            QString("%1").arg(spd5, 3, 'f', 0, QChar('.')));
+        asi_item_label5_->setDigitNumber((int)spd5, 3, '.');
     }
     else {
         asi_item_label5_->setVisible(false);
@@ -1775,8 +1925,7 @@ void FCSInstrucmentPFD::PanelASI::updateASIScaleLabels(void)
 
     if (spd6 >= 0.0f && spd6 <= 10000.0f) {
         asi_item_label6_->setVisible(true);
-        asi_item_label6_->setPlainText(
-            QString("%1").arg(spd6, 3, 'f', 0, QChar('.')));
+        asi_item_label6_->setDigitNumber((int)spd6, 3, '.');
     }
     else {
         asi_item_label6_->setVisible(false);
@@ -1784,8 +1933,7 @@ void FCSInstrucmentPFD::PanelASI::updateASIScaleLabels(void)
 
     if (spd7 >= 0.0f && spd7 <= 10000.0f) {
         asi_item_label7_->setVisible(true);
-        asi_item_label7_->setPlainText(
-            QString("%1").arg(spd7, 3, 'f', 0, QChar('.')));
+        asi_item_label7_->setDigitNumber((int)spd7, 3, '.');
     }
     else {
         asi_item_label7_->setVisible(false);
@@ -1800,10 +1948,10 @@ FCSInstrucmentPFD::PanelHSI::PanelHSI(QGraphicsScene *scene) :
     hsi_item_face_      (0),
     hsi_item_marks_     (0),
     hsi_item_frame_text_(0),
+    hsi_cache_mode_(QGraphicsItem::NoCache),
+    hsi_dirty_(true),
     hsi_frame_text_color_(255, 255, 255),
     hsi_heading_(0.0f),
-    hsi_scale_x_(1.0f),
-    hsi_scale_y_(1.0f),
     hsi_original_hsi_ctr_       (150.0f, 345.0f),
     hsi_original_back_pos_      ( 60.0f, 240.0f),
     hsi_original_face_pos_      ( 45.0f, 240.0f),
@@ -1826,73 +1974,65 @@ FCSInstrucmentPFD::PanelHSI::~PanelHSI()
 {
 }
 
-void FCSInstrucmentPFD::PanelHSI::initHSI(float scale_x, float scale_y)
+void FCSInstrucmentPFD::PanelHSI::initHSI(void)
 {
-    hsi_scale_x_ = scale_x;
-    hsi_scale_y_ = scale_y;
-
     resetHSI();
 
-    hsi_item_back_ = new QGraphicsSvgItem(
+    hsi_item_back_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_hsi_back.svg");
-    hsi_item_back_->setCacheMode(QGraphicsItem::NoCache);
     hsi_item_back_->setZValue(hsi_back_z_);
-    hsi_item_back_->setTransform(
-        QTransform::fromScale(hsi_scale_x_, hsi_scale_y_), true);
-    hsi_item_back_->moveBy(hsi_scale_x_ * hsi_original_back_pos_.x(),
-                           hsi_scale_y_ * hsi_original_back_pos_.y());
+    hsi_item_back_->moveBy(hsi_original_back_pos_.x(),
+                           hsi_original_back_pos_.y());
     hsi_scene_->addItem(hsi_item_back_);
 
-    hsi_item_face_ = new QGraphicsSvgItem(
+    hsi_item_face_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_hsi_face.svg");
     hsi_item_face_->setCacheMode(QGraphicsItem::NoCache);
     hsi_item_face_->setZValue(hsi_face_z_);
-    hsi_item_face_->setTransform(
-        QTransform::fromScale(hsi_scale_x_, hsi_scale_y_), true);
     hsi_item_face_->setTransformOriginPoint(
         hsi_original_hsi_ctr_ - hsi_original_face_pos_);
-    hsi_item_face_->moveBy(hsi_scale_x_ * hsi_original_face_pos_.x(),
-                           hsi_scale_y_ * hsi_original_face_pos_.y());
+    hsi_item_face_->moveBy(hsi_original_face_pos_.x(),
+                           hsi_original_face_pos_.y());
     hsi_scene_->addItem(hsi_item_face_);
 
-    hsi_item_marks_ = new QGraphicsSvgItem(
+    hsi_item_marks_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_hsi_marks.svg");
-    hsi_item_marks_->setCacheMode(QGraphicsItem::NoCache);
     hsi_item_marks_->setZValue(hsi_marks_z_);
-    hsi_item_marks_->setTransform(
-        QTransform::fromScale(hsi_scale_x_, hsi_scale_y_), true);
-    hsi_item_marks_->moveBy(hsi_scale_x_ * hsi_original_marks_pos_.x(),
-                            hsi_scale_y_ * hsi_original_marks_pos_.y());
+    hsi_item_marks_->moveBy(hsi_original_marks_pos_.x(),
+                            hsi_original_marks_pos_.y());
     hsi_scene_->addItem(hsi_item_marks_);
 
-    hsi_item_frame_text_ = new QGraphicsTextItem(QString("000"));
+    hsi_item_frame_text_ = new FCSInstrucmentDigitItem(
+        hsi_frame_text_font_, hsi_frame_text_color_, 3);
     hsi_item_frame_text_->setCacheMode(QGraphicsItem::NoCache);
     hsi_item_frame_text_->setZValue(hsi_frame_text_z_);
-    hsi_item_frame_text_->setTextInteractionFlags(Qt::NoTextInteraction);
-    hsi_item_frame_text_->setDefaultTextColor(hsi_frame_text_color_);
-    hsi_item_frame_text_->setFont(hsi_frame_text_font_);
-    hsi_item_frame_text_->setTransform(
-        QTransform::fromScale(hsi_scale_x_, hsi_scale_y_), true);
-    hsi_item_frame_text_->moveBy(
-        hsi_scale_x_ * (hsi_original_frame_text_ctr_.x() -
-                        hsi_item_frame_text_->boundingRect().width()  / 2.0f),
-        hsi_scale_y_ * (hsi_original_frame_text_ctr_.y() -
-                        hsi_item_frame_text_->boundingRect().height() / 2.0f));
+    hsi_item_frame_text_->setDigitNumber(0, 3, '0');
+    hsi_item_frame_text_->setDigitCenter(hsi_original_frame_text_ctr_);
     hsi_scene_->addItem(hsi_item_frame_text_);
 
-    updateHSI(scale_x, scale_y);
+    setHSICacheMode(hsi_cache_mode_);
+
+    updateHSI();
 }
 
-void FCSInstrucmentPFD::PanelHSI::updateHSI(float scale_x, float scale_y)
+void FCSInstrucmentPFD::PanelHSI::updateHSI(void)
 {
-    hsi_scale_x_ = scale_x;
-    hsi_scale_y_ = scale_y;
+    if (!hsi_dirty_) {
+        return ;
+    }
+    else {
+        ;
+    }
 
     updateHSIHeading();
+
+    hsi_dirty_ = false;
 }
 
 void FCSInstrucmentPFD::PanelHSI::setHSIHeading(float heading)
 {
+    float heading_old = hsi_heading_;
+
     hsi_heading_ = heading;
 
     while (hsi_heading_ < 0.0f) {
@@ -1902,6 +2042,29 @@ void FCSInstrucmentPFD::PanelHSI::setHSIHeading(float heading)
     while (hsi_heading_ > 360.0f) {
         hsi_heading_ -= 360.0f;
     }
+
+    if (hsi_heading_ != heading_old) {
+        hsi_dirty_ = true;
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentPFD::PanelHSI::setHSICacheMode(
+    QGraphicsItem::CacheMode cache_mode)
+{
+    hsi_cache_mode_ = cache_mode;
+
+    if (!hsi_item_back_) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    hsi_item_back_->setCacheMode(hsi_cache_mode_);
+    hsi_item_marks_->setCacheMode(hsi_cache_mode_);
 }
 
 void FCSInstrucmentPFD::PanelHSI::resetHSI(void)
@@ -1911,17 +2074,15 @@ void FCSInstrucmentPFD::PanelHSI::resetHSI(void)
     hsi_item_marks_      = 0;
     hsi_item_frame_text_ = 0;
 
-    hsi_heading_ = 0.0f;
+    hsi_dirty_ = true;
 }
 
 void FCSInstrucmentPFD::PanelHSI::updateHSIHeading(void)
 {
     hsi_item_face_->setRotation(-hsi_heading_);
 
-    float heading = floor(hsi_heading_ + 0.5f);
-
-    hsi_item_frame_text_->setPlainText(
-        QString("%1").arg(heading, 3, 'f', 0, QChar('0')));
+    hsi_item_frame_text_->setDigitNumber((int)floor(hsi_heading_ + 0.5f), 3,
+                                         '0');
 }
 
 /*****************************************************************************/
@@ -1930,11 +2091,9 @@ FCSInstrucmentPFD::PanelVSI::PanelVSI(QGraphicsScene *scene) :
     vsi_scene_(scene),
     vsi_item_scale_(0),
     vsi_item_arrow_(0),
+    vsi_cache_mode_(QGraphicsItem::NoCache),
+    vsi_dirty_(true),
     vsi_climb_rate_(0.0f),
-    vsi_arrow_delta_y_new_(0.0f),
-    vsi_arrow_delta_y_old_(0.0f),
-    vsi_scale_x_(1.0f),
-    vsi_scale_y_(1.0f),
     vsi_original_marke_height_(75.0f),
     vsi_original_pix_per_spd1_(30.0f),
     vsi_original_pix_per_spd2_(20.0f),
@@ -1951,48 +2110,45 @@ FCSInstrucmentPFD::PanelVSI::~PanelVSI()
 {
 }
 
-void FCSInstrucmentPFD::PanelVSI::initVSI(float scale_x, float scale_y)
+void FCSInstrucmentPFD::PanelVSI::initVSI(void)
 {
-    vsi_scale_x_ = scale_x;
-    vsi_scale_y_ = scale_y;
-
     resetVSI();
 
-    vsi_item_scale_ = new QGraphicsSvgItem(
+    vsi_item_scale_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_vsi_scale.svg");
-    vsi_item_scale_->setCacheMode(QGraphicsItem::NoCache);
     vsi_item_scale_->setZValue(vsi_scale_z_);
-    vsi_item_scale_->setTransform(
-        QTransform::fromScale(vsi_scale_x_, vsi_scale_y_), true);
-    vsi_item_scale_->moveBy(vsi_scale_x_ * vsi_original_scale_pos_.x(),
-                            vsi_scale_y_ * vsi_original_scale_pos_.y());
+    vsi_item_scale_->setPos(vsi_original_scale_pos_);
     vsi_scene_->addItem(vsi_item_scale_);
 
-    vsi_item_arrow_ = new QGraphicsSvgItem(
+    vsi_item_arrow_ = FCSInstrucmentSvgCache::createItem(
         ":/fcs_instrucment/res/fcs_instrucment_pfd/pfd_vsi_arrow.svg");
-    vsi_item_arrow_->setCacheMode(QGraphicsItem::NoCache);
     vsi_item_arrow_->setZValue(vsi_arrow_z_);
-    vsi_item_arrow_->setTransform(
-        QTransform::fromScale(vsi_scale_x_, vsi_scale_y_), true);
-    vsi_item_arrow_->moveBy(vsi_scale_x_ * vsi_original_arrow_pos_.x(),
-                            vsi_scale_y_ * vsi_original_arrow_pos_.y());
+    vsi_item_arrow_->setPos(vsi_original_arrow_pos_);
     vsi_scene_->addItem(vsi_item_arrow_);
 
-    updateVSI(scale_x, scale_y);
+    setVSICacheMode(vsi_cache_mode_);
+
+    updateVSI();
 }
 
-void FCSInstrucmentPFD::PanelVSI::updateVSI(float scale_x, float scale_y)
+void FCSInstrucmentPFD::PanelVSI::updateVSI(void)
 {
-    vsi_scale_x_ = scale_x;
-    vsi_scale_y_ = scale_y;
+    if (!vsi_dirty_) {
+        return ;
+    }
+    else {
+        ;
+    }
 
     updateVSIClimbRate();
 
-    vsi_arrow_delta_y_old_ = vsi_arrow_delta_y_new_;
+    vsi_dirty_ = false;
 }
 
 void FCSInstrucmentPFD::PanelVSI::setVSIClimbRate(float climb_rate)
 {
+    float climb_rate_old = vsi_climb_rate_;
+
     vsi_climb_rate_ = climb_rate;
 
     if (vsi_climb_rate_ > 6.3f) {
@@ -2004,6 +2160,29 @@ void FCSInstrucmentPFD::PanelVSI::setVSIClimbRate(float climb_rate)
     else {
         ;
     }
+
+    if (vsi_climb_rate_ != climb_rate_old) {
+        vsi_dirty_ = true;
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentPFD::PanelVSI::setVSICacheMode(
+    QGraphicsItem::CacheMode cache_mode)
+{
+    vsi_cache_mode_ = cache_mode;
+
+    if (!vsi_item_scale_) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    vsi_item_scale_->setCacheMode(vsi_cache_mode_);
+    vsi_item_arrow_->setCacheMode(vsi_cache_mode_);
 }
 
 void FCSInstrucmentPFD::PanelVSI::resetVSI(void)
@@ -2011,10 +2190,7 @@ void FCSInstrucmentPFD::PanelVSI::resetVSI(void)
     vsi_item_scale_ = 0;
     vsi_item_arrow_ = 0;
 
-    vsi_climb_rate_ = 0.0f;
-
-    vsi_arrow_delta_y_new_ = 0.0f;
-    vsi_arrow_delta_y_old_ = 0.0f;
+    vsi_dirty_ = true;
 }
 
 void FCSInstrucmentPFD::PanelVSI::updateVSIClimbRate(void)
@@ -2042,8 +2218,6 @@ void FCSInstrucmentPFD::PanelVSI::updateVSIClimbRate(void)
         ;
     }
 
-    vsi_arrow_delta_y_new_ = vsi_scale_y_ * arrow_delta_y;
-    vsi_item_arrow_->moveBy(
-        0.0f,
-        vsi_arrow_delta_y_old_ - vsi_arrow_delta_y_new_);
+    vsi_item_arrow_->setPos(vsi_original_arrow_pos_.x(),
+                            vsi_original_arrow_pos_.y() - arrow_delta_y);
 }
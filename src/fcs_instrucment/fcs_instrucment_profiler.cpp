@@ -0,0 +1,596 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_profiler.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements the render profiler of instrucments, which
+ * collects scoped timers of painting and data updates into per-thread buffers
+ * and keeps rolling histograms of them.
+ *****************************************************************************/
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFontDatabase>
+#include <QFontMetrics>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPainter>
+#include <QTextStream>
+#include <QThreadStorage>
+#include <QtAlgorithms>
+#include <string.h>
+#include <fcs_instrucment_profiler.h>
+
+#define PROFILER_OVERLAY_MARGIN  8
+#define PROFILER_OVERLAY_PADDING 6
+
+struct FCSInstrucmentProfilerSample
+{
+    int    sample_probe;
+    qint64 sample_duration;
+};
+
+// Ring buffer with a single writer, which is its thread, and a single
+// reader, which is the profiler in gui thread.
+struct FCSInstrucmentProfilerBuffer
+{
+    FCSInstrucmentProfilerSample buffer_samples[PROFILER_BUFFER_SIZE];
+    QAtomicInteger<quint32>      buffer_head;
+    QAtomicInteger<quint32>      buffer_tail;
+    QAtomicInt                   buffer_dropped;
+    QAtomicInt                   buffer_retired;
+};
+
+// Owned by thread storage, buffer is only marked on thread exit and deleted
+// by profiler after its last samples are read.
+class FCSInstrucmentProfilerHolder
+{
+public:
+    FCSInstrucmentProfilerHolder(FCSInstrucmentProfilerBuffer *buffer) :
+        holder_buffer_(buffer)
+    {
+    }
+    ~FCSInstrucmentProfilerHolder()
+    {
+        holder_buffer_->buffer_retired.storeRelease(1);
+    }
+    FCSInstrucmentProfilerBuffer *getBuffer(void) const
+    {
+        return holder_buffer_;
+    }
+private:
+    FCSInstrucmentProfilerBuffer *holder_buffer_;
+};
+
+// Mutex guards probe names and list of buffers, threads only take it on
+// their first sample.
+static QMutex                                       profiler_mutex;
+static QElapsedTimer                                profiler_clock;
+static const char *profiler_probe_names[PROFILER_PROBE_MAX];
+static int                                          profiler_probe_count = 0;
+static QList<FCSInstrucmentProfilerBuffer *>        profiler_buffers;
+static QThreadStorage<FCSInstrucmentProfilerHolder *> profiler_holders;
+
+QAtomicInt FCSInstrucmentProfiler::profiler_enabled_(0);
+
+static int getBucketIndex(qint64 duration)
+{
+    // Buckets are exact below 4 us, then split every octave of microseconds
+    // into quarters.
+    quint64 micro = (duration > 0) ? (quint64)(duration / 1000) : 0;
+
+    if (micro < 4) {
+        return (int)micro;
+    }
+    else {
+        ;
+    }
+
+    int msb   = 63 - qCountLeadingZeroBits(micro);
+    int index = ((msb - 1) << 2) | (int)((micro >> (msb - 2)) & 3);
+
+    return qMin(index, PROFILER_BUCKET_COUNT - 1);
+}
+
+static qint64 getBucketLimit(int index)
+{
+    // Limit of bucket is the start of next one [us].
+    int next = index + 1;
+
+    if (next < 4) {
+        return next;
+    }
+    else {
+        ;
+    }
+
+    return (qint64)(4 | (next & 3)) << ((next >> 2) - 1);
+}
+
+FCSInstrucmentProfiler *FCSInstrucmentProfiler::getInstance(void)
+{
+    // Profiler is owned by application, like the render clock.
+    static FCSInstrucmentProfiler *instance =
+        new FCSInstrucmentProfiler(QCoreApplication::instance());
+
+    return instance;
+}
+
+int FCSInstrucmentProfiler::registerProbe(const char *name)
+{
+    QMutexLocker locker(&profiler_mutex);
+
+    // Probes are registered before their first sample, so clock is always
+    // started when timestamps are taken.
+    if (!profiler_clock.isValid()) {
+        profiler_clock.start();
+    }
+    else {
+        ;
+    }
+
+    for (int i = 0; i < profiler_probe_count; i++) {
+        if (qstrcmp(profiler_probe_names[i], name) == 0) {
+            return i;
+        }
+        else {
+            ;
+        }
+    }
+
+    if (profiler_probe_count >= PROFILER_PROBE_MAX) {
+        qWarning("FCSInstrucmentProfiler: no probe left for %s", name);
+        return -1;
+    }
+    else {
+        ;
+    }
+
+    profiler_probe_names[profiler_probe_count] = name;
+
+    return profiler_probe_count++;
+}
+
+qint64 FCSInstrucmentProfiler::getTimestamp(void)
+{
+    return profiler_clock.nsecsElapsed();
+}
+
+void FCSInstrucmentProfiler::addSample(int probe, qint64 duration)
+{
+    FCSInstrucmentProfilerHolder *holder = profiler_holders.localData();
+
+    if (!holder) {
+        FCSInstrucmentProfilerBuffer *buffer =
+            new FCSInstrucmentProfilerBuffer;
+
+        buffer->buffer_head.storeRelease(0);
+        buffer->buffer_tail.storeRelease(0);
+        buffer->buffer_dropped.storeRelease(0);
+        buffer->buffer_retired.storeRelease(0);
+
+        holder = new FCSInstrucmentProfilerHolder(buffer);
+        profiler_holders.setLocalData(holder);
+
+        QMutexLocker locker(&profiler_mutex);
+        profiler_buffers.append(buffer);
+    }
+    else {
+        ;
+    }
+
+    FCSInstrucmentProfilerBuffer *buffer = holder->getBuffer();
+
+    quint32 head = buffer->buffer_head.loadAcquire();
+    quint32 tail = buffer->buffer_tail.loadAcquire();
+
+    if (head - tail >= PROFILER_BUFFER_SIZE) {
+        buffer->buffer_dropped.fetchAndAddRelaxed(1);
+        return ;
+    }
+    else {
+        ;
+    }
+
+    FCSInstrucmentProfilerSample &sample =
+        buffer->buffer_samples[head & PROFILER_BUFFER_MASK];
+
+    sample.sample_probe    = probe;
+    sample.sample_duration = duration;
+
+    buffer->buffer_head.storeRelease(head + 1);
+}
+
+FCSInstrucmentProfiler::FCSInstrucmentProfiler(QObject *parent) :
+    QObject(parent),
+    profiler_timer_(0),
+    profiler_slice_(0),
+    profiler_dropped_(0)
+{
+    profiler_timer_ = new QTimer(this);
+    profiler_timer_->setInterval(PROFILER_SLICE_TIME);
+
+    connect(profiler_timer_, SIGNAL(timeout()), this,
+            SLOT(collectSamples()));
+
+    clearStatistics();
+}
+
+FCSInstrucmentProfiler::~FCSInstrucmentProfiler()
+{
+    // Buffers of running threads are left to the end of process, their
+    // threads may still write into them.
+    QMutexLocker locker(&profiler_mutex);
+
+    for (int i = profiler_buffers.size() - 1; i >= 0; i--) {
+        if (profiler_buffers[i]->buffer_retired.loadAcquire() != 0) {
+            delete profiler_buffers.takeAt(i);
+        }
+        else {
+            ;
+        }
+    }
+}
+
+void FCSInstrucmentProfiler::setEnabled(bool enabled)
+{
+    if (enabled == isEnabled()) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    if (enabled) {
+        collectSamples();
+        clearStatistics();
+        profiler_enabled_.storeRelease(1);
+        profiler_timer_->start();
+    }
+    else {
+        // Samples of last slice are kept, so they can still be dumped.
+        profiler_enabled_.storeRelease(0);
+        profiler_timer_->stop();
+        collectSamples();
+    }
+}
+
+QList<FCSInstrucmentProfilerStatistic> FCSInstrucmentProfiler::getStatistics(
+    void) const
+{
+    QList<FCSInstrucmentProfilerStatistic> statistics;
+    int probe_count = 0;
+
+    {
+        QMutexLocker locker(&profiler_mutex);
+        probe_count = profiler_probe_count;
+    }
+
+    for (int i = 0; i < probe_count; i++) {
+        quint32 buckets[PROFILER_BUCKET_COUNT];
+        quint32 count = 0;
+        qint64  sum   = 0;
+        qint64  max   = 0;
+
+        getProbeBuckets(i, buckets, &count, &sum, &max);
+
+        if (count == 0) {
+            continue;
+        }
+        else {
+            ;
+        }
+
+        FCSInstrucmentProfilerStatistic statistic;
+        quint32 rank_p50 = (count + 1) / 2;
+        quint32 rank_p99 = count - count / 100;
+        quint32 rank     = 0;
+
+        statistic.stat_probe = i;
+        statistic.stat_name  = QString::fromLatin1(profiler_probe_names[i]);
+        statistic.stat_count = count;
+        statistic.stat_mean  = sum / 1.0e6 / count;
+        statistic.stat_p50   = 0.0;
+        statistic.stat_p99   = 0.0;
+        statistic.stat_max   = max / 1.0e6;
+
+        for (int j = 0; j < PROFILER_BUCKET_COUNT; j++) {
+            if (rank < rank_p50 && rank + buckets[j] >= rank_p50) {
+                statistic.stat_p50 = getBucketLimit(j) / 1.0e3;
+            }
+            else {
+                ;
+            }
+
+            if (rank < rank_p99 && rank + buckets[j] >= rank_p99) {
+                statistic.stat_p99 = getBucketLimit(j) / 1.0e3;
+            }
+            else {
+                ;
+            }
+
+            rank += buckets[j];
+        }
+
+        statistic.stat_p50 = qMin(statistic.stat_p50, statistic.stat_max);
+        statistic.stat_p99 = qMin(statistic.stat_p99, statistic.stat_max);
+
+        statistics.append(statistic);
+    }
+
+    return statistics;
+}
+
+int FCSInstrucmentProfiler::getDroppedCount(void) const
+{
+    return profiler_dropped_;
+}
+
+int FCSInstrucmentProfiler::getWindowTime(void) const
+{
+    return PROFILER_SLICE_COUNT * PROFILER_SLICE_TIME;
+}
+
+bool FCSInstrucmentProfiler::dumpStatistics(const QString &path) const
+{
+    QFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+    else {
+        ;
+    }
+
+    QTextStream stream(&file);
+    QList<FCSInstrucmentProfilerStatistic> statistics = getStatistics();
+
+    stream << "probe,count,mean_ms,p50_ms,p99_ms,max_ms\n";
+
+    for (int i = 0; i < statistics.size(); i++) {
+        stream << statistics[i].stat_name << ','
+               << statistics[i].stat_count << ','
+               << statistics[i].stat_mean << ','
+               << statistics[i].stat_p50 << ','
+               << statistics[i].stat_p99 << ','
+               << statistics[i].stat_max << '\n';
+    }
+
+    // Histograms follow as a second table, empty buckets are skipped.
+    stream << "\nprobe,bucket_limit_us,count\n";
+
+    for (int i = 0; i < statistics.size(); i++) {
+        quint32 buckets[PROFILER_BUCKET_COUNT];
+        quint32 count = 0;
+        qint64  sum   = 0;
+        qint64  max   = 0;
+
+        getProbeBuckets(statistics[i].stat_probe, buckets, &count, &sum,
+                        &max);
+
+        for (int j = 0; j < PROFILER_BUCKET_COUNT; j++) {
+            if (buckets[j] != 0) {
+                stream << statistics[i].stat_name << ','
+                       << getBucketLimit(j) << ',' << buckets[j] << '\n';
+            }
+            else {
+                ;
+            }
+        }
+    }
+
+    stream.flush();
+
+    return (stream.status() == QTextStream::Ok);
+}
+
+void FCSInstrucmentProfiler::clearStatistics(void)
+{
+    memset(profiler_slices_, 0, sizeof(profiler_slices_));
+    profiler_slice_   = 0;
+    profiler_dropped_ = 0;
+}
+
+void FCSInstrucmentProfiler::collectSamples(void)
+{
+    // Oldest slice is reused for samples since last tick, so window always
+    // holds the latest slices.
+    if (isEnabled()) {
+        profiler_slice_ = (profiler_slice_ + 1) % PROFILER_SLICE_COUNT;
+        memset(profiler_slices_[profiler_slice_], 0,
+               sizeof(profiler_slices_[profiler_slice_]));
+    }
+    else {
+        ;
+    }
+
+    QMutexLocker locker(&profiler_mutex);
+
+    for (int i = profiler_buffers.size() - 1; i >= 0; i--) {
+        FCSInstrucmentProfilerBuffer *buffer = profiler_buffers[i];
+
+        // Retired flag is read first, samples written before it are then
+        // all visible below.
+        bool retired = (buffer->buffer_retired.loadAcquire() != 0);
+        quint32 head = buffer->buffer_head.loadAcquire();
+        quint32 tail = buffer->buffer_tail.loadAcquire();
+
+        for (; tail != head; tail++) {
+            const FCSInstrucmentProfilerSample &sample =
+                buffer->buffer_samples[tail & PROFILER_BUFFER_MASK];
+
+            addSliceSample(sample.sample_probe, sample.sample_duration);
+        }
+
+        buffer->buffer_tail.storeRelease(tail);
+        profiler_dropped_ += buffer->buffer_dropped.fetchAndStoreRelaxed(0);
+
+        if (retired) {
+            delete profiler_buffers.takeAt(i);
+        }
+        else {
+            ;
+        }
+    }
+
+    locker.unlock();
+
+    emit statisticsUpdated();
+}
+
+void FCSInstrucmentProfiler::addSliceSample(int probe, qint64 duration)
+{
+    if (probe < 0 || probe >= PROFILER_PROBE_MAX) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    Slice &slice = profiler_slices_[profiler_slice_][probe];
+
+    slice.slice_buckets[getBucketIndex(duration)]++;
+    slice.slice_count++;
+    slice.slice_sum += duration;
+    slice.slice_max  = qMax(slice.slice_max, duration);
+}
+
+void FCSInstrucmentProfiler::getProbeBuckets(int probe, quint32 *buckets,
+                                             quint32 *count, qint64 *sum,
+                                             qint64 *max) const
+{
+    memset(buckets, 0, sizeof(quint32) * PROFILER_BUCKET_COUNT);
+
+    for (int i = 0; i < PROFILER_SLICE_COUNT; i++) {
+        const Slice &slice = profiler_slices_[i][probe];
+
+        for (int j = 0; j < PROFILER_BUCKET_COUNT; j++) {
+            buckets[j] += slice.slice_buckets[j];
+        }
+
+        *count += slice.slice_count;
+        *sum   += slice.slice_sum;
+        *max    = qMax(*max, slice.slice_max);
+    }
+}
+
+/*****************************************************************************/
+
+FCSInstrucmentProfilerOverlay::FCSInstrucmentProfilerOverlay(
+    QWidget *parent) :
+    QWidget(parent)
+{
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+
+    connect(FCSInstrucmentProfiler::getInstance(),
+            SIGNAL(statisticsUpdated()), this, SLOT(updateOverlay()));
+
+    updateOverlay();
+}
+
+FCSInstrucmentProfilerOverlay::~FCSInstrucmentProfilerOverlay()
+{
+}
+
+QSize FCSInstrucmentProfilerOverlay::sizeHint() const
+{
+    QFontMetrics metrics(font());
+    int width = 0;
+
+    for (int i = 0; i < overlay_lines_.size(); i++) {
+        width = qMax(width, metrics.width(overlay_lines_[i]));
+    }
+
+    return QSize(width + 2 * PROFILER_OVERLAY_PADDING,
+                 metrics.lineSpacing() * overlay_lines_.size() +
+                 2 * PROFILER_OVERLAY_PADDING);
+}
+
+void FCSInstrucmentProfilerOverlay::paintEvent(QPaintEvent *)
+{
+    QPainter painter(this);
+    QFontMetrics metrics(font());
+
+    painter.fillRect(rect(), QColor(0, 0, 0, 160));
+    painter.setPen(Qt::white);
+
+    for (int i = 0; i < overlay_lines_.size(); i++) {
+        painter.drawText(PROFILER_OVERLAY_PADDING,
+                         PROFILER_OVERLAY_PADDING + metrics.ascent() +
+                         metrics.lineSpacing() * i, overlay_lines_[i]);
+    }
+}
+
+void FCSInstrucmentProfilerOverlay::updateOverlay(void)
+{
+    FCSInstrucmentProfiler *profiler = FCSInstrucmentProfiler::getInstance();
+    QList<FCSInstrucmentProfilerStatistic> statistics =
+        profiler->getStatistics();
+    float window_time = profiler->getWindowTime() / 1000.0f;
+
+    overlay_lines_.clear();
+    overlay_lines_ << QString("%1 %2 %3 %4 %5")
+                      .arg(tr("probe"), -16)
+                      .arg(tr("Hz"), 6)
+                      .arg(tr("p50"), 7)
+                      .arg(tr("p99"), 7)
+                      .arg(tr("max"), 7);
+
+    for (int i = 0; i < statistics.size(); i++) {
+        overlay_lines_ << QString("%1 %2 %3 %4 %5")
+                          .arg(statistics[i].stat_name, -16)
+                          .arg(statistics[i].stat_count / window_time, 6,
+                               'f', 1)
+                          .arg(statistics[i].stat_p50, 7, 'f', 2)
+                          .arg(statistics[i].stat_p99, 7, 'f', 2)
+                          .arg(statistics[i].stat_max, 7, 'f', 2);
+    }
+
+    overlay_lines_ << tr("%1 s window [ms], %2 dropped")
+                      .arg(window_time, 0, 'f', 0)
+                      .arg(profiler->getDroppedCount());
+
+    resize(sizeHint());
+
+    if (parentWidget()) {
+        move(parentWidget()->width() - width() - PROFILER_OVERLAY_MARGIN,
+             PROFILER_OVERLAY_MARGIN);
+    }
+    else {
+        ;
+    }
+
+    raise();
+    update();
+}
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_render_clock.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements the render clock of instrucments, which
+ * coalesces refresh requests of all instrucments into one update per display
+ * frame.
+ *****************************************************************************/
+
+#include <QCoreApplication>
+#include <QGuiApplication>
+#include <QScreen>
+#include <fcs_instrucment_render_clock.h>
+
+#define CLOCK_FRAME_RATE_DEFAULT 60.0f
+
+FCSInstrucmentRenderClock *FCSInstrucmentRenderClock::getInstance(void)
+{
+    // Clock is owned by application, like the shared svg renderers.
+    static FCSInstrucmentRenderClock *instance =
+        new FCSInstrucmentRenderClock(QCoreApplication::instance());
+
+    return instance;
+}
+
+FCSInstrucmentRenderClock::FCSInstrucmentRenderClock(QObject *parent) :
+    QObject(parent),
+    clock_timer_(0),
+    clock_frame_requested_(false),
+    clock_frame_rate_(CLOCK_FRAME_RATE_DEFAULT),
+    clock_frame_rate_cap_(0.0f)
+{
+    clock_timer_ = new QTimer(this);
+    clock_timer_->setTimerType(Qt::PreciseTimer);
+
+    connect(clock_timer_, SIGNAL(timeout()), this, SLOT(tickFrame()));
+
+    updateFrameInterval();
+}
+
+FCSInstrucmentRenderClock::~FCSInstrucmentRenderClock()
+{
+}
+
+void FCSInstrucmentRenderClock::setFrameRateCap(float frame_rate_cap)
+{
+    clock_frame_rate_cap_ = frame_rate_cap;
+
+    if (clock_frame_rate_cap_ < 0.0f) {
+        clock_frame_rate_cap_ = 0.0f;
+    }
+    else {
+        ;
+    }
+
+    updateFrameInterval();
+}
+
+float FCSInstrucmentRenderClock::getFrameRate(void) const
+{
+    return clock_frame_rate_;
+}
+
+void FCSInstrucmentRenderClock::requestFrame(void)
+{
+    clock_frame_requested_ = true;
+
+    if (!clock_timer_->isActive()) {
+        clock_timer_->start();
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentRenderClock::tickFrame(void)
+{
+    // Clock stops when nothing changed during last frame, so idle
+    // instrucments cost no wakeups.
+    if (!clock_frame_requested_) {
+        clock_timer_->stop();
+        return ;
+    }
+    else {
+        ;
+    }
+
+    clock_frame_requested_ = false;
+
+    emit frameTicked();
+}
+
+void FCSInstrucmentRenderClock::updateFrameInterval(void)
+{
+    QScreen *screen = QGuiApplication::primaryScreen();
+
+    clock_frame_rate_ = CLOCK_FRAME_RATE_DEFAULT;
+
+    if (screen && screen->refreshRate() > 0.0f) {
+        clock_frame_rate_ = screen->refreshRate();
+    }
+    else {
+        ;
+    }
+
+    if (clock_frame_rate_cap_ > 0.0f &&
+        clock_frame_rate_cap_ < clock_frame_rate_) {
+        clock_frame_rate_ = clock_frame_rate_cap_;
+    }
+    else {
+        ;
+    }
+
+    clock_timer_->setInterval(qRound(1000.0f / clock_frame_rate_));
+}
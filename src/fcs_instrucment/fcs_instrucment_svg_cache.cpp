@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_svg_cache.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements a process-wide cache of svg renderers, so that
+ * every instrucment item built from the same resource shares one parsed
+ * document.
+ *****************************************************************************/
+
+#include <QCoreApplication>
+#include <fcs_instrucment_svg_cache.h>
+
+FCSInstrucmentSvgRenderer *FCSInstrucmentSvgCache::getRenderer(
+    const QString &path)
+{
+    QHash<QString, FCSInstrucmentSvgRenderer *> &table = getRendererTable();
+    QHash<QString, FCSInstrucmentSvgRenderer *>::const_iterator iter =
+        table.constFind(path);
+
+    if (iter != table.constEnd()) {
+        return iter.value();
+    }
+    else {
+        ;
+    }
+
+#ifdef FCS_INSTRUCMENT_VECTOR
+    const FCSInstrucmentVectorData *data =
+        FCSInstrucmentVectorShape::findData(path);
+
+    // Keep drawing the other layers if a resource was left out of the build.
+    if (data == 0) {
+        static const FCSInstrucmentVectorData empty_data = {
+            "", 0.0f, 0.0f, 0, 0, 0
+        };
+
+        qWarning("FCSInstrucmentSvgCache: %s was not compiled in",
+                 qPrintable(path));
+        data = &empty_data;
+    }
+    else {
+        ;
+    }
+
+    FCSInstrucmentSvgRenderer *renderer = new FCSInstrucmentVectorShape(data);
+#else
+    // Renderers are owned by application, so they live as long as any
+    // instrucment and are released together with it on exit.
+    FCSInstrucmentSvgRenderer *renderer =
+        new QSvgRenderer(path, QCoreApplication::instance());
+#endif
+
+    table.insert(path, renderer);
+
+    return renderer;
+}
+
+FCSInstrucmentSvgItem *FCSInstrucmentSvgCache::createItem(const QString &path)
+{
+#ifdef FCS_INSTRUCMENT_VECTOR
+    return new FCSInstrucmentVectorItem(getRenderer(path));
+#else
+    QGraphicsSvgItem *item = new QGraphicsSvgItem();
+
+    item->setSharedRenderer(getRenderer(path));
+
+    return item;
+#endif
+}
+
+void FCSInstrucmentSvgCache::clearRenderer(void)
+{
+    QHash<QString, FCSInstrucmentSvgRenderer *> &table = getRendererTable();
+
+    qDeleteAll(table);
+    table.clear();
+}
+
+QHash<QString, FCSInstrucmentSvgRenderer *> &
+    FCSInstrucmentSvgCache::getRendererTable(void)
+{
+    static QHash<QString, FCSInstrucmentSvgRenderer *> renderer_table;
+
+    return renderer_table;
+}
@@ -0,0 +1,579 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_terrain_item.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements the synthetic vision terrain of ADI, a local SRTM
+ * heightmap is rendered in perspective by a software voxel renderer.
+ *****************************************************************************/
+
+#include <QFileInfo>
+#include <QtMath>
+#include <math.h>
+#include <stdio.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include <fcs_instrucment_terrain_item.h>
+
+#define TERRAIN_VOID       -32768
+#define TERRAIN_DEPTH_MIN  1.0f
+#define TERRAIN_DEPTH_MAX  10000.0f
+#define TERRAIN_DEPTH_STEP 0.01f
+#define TERRAIN_FOG_MAX    200
+#define TERRAIN_FOG_COLOR  0xa0b4c8
+
+static inline quint32 blendTerrainFog(quint32 color, int fog)
+{
+    quint32 rb = color & 0xff00ff;
+    quint32 g  = color & 0x00ff00;
+
+    rb = ((rb * (256 - fog) + (TERRAIN_FOG_COLOR & 0xff00ff) * fog) >> 8) &
+        0xff00ff;
+    g  = ((g  * (256 - fog) + (TERRAIN_FOG_COLOR & 0x00ff00) * fog) >> 8) &
+        0x00ff00;
+
+    return 0xff000000 | rb | g;
+}
+
+FCSInstrucmentTerrainMap::FCSInstrucmentTerrainMap() :
+    terrain_data_(0),
+    terrain_samples_(0),
+    terrain_latitude_(0.0),
+    terrain_longitude_(0.0),
+    terrain_origin_set_(false),
+    terrain_origin_latitude_(0.0),
+    terrain_origin_longitude_(0.0),
+    terrain_origin_row_(0.0f),
+    terrain_origin_column_(0.0f),
+    terrain_origin_height_(0.0f),
+    terrain_spacing_north_(1.0f),
+    terrain_spacing_east_(1.0f),
+    terrain_tiles_(TERRAIN_TILE_CACHE),
+    terrain_tile_key_(-1),
+    terrain_tile_(0)
+{
+}
+
+FCSInstrucmentTerrainMap::~FCSInstrucmentTerrainMap()
+{
+    clearTerrain();
+}
+
+bool FCSInstrucmentTerrainMap::loadTerrainFile(const QString &path)
+{
+    clearTerrain();
+
+    char hemisphere_ns = 0;
+    char hemisphere_ew = 0;
+    int  latitude      = 0;
+    int  longitude     = 0;
+
+    if (sscanf(QFileInfo(path).baseName().toUpper().toLatin1().constData(),
+               "%c%2d%c%3d", &hemisphere_ns, &latitude, &hemisphere_ew,
+               &longitude) != 4 ||
+        (hemisphere_ns != 'N' && hemisphere_ns != 'S') ||
+        (hemisphere_ew != 'E' && hemisphere_ew != 'W')) {
+        return false;
+    }
+    else {
+        ;
+    }
+
+    terrain_file_.setFileName(path);
+
+    if (!terrain_file_.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    else {
+        ;
+    }
+
+    qint64 size    = terrain_file_.size();
+    int    samples = (int)(sqrt(size / 2.0) + 0.5);
+
+    if (samples < 2 || (qint64)samples * samples * 2 != size) {
+        terrain_file_.close();
+        return false;
+    }
+    else {
+        ;
+    }
+
+    // Mapped file is paged in on demand, only tiles in view are read.
+    terrain_data_ = terrain_file_.map(0, size);
+
+    if (terrain_data_ == 0) {
+        terrain_file_.close();
+        return false;
+    }
+    else {
+        ;
+    }
+
+    terrain_samples_   = samples;
+    terrain_latitude_  = (hemisphere_ns == 'N') ? latitude  : -latitude;
+    terrain_longitude_ = (hemisphere_ew == 'E') ? longitude : -longitude;
+
+    if (terrain_origin_set_) {
+        updateTerrainOrigin(terrain_origin_latitude_,
+                            terrain_origin_longitude_);
+    }
+    else {
+        updateTerrainOrigin(terrain_latitude_ + 0.5, terrain_longitude_ + 0.5);
+    }
+
+    return true;
+}
+
+void FCSInstrucmentTerrainMap::clearTerrain(void)
+{
+    terrain_tiles_.clear();
+    terrain_tile_key_ = -1;
+    terrain_tile_     = 0;
+
+    if (terrain_data_ != 0) {
+        terrain_file_.unmap(const_cast<uchar *>(terrain_data_));
+        terrain_data_ = 0;
+    }
+    else {
+        ;
+    }
+
+    terrain_file_.close();
+    terrain_samples_ = 0;
+}
+
+bool FCSInstrucmentTerrainMap::isTerrainValid(void) const
+{
+    return (terrain_data_ != 0);
+}
+
+void FCSInstrucmentTerrainMap::setTerrainOrigin(double latitude,
+                                                double longitude)
+{
+    terrain_origin_set_       = true;
+    terrain_origin_latitude_  = latitude;
+    terrain_origin_longitude_ = longitude;
+
+    updateTerrainOrigin(latitude, longitude);
+}
+
+void FCSInstrucmentTerrainMap::getTerrainPosition(float x, float y,
+                                                  float *row,
+                                                  float *column) const
+{
+    *row    = terrain_origin_row_    - x / terrain_spacing_north_;
+    *column = terrain_origin_column_ + y / terrain_spacing_east_;
+}
+
+float FCSInstrucmentTerrainMap::getTerrainOriginHeight(void) const
+{
+    return terrain_origin_height_;
+}
+
+float FCSInstrucmentTerrainMap::getTerrainSpacingNorth(void) const
+{
+    return terrain_spacing_north_;
+}
+
+float FCSInstrucmentTerrainMap::getTerrainSpacingEast(void) const
+{
+    return terrain_spacing_east_;
+}
+
+const FCSInstrucmentTerrainMap::Tile *FCSInstrucmentTerrainMap::getTerrainTile(
+    int tile_row, int tile_column) const
+{
+    int   key  = (tile_row << 16) | tile_column;
+    Tile *tile = terrain_tiles_.object(key);
+
+    if (tile != 0) {
+        return tile;
+    }
+    else {
+        ;
+    }
+
+    tile = new Tile;
+
+    // Sun from north-west 45 degrees above horizon, in east, north and up.
+    const float light[3] = { -0.5f, 0.5f, 0.70710678f };
+
+    for (int i = 0; i < TERRAIN_TILE_SIZE; i++) {
+        for (int j = 0; j < TERRAIN_TILE_SIZE; j++) {
+            int row    = (tile_row    << TERRAIN_TILE_SHIFT) + i;
+            int column = (tile_column << TERRAIN_TILE_SHIFT) + j;
+            int index  = (i << TERRAIN_TILE_SHIFT) + j;
+            int height = TERRAIN_VOID;
+
+            if (row < terrain_samples_ && column < terrain_samples_) {
+                height = getTerrainHeight(row, column);
+            }
+            else {
+                ;
+            }
+
+            if (height == TERRAIN_VOID) {
+                tile->tile_height[index] = 0.0f;
+                tile->tile_color[index]  = 0;
+                continue;
+            }
+            else {
+                ;
+            }
+
+            int height_w = getTerrainHeight(row, column - 1);
+            int height_e = getTerrainHeight(row, column + 1);
+            int height_n = getTerrainHeight(row - 1, column);
+            int height_s = getTerrainHeight(row + 1, column);
+
+            height_w = (height_w == TERRAIN_VOID) ? height : height_w;
+            height_e = (height_e == TERRAIN_VOID) ? height : height_e;
+            height_n = (height_n == TERRAIN_VOID) ? height : height_n;
+            height_s = (height_s == TERRAIN_VOID) ? height : height_s;
+
+            float normal[3] = {
+                -(height_e - height_w) / (2.0f * terrain_spacing_east_),
+                -(height_n - height_s) / (2.0f * terrain_spacing_north_),
+                1.0f
+            };
+            float shade = (normal[0] * light[0] + normal[1] * light[1] +
+                           normal[2] * light[2]) /
+                sqrtf(normal[0] * normal[0] + normal[1] * normal[1] +
+                      normal[2] * normal[2]);
+
+            tile->tile_height[index] = height;
+            tile->tile_color[index]  = getTerrainColor(
+                height, 0.35f + 0.65f * qBound(0.0f, shade, 1.0f));
+        }
+    }
+
+    terrain_tiles_.insert(key, tile);
+
+    return tile;
+}
+
+int FCSInstrucmentTerrainMap::getTerrainHeight(int row, int column) const
+{
+    row    = qBound(0, row,    terrain_samples_ - 1);
+    column = qBound(0, column, terrain_samples_ - 1);
+
+    const uchar *sample = terrain_data_ +
+        ((qint64)row * terrain_samples_ + column) * 2;
+
+    return (qint16)((sample[0] << 8) | sample[1]);
+}
+
+quint32 FCSInstrucmentTerrainMap::getTerrainColor(int height,
+                                                  float shade) const
+{
+    // Hypsometric tints from lowland green to rock, sea level is water.
+    static const int stops[][4] = {
+        {    0,  60, 120, 180 },
+        {    1,  84, 130,  53 },
+        {  400, 140, 160,  70 },
+        { 1000, 170, 150,  90 },
+        { 2000, 140, 110,  80 },
+        { 3500, 210, 210, 210 }
+    };
+    static const int count = sizeof(stops) / sizeof(stops[0]);
+
+    int   index = 0;
+    float ratio = 0.0f;
+
+    if (height >= stops[count - 1][0]) {
+        index = count - 2;
+        ratio = 1.0f;
+    }
+    else if (height > stops[0][0]) {
+        while (height >= stops[index + 1][0]) {
+            index++;
+        }
+
+        ratio = (float)(height - stops[index][0]) /
+            (stops[index + 1][0] - stops[index][0]);
+    }
+    else {
+        ;
+    }
+
+    quint32 color = 0xff000000;
+
+    for (int i = 1; i <= 3; i++) {
+        float value = stops[index][i] +
+            (stops[index + 1][i] - stops[index][i]) * ratio;
+
+        color |= (quint32)(value * shade) << (8 * (3 - i));
+    }
+
+    return color;
+}
+
+void FCSInstrucmentTerrainMap::updateTerrainOrigin(double latitude,
+                                                   double longitude)
+{
+    if (!isTerrainValid()) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    float intervals = terrain_samples_ - 1;
+
+    // Shading depends on spacing, which changes with latitude.
+    terrain_tiles_.clear();
+    terrain_tile_key_ = -1;
+    terrain_tile_     = 0;
+
+    // Rows start at north edge of tile, columns at west edge.
+    terrain_origin_row_    = (terrain_latitude_ + 1.0 - latitude) * intervals;
+    terrain_origin_column_ = (longitude - terrain_longitude_) * intervals;
+    terrain_spacing_north_ = 111320.0f / intervals;
+    terrain_spacing_east_  = terrain_spacing_north_ *
+        qMax(cos(latitude * M_PI / 180.0), 0.01);
+
+    int height = getTerrainHeight(qRound(terrain_origin_row_),
+                                  qRound(terrain_origin_column_));
+
+    terrain_origin_height_ = (height == TERRAIN_VOID) ? 0.0f : height;
+}
+
+/*****************************************************************************/
+
+FCSInstrucmentTerrainItem::FCSInstrucmentTerrainItem(float size,
+                                                     float pix_per_deg,
+                                                     QGraphicsItem *parent) :
+    QGraphicsItem(parent),
+    terrain_map_(0),
+    terrain_size_(size),
+    terrain_pix_per_deg_(pix_per_deg),
+    terrain_x_(0.0f),
+    terrain_y_(0.0f),
+    terrain_z_(0.0f),
+    terrain_heading_(0.0f),
+    terrain_pitch_(0.0f),
+    terrain_dirty_(true)
+{
+}
+
+FCSInstrucmentTerrainItem::~FCSInstrucmentTerrainItem()
+{
+}
+
+QRectF FCSInstrucmentTerrainItem::boundingRect() const
+{
+    return QRectF(0.0f, 0.0f, terrain_size_, terrain_size_);
+}
+
+void FCSInstrucmentTerrainItem::paint(QPainter *painter,
+                                      const QStyleOptionGraphicsItem *option,
+                                      QWidget *widget)
+{
+    Q_UNUSED(option);
+    Q_UNUSED(widget);
+
+    if (terrain_map_ == 0 || !terrain_map_->isTerrainValid()) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    // Image follows device resolution including pixel ratio, so it is
+    // rendered once per pose and only resampled by rotation.
+    QTransform transform = painter->deviceTransform();
+    float scale = sqrtf(transform.m11() * transform.m11() +
+                        transform.m12() * transform.m12());
+    int   size  = qBound(16, qCeil(terrain_size_ * scale), TERRAIN_IMAGE_MAX);
+
+    if (terrain_dirty_ || size != terrain_image_.width()) {
+        renderTerrain(size);
+        terrain_dirty_ = false;
+    }
+    else {
+        ;
+    }
+
+    // Image rows hold screen columns, so the transposed image is drawn with
+    // axes swapped back.
+    painter->save();
+    painter->setRenderHint(QPainter::SmoothPixmapTransform);
+    painter->setTransform(QTransform(0.0, 1.0, 1.0, 0.0, 0.0, 0.0), true);
+    painter->drawImage(boundingRect(), terrain_image_);
+    painter->restore();
+}
+
+void FCSInstrucmentTerrainItem::setTerrainMap(
+    const FCSInstrucmentTerrainMap *terrain_map)
+{
+    terrain_map_   = terrain_map;
+    terrain_dirty_ = true;
+
+    update();
+}
+
+void FCSInstrucmentTerrainItem::setTerrainPose(float x, float y, float z,
+                                               float heading, float pitch)
+{
+    if (x == terrain_x_ && y == terrain_y_ && z == terrain_z_ &&
+        heading == terrain_heading_ && pitch == terrain_pitch_) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    terrain_x_       = x;
+    terrain_y_       = y;
+    terrain_z_       = z;
+    terrain_heading_ = heading;
+    terrain_pitch_   = pitch;
+    terrain_dirty_   = true;
+
+    update();
+}
+
+void FCSInstrucmentTerrainItem::renderTerrain(int size)
+{
+    if (terrain_image_.width() != size) {
+        terrain_image_ = QImage(size, size,
+                                QImage::Format_ARGB32_Premultiplied);
+        terrain_ybuffer_.resize(size);
+    }
+    else {
+        ;
+    }
+
+    for (int i = 0; i < size; i++) {
+        terrain_ybuffer_[i] = size;
+    }
+
+    float scale   = size / terrain_size_;
+    float focal   = terrain_pix_per_deg_ * scale * 180.0f / M_PI;
+    float center  = size / 2.0f;
+    float horizon = center + terrain_pix_per_deg_ * scale * terrain_pitch_;
+
+    float spacing_north = terrain_map_->getTerrainSpacingNorth();
+    float spacing_east  = terrain_map_->getTerrainSpacingEast();
+    float camera_height = terrain_map_->getTerrainOriginHeight() + terrain_z_;
+    float camera_row    = 0.0f;
+    float camera_column = 0.0f;
+
+    terrain_map_->getTerrainPosition(terrain_x_, terrain_y_, &camera_row,
+                                     &camera_column);
+
+    // Forward and right directions in samples per meter, rows run south.
+    float heading_rad    = terrain_heading_ * M_PI / 180.0f;
+    float forward_row    = -cos(heading_rad) / spacing_north;
+    float forward_column =  sin(heading_rad) / spacing_east;
+    float right_row      =  sin(heading_rad) / spacing_north;
+    float right_column   =  cos(heading_rad) / spacing_east;
+    float step_min       = 0.5f * qMin(spacing_north, spacing_east);
+
+    int  *ybuffer  = terrain_ybuffer_.data();
+    int   finished = 0;
+    float depth    = TERRAIN_DEPTH_MIN;
+
+    // Front to back, every column only fills rows above what nearer
+    // terrain already covered.
+    while (depth < TERRAIN_DEPTH_MAX && finished < size) {
+        float offset        = -center / focal * depth;
+        float row           = camera_row    + forward_row    * depth +
+            right_row    * offset;
+        float column        = camera_column + forward_column * depth +
+            right_column * offset;
+        float row_step      = right_row    * depth / focal;
+        float column_step   = right_column * depth / focal;
+        float height_scale  = focal / depth;
+        int   fog           = (int)(TERRAIN_FOG_MAX * depth /
+                                    TERRAIN_DEPTH_MAX);
+
+        for (int i = 0; i < size; i++, row += row_step,
+             column += column_step) {
+            float   height = 0.0f;
+            quint32 color  = 0;
+
+            if (ybuffer[i] == 0 ||
+                !terrain_map_->getTerrainSample((int)floorf(row),
+                                                (int)floorf(column),
+                                                &height, &color)) {
+                continue;
+            }
+            else {
+                ;
+            }
+
+            int top = (int)(horizon + (camera_height - height) *
+                            height_scale);
+
+            if (top >= ybuffer[i]) {
+                continue;
+            }
+            else if (top <= 0) {
+                top = 0;
+                finished++;
+            }
+            else {
+                ;
+            }
+
+            fillTerrainSpan((quint32 *)terrain_image_.scanLine(i) + top,
+                            ybuffer[i] - top, blendTerrainFog(color, fog));
+            ybuffer[i] = top;
+        }
+
+        depth += qMax(depth * TERRAIN_DEPTH_STEP, step_min);
+    }
+
+    // Sky is left transparent, ADI background shows through.
+    for (int i = 0; i < size; i++) {
+        fillTerrainSpan((quint32 *)terrain_image_.scanLine(i), ybuffer[i], 0);
+    }
+}
+
+void FCSInstrucmentTerrainItem::fillTerrainSpan(quint32 *span, int length,
+                                                quint32 color)
+{
+#ifdef __SSE2__
+    __m128i value = _mm_set1_epi32((int)color);
+
+    for (; length >= 4; length -= 4, span += 4) {
+        _mm_storeu_si128((__m128i *)span, value);
+    }
+#endif
+
+    for (; length > 0; length--, span++) {
+        *span = color;
+    }
+}
@@ -0,0 +1,219 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_value_filter.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements the presentation filter of instrucments, which
+ * turns low rate telemetry samples of one channel into values at display rate.
+ *****************************************************************************/
+
+#include <math.h>
+#include <fcs_instrucment_value_filter.h>
+
+FCSInstrucmentValueFilter::FCSInstrucmentValueFilter(float wrap_min,
+                                                     float wrap_max) :
+    filter_mode_(NONE),
+    filter_wrap_min_(wrap_min),
+    filter_wrap_max_(wrap_max),
+    filter_value_from_(0.0f),
+    filter_value_old_(0.0f),
+    filter_value_new_(0.0f),
+    filter_time_old_(0),
+    filter_time_new_(0),
+    filter_rate_(0.0f),
+    filter_rate_valid_(false),
+    filter_sample_count_(0)
+{
+}
+
+FCSInstrucmentValueFilter::~FCSInstrucmentValueFilter()
+{
+}
+
+void FCSInstrucmentValueFilter::setFilterMode(FilterMode filter_mode)
+{
+    filter_mode_ = filter_mode;
+}
+
+void FCSInstrucmentValueFilter::addSample(float value, qint64 time)
+{
+    // Interpolation starts from presented value instead of old sample,
+    // so a new sample never makes the display jump back.
+    if (filter_sample_count_ > 0) {
+        filter_value_from_ = getValue(time);
+        filter_value_old_  = filter_value_new_;
+        filter_time_old_   = filter_time_new_;
+    }
+    else {
+        filter_value_from_ = value;
+        filter_value_old_  = value;
+        filter_time_old_   = time;
+    }
+
+    filter_value_new_ = value;
+    filter_time_new_  = time;
+
+    if (filter_sample_count_ < 2) {
+        filter_sample_count_++;
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentValueFilter::setRate(float rate)
+{
+    filter_rate_       = rate;
+    filter_rate_valid_ = true;
+}
+
+float FCSInstrucmentValueFilter::getValue(qint64 time) const
+{
+    if (filter_mode_ == NONE || filter_sample_count_ < 2) {
+        return filter_value_new_;
+    }
+    else {
+        ;
+    }
+
+    qint64 period = filter_time_new_ - filter_time_old_;
+
+    if (period < 1) {
+        period = 1;
+    }
+    else {
+        ;
+    }
+
+    if (filter_mode_ == INTERPOLATE) {
+        // Display runs one sample period behind, so it always sits
+        // between two known values and never overshoots.
+        float delta = wrapDelta(filter_value_new_ - filter_value_from_);
+        float ratio = (float)(time - period - filter_time_old_) / period;
+
+        ratio = qBound(0.0f, ratio, 1.0f);
+
+        return wrapValue(filter_value_from_ + delta * ratio);
+    }
+    else {
+        float rate = filter_rate_;
+
+        if (!filter_rate_valid_) {
+            rate = wrapDelta(filter_value_new_ - filter_value_old_) *
+                   1000.0f / period;
+        }
+        else {
+            ;
+        }
+
+        // Prediction is held after one sample period, so a lost sample
+        // freezes the display instead of running away.
+        qint64 elapse = qBound((qint64)0, time - filter_time_new_, period);
+
+        return wrapValue(filter_value_new_ + rate * elapse / 1000.0f);
+    }
+}
+
+bool FCSInstrucmentValueFilter::isMoving(qint64 time) const
+{
+    if (filter_mode_ == NONE || filter_sample_count_ < 2) {
+        return false;
+    }
+    else {
+        ;
+    }
+
+    // Both modes settle one sample period after newest sample.
+    return time < 2 * filter_time_new_ - filter_time_old_;
+}
+
+void FCSInstrucmentValueFilter::resetFilter(void)
+{
+    filter_value_from_   = 0.0f;
+    filter_value_old_    = 0.0f;
+    filter_value_new_    = 0.0f;
+    filter_time_old_     = 0;
+    filter_time_new_     = 0;
+    filter_rate_         = 0.0f;
+    filter_rate_valid_   = false;
+    filter_sample_count_ = 0;
+}
+
+float FCSInstrucmentValueFilter::wrapValue(float value) const
+{
+    float range = filter_wrap_max_ - filter_wrap_min_;
+
+    if (range <= 0.0f) {
+        return value;
+    }
+    else {
+        ;
+    }
+
+    value = fmod(value - filter_wrap_min_, range);
+
+    if (value < 0.0f) {
+        value += range;
+    }
+    else {
+        ;
+    }
+
+    return value + filter_wrap_min_;
+}
+
+float FCSInstrucmentValueFilter::wrapDelta(float delta) const
+{
+    float range = filter_wrap_max_ - filter_wrap_min_;
+
+    if (range <= 0.0f) {
+        return delta;
+    }
+    else {
+        ;
+    }
+
+    // Shortest way round, e.g. 350 to 10 deg turns 20 deg, not -340.
+    delta = fmod(delta, range);
+
+    if (delta > range / 2.0f) {
+        delta -= range;
+    }
+    else if (delta < -range / 2.0f) {
+        delta += range;
+    }
+    else {
+        ;
+    }
+
+    return delta;
+}
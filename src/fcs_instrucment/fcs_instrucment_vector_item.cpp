@@ -0,0 +1,239 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_vector_item.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements the item drawing instrucment layers from painter
+ * path tables compiled out of svg files at build time.
+ *****************************************************************************/
+
+#include <QLinearGradient>
+#include <QRadialGradient>
+#include <QTransform>
+#include <QVector>
+#include <fcs_instrucment_vector_item.h>
+
+const FCSInstrucmentVectorData *FCSInstrucmentVectorShape::findData(
+    const QString &path)
+{
+    const QByteArray name = path.toUtf8();
+
+    for (int i = 0; fcs_instrucment_vector_table[i] != 0; i++) {
+        if (name == fcs_instrucment_vector_table[i]->data_path) {
+            return fcs_instrucment_vector_table[i];
+        }
+        else {
+            ;
+        }
+    }
+
+    return 0;
+}
+
+FCSInstrucmentVectorShape::FCSInstrucmentVectorShape(
+    const FCSInstrucmentVectorData *data) :
+    shape_data_(data),
+    shape_bounds_(0.0, 0.0, data->data_width, data->data_height)
+{
+    static const Qt::PenCapStyle caps[] = {
+        Qt::FlatCap, Qt::RoundCap, Qt::SquareCap
+    };
+    static const Qt::PenJoinStyle joins[] = {
+        Qt::SvgMiterJoin, Qt::RoundJoin, Qt::BevelJoin
+    };
+
+    for (int i = 0; i < shape_data_->data_layer_count; i++) {
+        const FCSInstrucmentVectorLayer &data_layer =
+            shape_data_->data_layers[i];
+        const float *points = data_layer.layer_points;
+        Layer        layer;
+
+        for (const char *command = data_layer.layer_commands; *command != '\0';
+             command++) {
+            if (*command == 'M') {
+                layer.layer_path.moveTo(points[0], points[1]);
+                points += 2;
+            }
+            else if (*command == 'L') {
+                layer.layer_path.lineTo(points[0], points[1]);
+                points += 2;
+            }
+            else if (*command == 'C') {
+                layer.layer_path.cubicTo(points[0], points[1], points[2],
+                                         points[3], points[4], points[5]);
+                points += 6;
+            }
+            else {
+                layer.layer_path.closeSubpath();
+            }
+        }
+
+        layer.layer_path.setFillRule(data_layer.layer_fill_rule == 1 ?
+                                     Qt::OddEvenFill : Qt::WindingFill);
+        layer.layer_brush = createBrush(data_layer.layer_fill,
+                                        data_layer.layer_fill_gradient);
+
+        if (data_layer.layer_stroke_width > 0.0f) {
+            float width = data_layer.layer_stroke_width;
+
+            layer.layer_pen = QPen(createBrush(
+                                       data_layer.layer_stroke,
+                                       data_layer.layer_stroke_gradient),
+                                   width);
+            layer.layer_pen.setCapStyle(caps[data_layer.layer_stroke_cap]);
+            layer.layer_pen.setJoinStyle(joins[data_layer.layer_stroke_join]);
+            layer.layer_pen.setMiterLimit(data_layer.layer_stroke_miter);
+
+            // Qt measures dashes in pen widths, svg in document units.
+            if (data_layer.layer_dash_count > 0) {
+                QVector<qreal> dashes;
+
+                for (int j = 0; j < data_layer.layer_dash_count; j++) {
+                    dashes.append(data_layer.layer_dashes[j] / width);
+                }
+
+                layer.layer_pen.setDashPattern(dashes);
+                layer.layer_pen.setDashOffset(data_layer.layer_dash_offset /
+                                              width);
+            }
+            else {
+                ;
+            }
+        }
+        else {
+            layer.layer_pen = QPen(Qt::NoPen);
+        }
+
+        shape_layers_.append(layer);
+    }
+}
+
+FCSInstrucmentVectorShape::~FCSInstrucmentVectorShape()
+{
+}
+
+QRectF FCSInstrucmentVectorShape::getShapeBounds(void) const
+{
+    return shape_bounds_;
+}
+
+void FCSInstrucmentVectorShape::paintShape(QPainter *painter) const
+{
+    for (int i = 0; i < shape_layers_.size(); i++) {
+        painter->setPen(shape_layers_[i].layer_pen);
+        painter->setBrush(shape_layers_[i].layer_brush);
+        painter->drawPath(shape_layers_[i].layer_path);
+    }
+}
+
+QBrush FCSInstrucmentVectorShape::createBrush(unsigned int color,
+                                              int gradient) const
+{
+    if (gradient < 0) {
+        if ((color >> 24) == 0) {
+            return QBrush(Qt::NoBrush);
+        }
+        else {
+            return QBrush(QColor::fromRgba(color));
+        }
+    }
+    else {
+        ;
+    }
+
+    static const QGradient::Spread spreads[] = {
+        QGradient::PadSpread, QGradient::ReflectSpread,
+        QGradient::RepeatSpread
+    };
+
+    const FCSInstrucmentVectorGradient &data_gradient =
+        shape_data_->data_gradients[gradient];
+    const float *coords = data_gradient.gradient_coords;
+    const float *matrix = data_gradient.gradient_matrix;
+    QGradient   *brush_gradient;
+
+    if (data_gradient.gradient_type == 0) {
+        brush_gradient = new QLinearGradient(coords[0], coords[1], coords[2],
+                                             coords[3]);
+    }
+    else {
+        brush_gradient = new QRadialGradient(coords[0], coords[1], coords[2],
+                                             coords[3], coords[4]);
+    }
+
+    brush_gradient->setSpread(spreads[data_gradient.gradient_spread]);
+
+    for (int i = 0; i < data_gradient.gradient_stop_count; i++) {
+        const float *stop = data_gradient.gradient_stops + i * 5;
+
+        brush_gradient->setColorAt(qBound(0.0f, stop[0], 1.0f),
+                                   QColor(qRound(stop[1]), qRound(stop[2]),
+                                          qRound(stop[3]), qRound(stop[4])));
+    }
+
+    QBrush brush(*brush_gradient);
+
+    brush.setTransform(QTransform(matrix[0], matrix[1], matrix[2], matrix[3],
+                                  matrix[4], matrix[5]));
+
+    delete brush_gradient;
+
+    return brush;
+}
+
+FCSInstrucmentVectorItem::FCSInstrucmentVectorItem(
+    const FCSInstrucmentVectorShape *shape, QGraphicsItem *parent) :
+    QGraphicsItem(parent),
+    vector_shape_(shape)
+{
+    // Same default as QGraphicsSvgItem, static layers render once.
+    setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+}
+
+FCSInstrucmentVectorItem::~FCSInstrucmentVectorItem()
+{
+}
+
+QRectF FCSInstrucmentVectorItem::boundingRect() const
+{
+    return vector_shape_->getShapeBounds();
+}
+
+void FCSInstrucmentVectorItem::paint(QPainter *painter,
+                                     const QStyleOptionGraphicsItem *option,
+                                     QWidget *widget)
+{
+    Q_UNUSED(option);
+    Q_UNUSED(widget);
+
+    vector_shape_->paintShape(painter);
+}
@@ -0,0 +1,131 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_view.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements the graphics view shared by all instrucments,
+ * which builds its scene on first show, paints frames through the viewport
+ * helper and times them.
+ *****************************************************************************/
+
+#include <fcs_instrucment_profiler.h>
+#include <fcs_instrucment_render_clock.h>
+#include <fcs_instrucment_view.h>
+
+FCSInstrucmentView::FCSInstrucmentView(const char *probe_name,
+                                       QWidget *parent) :
+    QGraphicsView(parent),
+    view_probe_(FCSInstrucmentProfiler::registerProbe(probe_name)),
+    view_built_(false)
+{
+}
+
+FCSInstrucmentView::~FCSInstrucmentView()
+{
+}
+
+void FCSInstrucmentView::buildInstrucment(void)
+{
+    if (view_built_) {
+        return ;
+    }
+    else {
+        view_built_ = true;
+    }
+
+    initInstrucment();
+
+    // Values set before build are applied by next update of instrucment.
+    FCSInstrucmentRenderClock::getInstance()->requestFrame();
+}
+
+bool FCSInstrucmentView::isInstrucmentBuilt(void) const
+{
+    return view_built_;
+}
+
+void FCSInstrucmentView::setViewportMode(
+    FCSInstrucmentViewport::ViewportMode viewport_mode)
+{
+    view_viewport_.setViewportMode(this, viewport_mode);
+}
+
+FCSInstrucmentViewport::ViewportMode FCSInstrucmentView::getViewportMode(
+    void) const
+{
+    return view_viewport_.getViewportMode();
+}
+
+void FCSInstrucmentView::setRenderScale(float render_scale)
+{
+    view_viewport_.setRenderScale(this, render_scale);
+}
+
+float FCSInstrucmentView::getRenderScale(void) const
+{
+    return view_viewport_.getRenderScale();
+}
+
+float FCSInstrucmentView::getFrameTime(void) const
+{
+    return view_viewport_.getFrameTime();
+}
+
+void FCSInstrucmentView::showEvent(QShowEvent *event)
+{
+    buildInstrucment();
+
+    QGraphicsView::showEvent(event);
+}
+
+void FCSInstrucmentView::paintEvent(QPaintEvent *event)
+{
+    FCSInstrucmentProfilerScope profiler_scope(view_probe_);
+
+    view_viewport_.startFrame(this);
+
+    if (!view_viewport_.paintFrame(this, event->region())) {
+        QGraphicsView::paintEvent(event);
+    }
+    else {
+        ;
+    }
+
+    view_viewport_.finishFrame();
+}
+
+bool FCSInstrucmentView::isViewFrozen(void) const
+{
+    // Values keep arriving while items are missing or hidden, build and next
+    // show ask for a frame which applies the latest of them.
+    return !view_built_ || !updatesEnabled();
+}
@@ -0,0 +1,248 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_viewport.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements viewport settings of instrucments, which switch
+ * views between raster and OpenGL viewports, scale their render resolution
+ * and measure their frame time.
+ *****************************************************************************/
+
+#include <QOpenGLWidget>
+#include <QPainter>
+#include <QSurfaceFormat>
+#include <QtMath>
+#include <fcs_instrucment_viewport.h>
+
+#define VIEWPORT_SAMPLES     4
+#define VIEWPORT_TIME_WEIGHT 0.1f
+
+FCSInstrucmentViewport::FCSInstrucmentViewport() :
+    viewport_mode_(RASTER),
+    viewport_ratio_(0.0),
+    viewport_render_scale_(1.0f),
+    viewport_frame_time_(0.0f)
+{
+}
+
+FCSInstrucmentViewport::~FCSInstrucmentViewport()
+{
+}
+
+void FCSInstrucmentViewport::setViewportMode(QGraphicsView *view,
+                                             ViewportMode viewport_mode)
+{
+    if (!view) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    viewport_mode_       = viewport_mode;
+    viewport_frame_time_ = 0.0f;
+
+    if (viewport_mode_ == OPENGL) {
+        QOpenGLWidget  *viewport = new QOpenGLWidget();
+        QSurfaceFormat  format   = QSurfaceFormat::defaultFormat();
+
+        // GL paint engine antialiases through multisampling, which is
+        // cheap enough to keep on for every item.
+        format.setSamples(VIEWPORT_SAMPLES);
+        viewport->setFormat(format);
+
+        view->setViewport(viewport);
+        // GL surface is redrawn as a whole on every swap, so tracking
+        // dirty regions only costs time.
+        view->setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+        view->setRenderHint(QPainter::Antialiasing, true);
+        view->setRenderHint(QPainter::SmoothPixmapTransform, true);
+    }
+    else {
+        view->setViewport(new QWidget());
+        view->setViewportUpdateMode(QGraphicsView::MinimalViewportUpdate);
+        view->setRenderHint(QPainter::Antialiasing, false);
+        view->setRenderHint(QPainter::SmoothPixmapTransform, false);
+    }
+}
+
+FCSInstrucmentViewport::ViewportMode FCSInstrucmentViewport::getViewportMode(
+    void) const
+{
+    return viewport_mode_;
+}
+
+void FCSInstrucmentViewport::setRenderScale(QGraphicsView *view,
+                                            float render_scale)
+{
+    if (!view) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    viewport_render_scale_ = qBound(VIEWPORT_SCALE_MIN, render_scale, 1.0f);
+    viewport_frame_time_   = 0.0f;
+    viewport_image_        = QImage();
+
+    view->viewport()->update();
+}
+
+float FCSInstrucmentViewport::getRenderScale(void) const
+{
+    return viewport_render_scale_;
+}
+
+void FCSInstrucmentViewport::startFrame(QGraphicsView *view)
+{
+    viewport_timer_.start();
+
+    if (!view) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    qreal ratio = view->viewport()->devicePixelRatioF();
+
+    // Moving to a screen of other pixel ratio keeps widget size, so cached
+    // layers are flushed to be rasterized at physical resolution again.
+    if (ratio != viewport_ratio_) {
+        if (viewport_ratio_ != 0.0 && view->scene()) {
+            flushItemCache(view);
+        }
+        else {
+            ;
+        }
+
+        viewport_ratio_ = ratio;
+    }
+    else {
+        ;
+    }
+}
+
+void FCSInstrucmentViewport::finishFrame(void)
+{
+    // With OpenGL viewport this is the time to record commands, the GPU
+    // may still be busy after paintEvent returns.
+    float frame_time = viewport_timer_.nsecsElapsed() / 1000000.0f;
+
+    if (viewport_frame_time_ == 0.0f) {
+        viewport_frame_time_ = frame_time;
+    }
+    else {
+        viewport_frame_time_ += VIEWPORT_TIME_WEIGHT *
+                                (frame_time - viewport_frame_time_);
+    }
+}
+
+float FCSInstrucmentViewport::getFrameTime(void) const
+{
+    return viewport_frame_time_;
+}
+
+bool FCSInstrucmentViewport::paintFrame(QGraphicsView *view,
+                                        const QRegion &region)
+{
+    if (viewport_render_scale_ >= 1.0f || !view) {
+        return false;
+    }
+    else {
+        ;
+    }
+
+    QWidget *viewport = view->viewport();
+    qreal    scale    = viewport_ratio_ * viewport_render_scale_;
+    QSize    size(qCeil(viewport->width()  * scale),
+                  qCeil(viewport->height() * scale));
+    QRect    rect = region.boundingRect();
+
+    // Image is only reallocated when size, pixel ratio or scale changes.
+    // It is scaled by painter instead of its own pixel ratio, item caches
+    // fail to rasterize for devices whose pixel ratio is below 1.
+    if (viewport_image_.size() != size) {
+        viewport_image_ = QImage(size, QImage::Format_ARGB32_Premultiplied);
+        rect = viewport->rect();
+    }
+    else {
+        ;
+    }
+
+    // Image keeps former frames, only exposed rect is rendered again. It is
+    // widened to whole pixels of image, so no half covered pixel is left
+    // at its border.
+    QTransform transform = QTransform::fromScale(scale, scale);
+    QRect      image_rect;
+    QRect      source_rect;
+
+    image_rect  = transform.mapRect(QRectF(rect)).toAlignedRect() &
+                  viewport_image_.rect();
+    source_rect = transform.inverted().mapRect(
+        QRectF(image_rect)).toAlignedRect();
+
+    QPainter image_painter(&viewport_image_);
+    image_painter.setClipRect(image_rect);
+    image_painter.setCompositionMode(QPainter::CompositionMode_Source);
+    image_painter.fillRect(image_rect, Qt::transparent);
+    image_painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+    image_painter.setRenderHints(view->renderHints());
+    image_painter.scale(scale, scale);
+    view->render(&image_painter, QRectF(source_rect), source_rect);
+    image_painter.end();
+
+    QPainter viewport_painter(viewport);
+    viewport_painter.setClipRect(rect);
+    viewport_painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    viewport_painter.drawImage(QRectF(viewport->rect()), viewport_image_);
+
+    return true;
+}
+
+void FCSInstrucmentViewport::flushItemCache(QGraphicsView *view)
+{
+    QList<QGraphicsItem *> items = view->scene()->items();
+
+    for (int i = 0; i < items.size(); i++) {
+        QGraphicsItem::CacheMode cache_mode = items[i]->cacheMode();
+
+        if (cache_mode != QGraphicsItem::NoCache) {
+            items[i]->setCacheMode(QGraphicsItem::NoCache);
+            items[i]->setCacheMode(cache_mode);
+        }
+        else {
+            ;
+        }
+    }
+}
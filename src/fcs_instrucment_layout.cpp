@@ -36,7 +36,8 @@
  *
  * Description:
  * This .cpp file implements the square layout of instrucments according to
- * QFlightInstruments project.
+ * QFlightInstruments project, several instrucments are placed in a grid of
+ * square cells.
  *****************************************************************************/
 
 #include <fcs_instrucment_layout.h>
@@ -55,87 +56,60 @@ FCSInstrucmentLayout::FCSInstrucmentLayout(int spacing) :
 
 FCSInstrucmentLayout::~FCSInstrucmentLayout()
 {
-    if (layout_item_) {
-        delete layout_item_;
-    }
-    else {
-        ;
-    }
-
-    layout_item_ = 0;
-
-    if (layout_rect_last_) {
-        delete layout_rect_last_;
-    }
-    else {
-        ;
-    }
-
-    layout_rect_last_ = 0;
-
-    if (layout_geometry_) {
-        delete layout_geometry_;
-    }
-    else {
-        ;
-    }
-
-    layout_geometry_ = 0;
+    qDeleteAll(layout_items_);
+    layout_items_.clear();
 }
 
 void FCSInstrucmentLayout::addItem(QLayoutItem *item)
 {
-    if (!hasItem()) {
-        replaceItem(item);
-    }
-    else {
-        ;
-    }
+    layout_items_.append(item);
+
+    applyGeometry();
 }
 
 void FCSInstrucmentLayout::addWidget(QWidget *widget)
 {
-    if (!hasItem()) {
-        replaceItem(new QWidgetItem(widget));
-    }
-    else {
-        ;
-    }
+    addItem(new QWidgetItem(widget));
 }
 
 void FCSInstrucmentLayout::setGeometry(const QRect &rect)
 {
-    if (!hasItem() || areRectEqual(*layout_rect_last_, rect)) {
-        return;
+    if (layout_rect_last_ == rect) {
+        return ;
     }
     else {
         ;
     }
 
-    setRectLast(rect);
-
-    QSize  proper_size  = calculateProperSize(rect.size());
-    QPoint center_point = calculateCenterPoint(rect.size(), proper_size);
-
-    layout_item_->setGeometry(QRect(center_point, proper_size));
+    layout_rect_last_ = rect;
 
-    QRect *temp_rect = layout_geometry_;
+    // Resizing children rebuilds their scenes, so while window is dragged
+    // only the last geometry is applied after it settles. The first one is
+    // applied at once to avoid showing unplaced instrucments.
+    if (layout_timer_.interval() == 0 || layout_geometry_.isNull()) {
+        layout_timer_.stop();
+        applyGeometry();
+    }
+    else {
+        layout_timer_.start();
+    }
+}
 
-    layout_geometry_ = new QRect(center_point, proper_size);
+void FCSInstrucmentLayout::setLayoutColumns(int columns)
+{
+    layout_columns_ = qMax(columns, 1);
 
-    delete temp_rect;
+    applyGeometry();
+}
 
-    QLayout::setGeometry(*layout_geometry_);
+void FCSInstrucmentLayout::setLayoutSettleDelay(int msec)
+{
+    layout_timer_.setInterval(qMax(msec, 0));
 }
 
 int FCSInstrucmentLayout::count() const
 {
-    if (hasItem()) {
-        return 1;
-    }
-    else {
-        return 0;
-    }
+    return layout_items_.size();
 }
 
 bool FCSInstrucmentLayout::hasHeightForWidth() const
@@ -145,22 +119,29 @@ bool FCSInstrucmentLayout::hasHeightForWidth() const
 
 bool FCSInstrucmentLayout::hasItem() const
 {
-    return (layout_item_ != 0);
+    return !layout_items_.isEmpty();
 }
 
 QSize FCSInstrucmentLayout::minimumSize() const
 {
-    return layout_item_->minimumSize();
+    QSize cell_size(0, 0);
+
+    for (int i = 0; i < layout_items_.size(); i++) {
+        cell_size = cell_size.expandedTo(layout_items_[i]->minimumSize());
+    }
+
+    return QSize(cell_size.width()  * qMin(layout_columns_, count()),
+                 cell_size.height() * getLayoutRows());
 }
 
 QSize FCSInstrucmentLayout::sizeHint() const
 {
-    return layout_item_->minimumSize();
+    return minimumSize();
 }
 
 QRect FCSInstrucmentLayout::geometry()
 {
-    return (QRect)(*layout_geometry_);
+    return layout_geometry_;
 }
 
 QLayoutItem* FCSInstrucmentLayout::replaceItem(QLayoutItem *item)
@@ -168,55 +149,37 @@ QLayoutItem* FCSInstrucmentLayout::replaceItem(QLayoutItem *item)
     QLayoutItem *temp_item = 0;
 
     if (hasItem()) {
-        temp_item = layout_item_;
+        temp_item = layout_items_[0];
+        layout_items_[0] = item;
     }
     else {
-        ;
+        layout_items_.append(item);
     }
 
-    layout_item_ = item;
-
-    setGeometry(*layout_geometry_);
+    applyGeometry();
 
     return temp_item;
 }
 
 QLayoutItem* FCSInstrucmentLayout::itemAt(int index) const
 {
-    if (index == 0) {
-        if (hasItem()) {
-            return layout_item_;
-        }
-        else {
-            ;
-        }
+    if (index >= 0 && index < layout_items_.size()) {
+        return layout_items_[index];
     }
     else {
-        ;
+        return 0;
     }
-
-    return 0;
 }
 
 QLayoutItem* FCSInstrucmentLayout::take()
 {
-    QLayoutItem *temp_item = 0;
-
-    if (hasItem()) {
-        temp_item = layout_item_;
-        layout_item_ = 0;
-    }
-    else {
-        ;
-    }
-
-    return temp_item;
+    return takeAt(0);
 }
 
 QLayoutItem* FCSInstrucmentLayout::takeAt(int index)
 {
-    if (index == 0) {
-        return take();
+    if (index >= 0 && index < layout_items_.size()) {
+        return layout_items_.takeAt(index);
     }
     else {
         return 0;
@@ -228,41 +191,52 @@ Qt::Orientations FCSInstrucmentLayout::expandingDirections() const
     return (Qt::Horizontal | Qt::Vertical);
 }
 
-void FCSInstrucmentLayout::init(int spacing)
+void FCSInstrucmentLayout::applyGeometry(void)
 {
-    layout_item_ = 0;
+    if (!hasItem() || layout_rect_last_.isNull()) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    const QRect &rect    = layout_rect_last_;
+    int          columns = qMin(layout_columns_, count());
+    QSize        cell_size(rect.width() / columns,
+                           rect.height() / getLayoutRows());
+    QSize        proper_size = calculateProperSize(cell_size);
+    QPoint       center_point = calculateCenterPoint(cell_size, proper_size);
+    QRect        geometry;
+
+    for (int i = 0; i < layout_items_.size(); i++) {
+        QPoint cell_point(rect.x() + (i % columns) * cell_size.width(),
+                          rect.y() + (i / columns) * cell_size.height());
+        QRect  item_rect(cell_point + center_point, proper_size);
+
+        layout_items_[i]->setGeometry(item_rect);
+        geometry |= item_rect;
+    }
 
-    layout_rect_last_ = new QRect(0, 0, 0, 0);
-    layout_geometry_  = new QRect(0, 0, 0, 0);
+    layout_geometry_ = geometry;
 
-    setSpacing(spacing);
+    QLayout::setGeometry(layout_geometry_);
 }
 
-void FCSInstrucmentLayout::setRectLast(const QRect &rect)
+void FCSInstrucmentLayout::init(int spacing)
 {
-    QRect *temp_rect = layout_rect_last_;
+    layout_columns_ = 1;
+
+    layout_timer_.setSingleShot(true);
+    layout_timer_.setInterval(LAYOUT_SETTLE_DELAY);
 
-    layout_rect_last_ = new QRect(rect.topLeft(), rect.size());
+    connect(&layout_timer_, SIGNAL(timeout()), this, SLOT(applyGeometry()));
 
-    delete temp_rect;
+    setSpacing(spacing);
 }
 
-bool FCSInstrucmentLayout::areRectEqual(const QRect &rect_1,
-                                        const QRect &rect_2) const
+int FCSInstrucmentLayout::getLayoutRows(void) const
 {
-    bool result = false;
-
-    if ((rect_1.x()      == rect_2.x())      &&
-        (rect_1.y()      == rect_2.y())      &&
-        (rect_1.height() == rect_2.height()) &&
-        (rect_1.width()  == rect_2.width())) {
-        result = true;
-    }
-    else {
-        ;
-    }
-
-     return result;
+    return (count() + layout_columns_ - 1) / layout_columns_;
 }
 
 QPoint FCSInstrucmentLayout::calculateCenterPoint(QSize form_size,
@@ -0,0 +1,160 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * fcs_instrucment_widget.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements the widget which hosts one instrucment, the scene
+ * of instrucment is built when the widget is first shown and frozen while the
+ * widget is hidden.
+ *****************************************************************************/
+
+#include <fcs_instrucment_render_clock.h>
+#include <fcs_instrucment_widget.h>
+#include <QGridLayout>
+
+FCSInstrucmentWidgetHost::FCSInstrucmentWidgetHost(FCSInstrucmentView *view,
+                                                   QWidget *parent) :
+    QWidget(parent),
+    widget_layout_(new FCSInstrucmentLayout(this)),
+    widget_frame_(0),
+    widget_view_(view),
+    widget_framed_(false)
+{
+    widget_layout_->setContentsMargins(0, 0, 0, 0);
+
+    setLayout(widget_layout_);
+
+    // View stays out of layout until its scene is built on first show.
+    widget_view_->setParent(this);
+    widget_view_->hide();
+
+    // Instrucments only display data, they never take input.
+    widget_view_->setEnabled(false);
+    widget_view_->setFocusPolicy(Qt::NoFocus);
+    widget_view_->setFrameShape(QFrame::NoFrame);
+    widget_view_->setFrameShadow(QFrame::Plain);
+    widget_view_->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    widget_view_->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    widget_view_->setInteractive(false);
+}
+
+FCSInstrucmentWidgetHost::~FCSInstrucmentWidgetHost()
+{
+}
+
+void FCSInstrucmentWidgetHost::setInstrucmentFramed(bool framed)
+{
+    widget_framed_ = framed;
+}
+
+bool FCSInstrucmentWidgetHost::isInstrucmentBuilt(void) const
+{
+    return widget_view_->isInstrucmentBuilt();
+}
+
+bool FCSInstrucmentWidgetHost::isInstrucmentFrozen(void) const
+{
+    return !widget_view_->updatesEnabled();
+}
+
+void FCSInstrucmentWidgetHost::showEvent(QShowEvent *event)
+{
+    QWidget::showEvent(event);
+
+    if (!widget_view_->isInstrucmentBuilt()) {
+        setupInstrucment();
+    }
+    else {
+        ;
+    }
+
+    freezeInstrucment(false);
+}
+
+void FCSInstrucmentWidgetHost::hideEvent(QHideEvent *event)
+{
+    QWidget::hideEvent(event);
+
+    freezeInstrucment(true);
+}
+
+FCSInstrucmentView *FCSInstrucmentWidgetHost::getInstrucmentView(void) const
+{
+    return widget_view_;
+}
+
+void FCSInstrucmentWidgetHost::setupInstrucment(void)
+{
+    if (widget_framed_) {
+        widget_frame_ = new QFrame(this);
+        widget_frame_->setObjectName("frame_instrucment");
+        widget_frame_->setStyleSheet("#frame_instrucment { "
+                                     "background-color: #000; "
+                                     "border-radius: 10px; }");
+        widget_frame_->setFrameShape(QFrame::StyledPanel);
+        widget_frame_->setFrameShadow(QFrame::Raised);
+
+        QGridLayout *frame_layout = new QGridLayout(widget_frame_);
+
+        frame_layout->setContentsMargins(4, 4, 4, 4);
+        frame_layout->addWidget(widget_view_);
+
+        widget_layout_->addWidget(widget_frame_);
+    }
+    else {
+        widget_layout_->addWidget(widget_view_);
+    }
+
+    widget_view_->buildInstrucment();
+    widget_view_->show();
+}
+
+void FCSInstrucmentWidgetHost::freezeInstrucment(bool frozen)
+{
+    if (widget_view_->updatesEnabled() == !frozen) {
+        return ;
+    }
+    else {
+        ;
+    }
+
+    widget_view_->setUpdatesEnabled(!frozen);
+
+    // Instrucment skips its updates while frozen, one frame brings it to the
+    // latest values again.
+    if (!frozen) {
+        FCSInstrucmentRenderClock::getInstance()->requestFrame();
+    }
+    else {
+        ;
+    }
+}
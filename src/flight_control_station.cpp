@@ -37,10 +37,26 @@
  *****************************************************************************/
 
 #include <QDebug>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QInputDialog>
 #include <QKeyEvent>
+#include <QtConcurrent>
 #include <flight_control_station.h>
 #include <ui_flight_control_station.h>
 #include <fcs_custom_tab_style.h>
+#include <fcs_instrucment_profiler.h>
+#include <communication_record_export.h>
+
+static bool exportRecordFile(const QString &record_file,
+                             const QString &output_dir,
+                             RecordExportFormat format)
+{
+    CommunicationRecordExport record_export;
+
+    return record_export.exportRecord(record_file.toStdString(),
+                                      output_dir.toStdString(), format);
+}
 
 FlightControlStation::FlightControlStation(QWidget *parent/*,
                                            std::string serial_url,
@@ -116,11 +132,56 @@ FlightControlStation::FlightControlStation(QWidget *parent/*,
             SLOT(openCameraViewFinder()));
     connect(ui->push_button_close, SIGNAL(clicked(bool)), this,
             SLOT(closeCameraViewFinder()));
+    export_watcher_ = new QFutureWatcher<bool>(this);
+
+    connect(export_watcher_, SIGNAL(finished()), this,
+            SLOT(finishExportFlightLog()));
+    connect(ui->action_export_flight_log, SIGNAL(triggered(bool)), this,
+            SLOT(exportFlightLog()));
     connect(ui->action_exit, SIGNAL(triggered(bool)), this, SLOT(close()));
     connect(ui->action_about, SIGNAL(triggered(bool)), this,
             SLOT(openAboutWidget()));
     connect(ui->action_about_qt, SIGNAL(triggered(bool)), qApp,
             SLOT(aboutQt()));
+
+    frame_time_label_ = new QLabel(this);
+    frame_time_timer_ = new QTimer(this);
+
+    ui->status_bar->addPermanentWidget(frame_time_label_);
+
+    connect(ui->action_opengl_instrucment, SIGNAL(toggled(bool)), this,
+            SLOT(switchInstrucmentViewport(bool)));
+    connect(ui->action_reduced_instrucment, SIGNAL(toggled(bool)), this,
+            SLOT(switchInstrucmentResolution(bool)));
+    connect(frame_time_timer_, SIGNAL(timeout()), this,
+            SLOT(updateInstrucmentFrameTime()));
+
+    frame_time_timer_->start(1000);
+
+    // Overlay floats over tabs, so it shows the same numbers whichever
+    // instrucments are visible.
+    profiler_overlay_  = new FCSInstrucmentProfilerOverlay(
+        ui->central_widget);
+    plot_replot_probe_ = FCSInstrucmentProfiler::registerProbe(
+        "plot replot");
+    plot_replot_start_ = -1;
+
+    profiler_overlay_->hide();
+
+    connect(ui->action_render_profiler, SIGNAL(toggled(bool)), this,
+            SLOT(switchRenderProfiler(bool)));
+    connect(ui->action_dump_render_profile, SIGNAL(triggered(bool)), this,
+            SLOT(dumpRenderProfile()));
+    connect(ui->widget_data_plotter, SIGNAL(beforeReplot()), this,
+            SLOT(startPlotReplot()));
+    connect(ui->widget_data_plotter, SIGNAL(afterReplot()), this,
+            SLOT(finishPlotReplot()));
+
+    // Hidden tabs keep receiving data but skip repainting it, PFD freezes
+    // itself when hidden and plots are paused by tab widget.
+    data_plotter_ = new FCSCustomTabPlot(ui->widget_data_plotter);
+
+    ui->tab_widget->registerTabConsumer(ui->tab_data_plotter, data_plotter_);
 }
 
 FlightControlStation::~FlightControlStation()
@@ -150,6 +211,154 @@ void FlightControlStation::closeCameraViewFinder(void)
     camera_->stop();
 }
 
+void FlightControlStation::exportFlightLog(void)
+{
+    if (export_watcher_->isRunning()) {
+        return ;
+    }
+
+    QString record_file = QFileDialog::getOpenFileName(
+        this, tr("Open Flight Log"), QString(),
+        tr("Flight Log (*.brz);;All Files (*)"));
+
+    if (record_file.isEmpty()) {
+        return ;
+    }
+
+    QString output_dir = QFileDialog::getExistingDirectory(
+        this, tr("Select Export Directory"),
+        QFileInfo(record_file).absolutePath());
+
+    if (output_dir.isEmpty()) {
+        return ;
+    }
+
+    QStringList formats;
+    formats << tr("CSV") << tr("Columnar");
+
+    bool flag_ok = false;
+    QString format = QInputDialog::getItem(this, tr("Export Flight Log"),
+                                           tr("Format:"), formats, 0, false,
+                                           &flag_ok);
+
+    if (!flag_ok) {
+        return ;
+    }
+
+    // The conversion runs in background, so the instruments keep updating.
+    export_watcher_->setFuture(QtConcurrent::run(
+        exportRecordFile, record_file, output_dir,
+        (format == formats[0]) ? EXPORT_CSV : EXPORT_COLUMNAR));
+
+    ui->action_export_flight_log->setEnabled(false);
+    ui->status_bar->showMessage(tr("Exporting %1...").arg(record_file));
+}
+
+void FlightControlStation::finishExportFlightLog(void)
+{
+    ui->action_export_flight_log->setEnabled(true);
+    ui->status_bar->clearMessage();
+
+    if (export_watcher_->result()) {
+        QMessageBox::information(this, tr("Export Flight Log"),
+                                 tr("Export flight log successfully!"));
+    }
+    else {
+        QMessageBox::warning(this, tr("Export Flight Log"),
+                             tr("Failed to export flight log, exported "
+                                "files may be incomplete!"));
+    }
+}
+
+void FlightControlStation::switchInstrucmentViewport(bool checked)
+{
+    if (checked) {
+        ui->widget_pfd->setPFDViewportMode(FCSInstrucmentViewport::OPENGL);
+    }
+    else {
+        ui->widget_pfd->setPFDViewportMode(FCSInstrucmentViewport::RASTER);
+    }
+
+    updateInstrucmentFrameTime();
+}
+
+void FlightControlStation::switchInstrucmentResolution(bool checked)
+{
+    // Reduced resolution is upscaled, which spares fill rate on machines
+    // too weak for large or high density displays.
+    if (checked) {
+        ui->widget_pfd->setPFDRenderScale(INSTRUCMENT_SCALE_REDUCED);
+    }
+    else {
+        ui->widget_pfd->setPFDRenderScale(1.0f);
+    }
+
+    updateInstrucmentFrameTime();
+}
+
+void FlightControlStation::updateInstrucmentFrameTime(void)
+{
+    // Shown next to the viewport name, so both modes can be compared
+    // while plots keep updating.
+    QString viewport_name = ui->action_opengl_instrucment->isChecked() ?
+                            tr("OpenGL") : tr("Raster");
+
+    frame_time_label_->setText(tr("PFD %1: %2 ms").arg(viewport_name).arg(
+        ui->widget_pfd->getPFDFrameTime(), 0, 'f', 2));
+}
+
+void FlightControlStation::switchRenderProfiler(bool checked)
+{
+    FCSInstrucmentProfiler::getInstance()->setEnabled(checked);
+    profiler_overlay_->setVisible(checked);
+}
+
+void FlightControlStation::dumpRenderProfile(void)
+{
+    QString profile_file = QFileDialog::getSaveFileName(
+        this, tr("Dump Render Profile"), QString("render_profile.csv"),
+        tr("CSV (*.csv);;All Files (*)"));
+
+    if (profile_file.isEmpty()) {
+        return ;
+    }
+
+    if (!FCSInstrucmentProfiler::getInstance()->dumpStatistics(
+            profile_file)) {
+        QMessageBox::warning(this, tr("Dump Render Profile"),
+                             tr("Failed to dump render profile!"));
+    }
+    else {
+        ui->status_bar->showMessage(
+            tr("Render profile dumped to %1").arg(profile_file), 3000);
+    }
+}
+
+void FlightControlStation::startPlotReplot(void)
+{
+    // Plot is timed by its replot signals, since replot is called inside
+    // QCustomPlot.
+    if (FCSInstrucmentProfiler::isEnabled()) {
+        plot_replot_start_ = FCSInstrucmentProfiler::getTimestamp();
+    }
+    else {
+        plot_replot_start_ = -1;
+    }
+}
+
+void FlightControlStation::finishPlotReplot(void)
+{
+    if (plot_replot_start_ >= 0) {
+        FCSInstrucmentProfiler::addSample(
+            plot_replot_probe_,
+            FCSInstrucmentProfiler::getTimestamp() - plot_replot_start_);
+        plot_replot_start_ = -1;
+    }
+    else {
+        ;
+    }
+}
+
 void FlightControlStation::openAboutWidget(void)
 {
     about_widget_ = new QMessageBox(this);
@@ -0,0 +1,52 @@
+#-------------------------------------------------
+#
+# Headless ground station without Qt for collecting telemetry
+#
+#-------------------------------------------------
+
+QT      -= core gui
+CONFIG  += console
+CONFIG  -= app_bundle
+
+TARGET   = breeze_ground_daemon
+TEMPLATE = app
+
+INCLUDEPATH += \
+    /usr/include/boost
+
+INCLUDEPATH += \
+    ../../lib/communication_link/include \
+    ../../lib/communication_publisher/include \
+    ../../lib/communication_record/include \
+    ../../lib/communication_serial/include
+
+LIBS += \
+    /usr/lib/x86_64-linux-gnu/libboost_system.so \
+    /usr/lib/x86_64-linux-gnu/libboost_thread.so \
+    -lrt
+
+HEADERS += \
+    ../../lib/communication_link/include/communication_data_type.h \
+    ../../lib/communication_link/include/communication_link.h \
+    ../../lib/communication_publisher/include/communication_publisher.h \
+    ../../lib/communication_publisher/include/communication_shared_ring.h \
+    ../../lib/communication_record/include/communication_record_format.h \
+    ../../lib/communication_record/include/communication_record_writer.h \
+    ../../lib/communication_serial/include/communication_port.h \
+    ../../lib/communication_serial/include/communication_serial_interface.h \
+    ../../lib/communication_serial/include/communication_serial_param.h \
+    ../../lib/communication_serial/include/communication_serial_port.h \
+    ../../lib/communication_serial/include/communication_udp_port.h
+
+SOURCES += \
+    main.cpp \
+    ../../lib/communication_link/src/communication_data_type.cpp \
+    ../../lib/communication_link/src/communication_link.cpp \
+    ../../lib/communication_publisher/src/communication_publisher.cpp \
+    ../../lib/communication_publisher/src/communication_shared_ring.cpp \
+    ../../lib/communication_record/src/communication_record_format.cpp \
+    ../../lib/communication_record/src/communication_record_writer.cpp \
+    ../../lib/communication_serial/src/communication_port.cpp \
+    ../../lib/communication_serial/src/communication_serial_interface.cpp \
+    ../../lib/communication_serial/src/communication_serial_port.cpp \
+    ../../lib/communication_serial/src/communication_udp_port.cpp
@@ -0,0 +1,225 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * main.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file runs the link, scheduler, recorder and republisher of
+ * ground station without gui, which is suitable for long unattended runs.
+ *****************************************************************************/
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sys/time.h>
+#include <vector>
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <communication_publisher.h>
+#include <communication_record_writer.h>
+#include <communication_serial_interface.h>
+
+using namespace communication_serial;
+
+typedef boost::shared_ptr<CommunicationPublisher> Publisher;
+
+static volatile sig_atomic_t flag_exit = 0;
+
+static void handleSignal(int signal_number)
+{
+    (void)signal_number;
+    flag_exit = 1;
+}
+
+static u_int64_t getTimestampUs(void)
+{
+    struct timeval time_value;
+    gettimeofday(&time_value, 0);
+
+    return (u_int64_t)time_value.tv_sec * 1000000 + time_value.tv_usec;
+}
+
+static void handleReceive(CommunicationRecordWriter *record_writer,
+                          std::vector<Publisher> *publishers,
+                          CommunicationDataType *data_type,
+                          CommunicationCommandState command_state,
+                          const unsigned char *data,
+                          unsigned short length)
+{
+    u_int64_t timestamp_us = getTimestampUs();
+
+    if (record_writer->getFlagOpen()) {
+        record_writer->writeFrame(timestamp_us, command_state, data, length);
+    }
+
+    // The frame has been decoded into data type already, so the snapshot is
+    // republished along with it.
+    for (size_t i = 0; i < publishers->size(); i++) {
+        (*publishers)[i]->publishFrame(timestamp_us, command_state, data,
+                                       length);
+        (*publishers)[i]->publishSnapshot(timestamp_us, *data_type);
+    }
+}
+
+static void printUsage(const char *program)
+{
+    std::cout << "Usage: " << program << " [options]" << std::endl
+              << "  -s <serial_url>   serial port, default "
+              << "serial:///dev/ttyUSB0" << std::endl
+              << "  -c <config_file>  command config, default "
+              << "config/config.txt" << std::endl
+              << "  -r <record_file>  record received frames into flight log"
+              << std::endl
+              << "  -p <publish_url>  republish received frames, udp:// or "
+              << "shm://, can be repeated, default " << PUBLISH_DEFAULT_URL
+              << std::endl
+              << "  -t <seconds>      stop after seconds, default forever"
+              << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string serial_url  = "serial:///dev/ttyUSB0";
+    std::string config_file = "config/config.txt";
+    std::string record_file = "";
+    long        duration    = 0;
+
+    std::vector<std::string> publish_urls;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2) {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        switch (argv[i][1]) {
+            case 's': {
+                serial_url = argv[++i];
+                break;
+            }
+            case 'c': {
+                config_file = argv[++i];
+                break;
+            }
+            case 'r': {
+                record_file = argv[++i];
+                break;
+            }
+            case 'p': {
+                publish_urls.push_back(argv[++i]);
+                break;
+            }
+            case 't': {
+                duration = atol(argv[++i]);
+                break;
+            }
+            default: {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+    }
+
+    signal(SIGINT, handleSignal);
+    signal(SIGTERM, handleSignal);
+
+    CommunicationSerialInterface serial_interface(serial_url, config_file);
+
+    if (!serial_interface.getFlagInit()) {
+        std::cerr << "Failed to initialized system, check the hardware!"
+                  << std::endl;
+        return 1;
+    }
+
+    CommunicationRecordWriter record_writer;
+
+    if (record_file != "" && !record_writer.openRecord(record_file)) {
+        return 1;
+    }
+
+    if (publish_urls.empty()) {
+        publish_urls.push_back(PUBLISH_DEFAULT_URL);
+    }
+
+    std::vector<Publisher> publishers;
+
+    for (size_t i = 0; i < publish_urls.size(); i++) {
+        Publisher publisher = boost::make_shared<CommunicationPublisher>(
+            publish_urls[i]);
+
+        if (!publisher->getFlagInit()) {
+            return 1;
+        }
+
+        publishers.push_back(publisher);
+    }
+
+    serial_interface.setReceiveCallback(boost::bind(
+        &handleReceive, &record_writer, &publishers,
+        serial_interface.getDataType(), _1, _2, _3));
+
+    std::cout << "Initialize system successfully, ready for communication!"
+              << std::endl;
+
+    // The scheduler counts at 100Hz, every command is sent at the frequency
+    // configured in config file.
+    boost::system_time tick_time = boost::get_system_time();
+    boost::system_time stop_time = tick_time + boost::posix_time::seconds(
+        duration);
+    int count = 0;
+
+    while (!flag_exit && (duration <= 0 || tick_time < stop_time)) {
+        serial_interface.checkShakeHandState();
+
+        for (int i = READ_GLOBAL_COORDINATE; i <= READ_ROBOT_SYSTEM_INFO; i++) {
+            serial_interface.updateCommandState(
+                (CommunicationCommandState)i, count);
+        }
+
+        count = (count + 1) % 100;
+        tick_time += boost::posix_time::milliseconds(10);
+
+        if (tick_time > boost::get_system_time()) {
+            boost::this_thread::sleep(tick_time);
+        }
+        else {
+            tick_time = boost::get_system_time();
+        }
+    }
+
+    if (record_writer.getFlagOpen() && record_writer.closeRecord()) {
+        std::cout << "Save flight log " << record_file << " successfully!"
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+#-------------------------------------------------
+#
+# Headless rendering benchmark of instrucments
+#
+#-------------------------------------------------
+
+QT      += core gui widgets
+CONFIG  += console
+CONFIG  -= app_bundle
+
+TARGET   = breeze_instrucment_benchmark
+TEMPLATE = app
+
+INCLUDEPATH += \
+    ../../include/fcs_instrucment
+
+HEADERS += \
+    ../../include/fcs_instrucment/fcs_instrucment_adi.h \
+    ../../include/fcs_instrucment/fcs_instrucment_alt.h \
+    ../../include/fcs_instrucment/fcs_instrucment_hsi.h \
+    ../../include/fcs_instrucment/fcs_instrucment_pfd.h \
+    ../../include/fcs_instrucment/fcs_instrucment_profiler.h \
+    ../../include/fcs_instrucment/fcs_instrucment_dashboard.h \
+    ../../include/fcs_instrucment/fcs_instrucment_digit_item.h \
+    ../../include/fcs_instrucment/fcs_instrucment_render_clock.h \
+    ../../include/fcs_instrucment/fcs_instrucment_svg_cache.h \
+    ../../include/fcs_instrucment/fcs_instrucment_terrain_item.h \
+    ../../include/fcs_instrucment/fcs_instrucment_value_filter.h \
+    ../../include/fcs_instrucment/fcs_instrucment_view.h \
+    ../../include/fcs_instrucment/fcs_instrucment_viewport.h
+
+SOURCES += \
+    main.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_adi.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_alt.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_hsi.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_pfd.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_profiler.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_dashboard.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_digit_item.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_render_clock.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_svg_cache.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_terrain_item.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_value_filter.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_view.cpp \
+    ../../src/fcs_instrucment/fcs_instrucment_viewport.cpp
+
+RESOURCES += \
+    ../../breeze_flight_control_station.qrc
+
+include(../breeze_svg_compiler/breeze_svg_compiler.pri)
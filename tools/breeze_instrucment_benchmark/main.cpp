@@ -0,0 +1,501 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * main.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file renders instrucments offscreen along a scripted trajectory
+ * and reports p50/p99 frame times per panel, cache mode and resolution, so
+ * rendering changes can be measured on machines without display.
+ *****************************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QPainter>
+#include <fcs_instrucment_adi.h>
+#include <fcs_instrucment_alt.h>
+#include <fcs_instrucment_dashboard.h>
+#include <fcs_instrucment_hsi.h>
+#include <fcs_instrucment_pfd.h>
+
+#define BENCHMARK_PANEL_NUM 5
+
+typedef struct BenchmarkSample {
+    float angle_roll;
+    float angle_pitch;
+    float altitude;
+    float pressure;
+    float airspeed;
+    float mach_number;
+    float heading;
+    float climb_rate;
+    float turn_rate;
+    float slip_skid;
+    float position_x;
+    float position_y;
+    float position_z;
+} BenchmarkSample;
+
+typedef struct BenchmarkOption {
+    int              frames;
+    int              warmup;
+    std::vector<int> sizes;
+    std::string      image_prefix;
+    std::string      terrain_file;
+} BenchmarkOption;
+
+static const char *panel_names[BENCHMARK_PANEL_NUM] = {
+    "adi", "alt", "asi", "hsi", "vsi"
+};
+
+// Scripted climbing turn with oscillating attitude, every readout keeps
+// changing so no frame is served by dirty checks alone.
+static void getTrajectory(int frame, BenchmarkSample *sample)
+{
+    float time = frame / 60.0f;
+
+    sample->angle_roll  = 35.0f * sin(0.5f * time);
+    sample->angle_pitch = 12.0f * sin(0.3f * time);
+    sample->altitude    = 1500.0f + 1000.0f * sin(0.05f * time);
+    sample->pressure    = 29.92f;
+    sample->airspeed    = 140.0f + 60.0f * sin(0.1f * time);
+    sample->mach_number = sample->airspeed / 661.5f;
+    sample->heading     = fmod(20.0f * time, 360.0f);
+    sample->climb_rate  = 3.0f * cos(0.05f * time);
+    sample->turn_rate   = sample->angle_roll / 70.0f;
+    sample->slip_skid   = 0.2f * sin(0.7f * time);
+    // Low circle flown at 40 m/s along heading, for synthetic vision.
+    sample->position_x  = 115.0f * sin(sample->heading * M_PI / 180.0f);
+    sample->position_y  = 115.0f * (1.0f -
+                                    cos(sample->heading * M_PI / 180.0f));
+    sample->position_z  = 120.0f + 60.0f * sin(0.05f * time);
+}
+
+static double getPercentile(std::vector<double> times, double ratio)
+{
+    if (times.empty()) {
+        return 0.0;
+    }
+
+    std::sort(times.begin(), times.end());
+
+    return times[(size_t)(ratio * (times.size() - 1) + 0.5)];
+}
+
+static void printResult(const char *instrucment, int size, const char *mode,
+                        const char *stage, const std::vector<double> &times)
+{
+    printf("%-6s %6d %-7s %-7s %10.3f %10.3f\n", instrucment, size, mode,
+           stage, getPercentile(times, 0.5), getPercentile(times, 0.99));
+}
+
+static void saveImage(const BenchmarkOption &option, const QImage &image,
+                      const char *instrucment, int size, const char *mode)
+{
+    if (option.image_prefix == "") {
+        return ;
+    }
+
+    char path[256];
+    snprintf(path, sizeof(path), "%s_%s_%d_%s.png",
+             option.image_prefix.c_str(), instrucment, size, mode);
+
+    image.save(QString(path));
+}
+
+// Render view as it is shown, painter end is included since raster
+// engine may defer work until then.
+static double renderView(QGraphicsView *view, QImage *image)
+{
+    QElapsedTimer timer;
+
+    image->fill(Qt::black);
+
+    timer.start();
+
+    QPainter painter(image);
+    view->render(&painter);
+    painter.end();
+
+    return timer.nsecsElapsed() / 1000000.0;
+}
+
+// Render one panel of PFD by hiding items of other panels, shared back
+// and mask are hidden too.
+static double renderPanel(FCSInstrucmentPFD *pfd, QImage *image, int panel)
+{
+    QList<QGraphicsItem *> items = pfd->scene()->items();
+
+    for (int i = 0; i < items.size(); i++) {
+        if (items[i]->data(PFD_ITEM_PANEL_KEY).toInt() != panel) {
+            items[i]->setOpacity(0.0);
+        }
+    }
+
+    double time = renderView(pfd, image);
+
+    for (int i = 0; i < items.size(); i++) {
+        items[i]->setOpacity(1.0);
+    }
+
+    return time;
+}
+
+static void showView(QGraphicsView *view, int size)
+{
+    view->resize(size, size);
+    view->show();
+
+    QApplication::processEvents();
+}
+
+static void benchmarkPFD(const BenchmarkOption &option, int size,
+                         FCSInstrucmentPFD::RenderMode render_mode)
+{
+    const char *mode = (render_mode == FCSInstrucmentPFD::CACHED) ?
+                       "cached" : "vector";
+
+    FCSInstrucmentPFD pfd;
+
+    // Samples are given once per frame, so filters would only add a
+    // sample of delay.
+    pfd.setPFDFilterMode(FCSInstrucmentValueFilter::NONE);
+    pfd.setPFDRenderMode(render_mode);
+
+    if (option.terrain_file != "" &&
+        !pfd.setPFDTerrainFile(QString(option.terrain_file.c_str()))) {
+        printf("Failed to load terrain %s\n", option.terrain_file.c_str());
+    }
+
+    showView(&pfd, size);
+
+    QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+
+    std::vector<double> time_update;
+    std::vector<double> time_render;
+    std::vector<double> time_panel[BENCHMARK_PANEL_NUM];
+
+    for (int i = 0; i < option.warmup + option.frames; i++) {
+        BenchmarkSample sample;
+        getTrajectory(i, &sample);
+
+        pfd.setPFDAngleRoll(sample.angle_roll);
+        pfd.setPFDAnglePitch(sample.angle_pitch);
+        pfd.setPFDSlipSkid(sample.slip_skid);
+        pfd.setPFDTurnRate(sample.turn_rate);
+        pfd.setPFDAltitude(sample.altitude);
+        pfd.setPFDPressure(sample.pressure, FCSInstrucmentPFD::IN);
+        pfd.setPFDAirspeed(sample.airspeed);
+        pfd.setPFDMachNumber(sample.mach_number);
+        pfd.setPFDHeading(sample.heading);
+        pfd.setPFDClimbRate(sample.climb_rate);
+        pfd.setPFDPosition(sample.position_x, sample.position_y,
+                           sample.position_z);
+
+        QElapsedTimer timer;
+        timer.start();
+        pfd.updatePFD();
+        double update = timer.nsecsElapsed() / 1000000.0;
+
+        double render = renderView(&pfd, &image);
+
+        if (i >= option.warmup) {
+            time_update.push_back(update);
+            time_render.push_back(render);
+        }
+
+        for (int j = 0; j < BENCHMARK_PANEL_NUM; j++) {
+            double panel = renderPanel(&pfd, &image, j);
+
+            if (i >= option.warmup) {
+                time_panel[j].push_back(panel);
+            }
+        }
+    }
+
+    printResult("pfd", size, mode, "update", time_update);
+    printResult("pfd", size, mode, "render", time_render);
+
+    for (int j = 0; j < BENCHMARK_PANEL_NUM; j++) {
+        printResult("pfd", size, mode, panel_names[j], time_panel[j]);
+    }
+
+    renderView(&pfd, &image);
+    saveImage(option, image, "pfd", size, mode);
+}
+
+// Standalone instrucments have no cache modes, so only update and render
+// are measured.
+template <typename Instrucment>
+static void benchmarkInstrucment(const BenchmarkOption &option, int size,
+                                 const char *name,
+                                 void (*setSample)(Instrucment *,
+                                                   const BenchmarkSample &),
+                                 void (Instrucment::*update)(void))
+{
+    Instrucment instrucment;
+
+    showView(&instrucment, size);
+
+    QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+
+    std::vector<double> time_update;
+    std::vector<double> time_render;
+
+    for (int i = 0; i < option.warmup + option.frames; i++) {
+        BenchmarkSample sample;
+        getTrajectory(i, &sample);
+
+        setSample(&instrucment, sample);
+
+        QElapsedTimer timer;
+        timer.start();
+        (instrucment.*update)();
+        double time = timer.nsecsElapsed() / 1000000.0;
+
+        double render = renderView(&instrucment, &image);
+
+        if (i >= option.warmup) {
+            time_update.push_back(time);
+            time_render.push_back(render);
+        }
+    }
+
+    printResult(name, size, "vector", "update", time_update);
+    printResult(name, size, "vector", "render", time_render);
+
+    saveImage(option, image, name, size, "vector");
+}
+
+// Two rows of ADI, ALT and HSI panels in one scene rendered as one view,
+// compare with the sum of standalone views of the same size.
+static void benchmarkDashboard(const BenchmarkOption &option, int size)
+{
+    FCSInstrucmentDashboard dashboard;
+
+    dashboard.addDashboardPanel(FCSInstrucmentDashboard::PANEL_ADI, 0, 0);
+    dashboard.addDashboardPanel(FCSInstrucmentDashboard::PANEL_ALT, 0, 1);
+    dashboard.addDashboardPanel(FCSInstrucmentDashboard::PANEL_HSI, 0, 2);
+    dashboard.addDashboardPanel(FCSInstrucmentDashboard::PANEL_ADI, 1, 0);
+    dashboard.addDashboardPanel(FCSInstrucmentDashboard::PANEL_ALT, 1, 1);
+    dashboard.addDashboardPanel(FCSInstrucmentDashboard::PANEL_HSI, 1, 2);
+
+    dashboard.resize(3 * size, 2 * size);
+    dashboard.show();
+
+    QApplication::processEvents();
+
+    QImage image(3 * size, 2 * size, QImage::Format_ARGB32_Premultiplied);
+
+    std::vector<double> time_update;
+    std::vector<double> time_render;
+
+    for (int i = 0; i < option.warmup + option.frames; i++) {
+        BenchmarkSample sample;
+        getTrajectory(i, &sample);
+
+        for (int j = 0; j < 6; j += 3) {
+            dashboard.setDashboardAngleRoll(j, sample.angle_roll);
+            dashboard.setDashboardAnglePitch(j, sample.angle_pitch);
+            dashboard.setDashboardAltitude(j + 1, sample.altitude);
+            dashboard.setDashboardPressure(j + 1, sample.pressure);
+            dashboard.setDashboardHeading(j + 2, sample.heading);
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        dashboard.updateDashboard();
+        double update = timer.nsecsElapsed() / 1000000.0;
+
+        double render = renderView(&dashboard, &image);
+
+        if (i >= option.warmup) {
+            time_update.push_back(update);
+            time_render.push_back(render);
+        }
+    }
+
+    printResult("dash", size, "grid", "update", time_update);
+    printResult("dash", size, "grid", "render", time_render);
+
+    saveImage(option, image, "dash", size, "grid");
+}
+
+static void setADISample(FCSInstrucmentADI *adi,
+                         const BenchmarkSample &sample)
+{
+    adi->setADIAngleRoll(sample.angle_roll);
+    adi->setADIAnglePitch(sample.angle_pitch);
+}
+
+static void setALTSample(FCSInstrucmentALT *alt,
+                         const BenchmarkSample &sample)
+{
+    alt->setALTAltitude(sample.altitude);
+    alt->setALTPressure(sample.pressure);
+}
+
+static void setHSISample(FCSInstrucmentHSI *hsi,
+                         const BenchmarkSample &sample)
+{
+    hsi->setHSIHeading(sample.heading);
+}
+
+static bool parseSizes(const char *value, std::vector<int> *sizes)
+{
+    std::string list = value;
+    size_t      head = 0;
+
+    sizes->clear();
+
+    while (head <= list.size()) {
+        size_t tail = list.find(',', head);
+
+        if (tail == std::string::npos) {
+            tail = list.size();
+        }
+
+        int size = atoi(list.substr(head, tail - head).c_str());
+
+        if (size <= 0) {
+            return false;
+        }
+
+        sizes->push_back(size);
+        head = tail + 1;
+    }
+
+    return !sizes->empty();
+}
+
+static void printUsage(const char *program)
+{
+    printf("Usage: %s [options]\n"
+           "  -n <frames>  measured frames per case, default 600\n"
+           "  -w <frames>  warmup frames per case, default 30\n"
+           "  -s <sizes>   comma separated widget sizes, default "
+           "300,600,1200\n"
+           "  -o <prefix>  save last frame of each case as prefix_*.png\n"
+           "  -t <file>    draw SRTM heightmap(*.hgt) as PFD terrain\n",
+           program);
+}
+
+int main(int argc, char *argv[])
+{
+    BenchmarkOption option;
+
+    option.frames = 600;
+    option.warmup = 30;
+    option.sizes.push_back(300);
+    option.sizes.push_back(600);
+    option.sizes.push_back(1200);
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2) {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        const char *value = argv[++i];
+
+        switch (argv[i - 1][1]) {
+            case 'n': {
+                option.frames = atoi(value);
+                break;
+            }
+            case 'w': {
+                option.warmup = atoi(value);
+                break;
+            }
+            case 's': {
+                if (!parseSizes(value, &option.sizes)) {
+                    printUsage(argv[0]);
+                    return 1;
+                }
+                break;
+            }
+            case 'o': {
+                option.image_prefix = value;
+                break;
+            }
+            case 't': {
+                option.terrain_file = value;
+                break;
+            }
+            default: {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+    }
+
+    if (option.frames <= 0 || option.warmup < 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Benchmark runs on CI machines without display unless a platform is
+    // chosen explicitly.
+    if (qgetenv("QT_QPA_PLATFORM").isEmpty()) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication application(argc, argv);
+
+    printf("%-6s %6s %-7s %-7s %10s %10s\n", "inst", "size", "mode",
+           "stage", "p50[ms]", "p99[ms]");
+
+    for (size_t i = 0; i < option.sizes.size(); i++) {
+        int size = option.sizes[i];
+
+        benchmarkPFD(option, size, FCSInstrucmentPFD::VECTOR);
+        benchmarkPFD(option, size, FCSInstrucmentPFD::CACHED);
+
+        benchmarkInstrucment<FCSInstrucmentADI>(
+            option, size, "adi", setADISample, &FCSInstrucmentADI::updateADI);
+        benchmarkInstrucment<FCSInstrucmentALT>(
+            option, size, "alt", setALTSample, &FCSInstrucmentALT::updateALT);
+        benchmarkInstrucment<FCSInstrucmentHSI>(
+            option, size, "hsi", setHSISample, &FCSInstrucmentHSI::updateHSI);
+
+        benchmarkDashboard(option, size);
+    }
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+#-------------------------------------------------
+#
+# Command line converter from flight logs to columnar files
+#
+#-------------------------------------------------
+
+QT      -= core gui
+CONFIG  += console
+CONFIG  -= app_bundle
+
+TARGET   = breeze_record_export
+TEMPLATE = app
+
+INCLUDEPATH += \
+    /usr/include/boost
+
+INCLUDEPATH += \
+    ../../lib/communication_link/include \
+    ../../lib/communication_record/include
+
+LIBS += \
+    /usr/lib/x86_64-linux-gnu/libboost_system.so \
+    /usr/lib/x86_64-linux-gnu/libboost_thread.so
+
+HEADERS += \
+    ../../lib/communication_record/include/communication_record_export.h \
+    ../../lib/communication_record/include/communication_record_format.h \
+    ../../lib/communication_record/include/communication_record_reader.h
+
+SOURCES += \
+    main.cpp \
+    ../../lib/communication_record/src/communication_record_export.cpp \
+    ../../lib/communication_record/src/communication_record_format.cpp \
+    ../../lib/communication_record/src/communication_record_reader.cpp
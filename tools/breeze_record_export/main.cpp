@@ -1,7 +1,6 @@
 /******************************************************************************
  * Software License Agreement (GPL V3 License)
  *
- * Copyright (C) 2013 Marek M. Cel
  * Copyright (c) 2018 myyerrol(Team MicroDynamics)
  *
  * This file is part of breeze_flight_control_station.
@@ -23,65 +22,67 @@
 
  ******************************************************************************
  * File:
- * fcs_instrucment_widget_adi.cpp
+ * main.cpp
  *
  * Author:
- * Marek M. Cel<marekcel@marekcel.pl>
  * myyerrol<myyerrol@126.com>
  *
  * History:
  * <Authors>     <Date>         <Version>     <Operation>
- * Marek M. Cel  2013.--.--     --            Finish ADI widget
- * myyerrol      2018.03.14     1.0.0         Modify ADI widget
+ * myyerrol      2026.10.18     1.0.0         Create this file
  *
  * Description:
- * This .cpp file implements the widget of Attitude Director Indicator(ADI)
- * according to QFlightInstruments project.
+ * This .cpp file converts a recorded flight log into per-channel columnar
+ * files from command line.
  *****************************************************************************/
 
-#include <fcs_instrucment_widget_adi.h>
-#include <ui_fcs_instrucment_widget_adi.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <communication_record_export.h>
 
-FCSInstrucmentWidgetADI::FCSInstrucmentWidgetADI(QWidget *parent) :
-    QWidget(parent),
-    widget_ui_(new Ui::FCSInstrucmentWidgetADI),
-    widget_adi_(0),
-    widget_layout_(0)
+static void printUsage(const char *program)
 {
-    widget_ui_->setupUi(this);
-
-    setupWidgetUi();
-
-    widget_adi_ = widget_ui_->graphics_view_adi;
+    std::cout << "Usage: " << program
+              << " <record_file> <output_dir> [csv|columnar] [thread_count]"
+              << std::endl;
 }
 
-FCSInstrucmentWidgetADI::~FCSInstrucmentWidgetADI()
+int main(int argc, char *argv[])
 {
-    if (widget_layout_) {
-        delete widget_layout_;
-    }
-    else {
-        ;
+    if (argc < 3 || argc > 5) {
+        printUsage(argv[0]);
+        return 1;
     }
 
-    widget_layout_ = 0;
+    RecordExportFormat format       = EXPORT_CSV;
+    u_int32_t          thread_count = 0;
 
-    if (widget_ui_) {
-        delete widget_ui_;
+    if (argc > 3) {
+        if (strcmp(argv[3], "csv") == 0) {
+            format = EXPORT_CSV;
+        }
+        else if (strcmp(argv[3], "columnar") == 0) {
+            format = EXPORT_COLUMNAR;
+        }
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
     }
-    else {
-        ;
+
+    if (argc > 4) {
+        thread_count = atoi(argv[4]);
     }
 
-    widget_ui_ = 0;
-}
+    CommunicationRecordExport record_export(thread_count);
 
-void FCSInstrucmentWidgetADI::setupWidgetUi(void)
-{
-    widget_layout_ = new FCSInstrucmentLayout(this);
+    if (!record_export.exportRecord(argv[1], argv[2], format)) {
+        return 1;
+    }
 
-    widget_layout_->setContentsMargins(0, 0, 0, 0);
-    widget_layout_->addWidget(widget_ui_->graphics_view_adi);
+    std::cout << "Export " << record_export.getChunkDone() << " chunks of "
+              << argv[1] << " successfully!" << std::endl;
 
-    setLayout(widget_layout_);
+    return 0;
 }
@@ -0,0 +1,43 @@
+#-------------------------------------------------
+#
+# Instrucment svg files compiled into painter path tables
+#
+# Enabled with "qmake CONFIG+=fcs_vector_instrucment", otherwise the
+# instrucments keep parsing svg files with QtSvg at runtime.
+#
+#-------------------------------------------------
+
+FCS_ROOT = $$clean_path($$PWD/../..)
+
+fcs_vector_instrucment {
+    DEFINES += FCS_INSTRUCMENT_VECTOR
+
+    HEADERS += \
+        $$FCS_ROOT/include/fcs_instrucment/fcs_instrucment_vector_item.h
+
+    SOURCES += \
+        $$FCS_ROOT/src/fcs_instrucment/fcs_instrucment_vector_item.cpp
+
+    # Complete designs pfd.svg and alt.svg are not drawn by any instrucment.
+    FCS_VECTOR_SVG = \
+        $$files($$FCS_ROOT/res/fcs_instrucment_adi/*.svg) \
+        $$files($$FCS_ROOT/res/fcs_instrucment_alt/*.svg) \
+        $$files($$FCS_ROOT/res/fcs_instrucment_hsi/*.svg) \
+        $$files($$FCS_ROOT/res/fcs_instrucment_pfd/*.svg)
+    FCS_VECTOR_SVG -= \
+        $$FCS_ROOT/res/fcs_instrucment_alt/alt.svg \
+        $$FCS_ROOT/res/fcs_instrucment_pfd/pfd.svg
+
+    fcs_vector_compiler.input         = FCS_VECTOR_SVG
+    fcs_vector_compiler.output        = fcs_instrucment_vector_data.cpp
+    fcs_vector_compiler.commands      = \
+        python3 $$PWD/breeze_svg_compiler.py -r $$FCS_ROOT \
+        -p :/fcs_instrucment/ -o ${QMAKE_FILE_OUT} ${QMAKE_FILE_IN}
+    fcs_vector_compiler.depends       = $$PWD/breeze_svg_compiler.py
+    fcs_vector_compiler.variable_out  = SOURCES
+    fcs_vector_compiler.CONFIG       += combine
+
+    QMAKE_EXTRA_COMPILERS += fcs_vector_compiler
+} else {
+    QT += svg
+}
@@ -0,0 +1,872 @@
+#!/usr/bin/env python3
+###############################################################################
+# Software License Agreement (GPL V3 License)
+#
+# Copyright (c) 2016 myyerrol(Team MicroDynamics)
+#
+# This file is part of breeze_flight_control_station.
+#
+# breeze_flight_control_station is free software: you can redistribute it
+# and/or modify it under the terms of the GNU General Public License as
+# published by the Free Software Foundation, either version 3 of the License,
+# or (at your option) any later version.
+#
+# breeze_flight_control_station is distributed in the hope that it will be
+# useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+# Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with breeze_flight_control_station.  If not, see
+# <http://www.gnu.org/licenses/>.
+###############################################################################
+#
+###############################################################################
+# File:
+# breeze_svg_compiler.py
+#
+# Author:
+# myyerrol<myyerrol@126.com>
+#
+# History:
+# <Authors>     <Date>         <Version>     <Operation>
+# myyerrol      2026.10.18     1.0.0         Create this file
+#
+# Description:
+# This script compiles instrucment svg files into constant tables of painter
+# path commands, pens and brushes, which FCSInstrucmentVectorItem draws
+# without QtSvg. Transforms are baked into coordinates, so every layer is
+# one path with one pen and one brush. The subset follows what QtSvg renders
+# of these files: filters are ignored like QtSvg Tiny 1.2 does.
+###############################################################################
+
+import argparse
+import math
+import os
+import re
+import sys
+import xml.etree.ElementTree as ElementTree
+
+SVG_NS = '{http://www.w3.org/2000/svg}'
+XLINK_HREF = '{http://www.w3.org/1999/xlink}href'
+
+SKIPPED_TAGS = ('defs', 'metadata', 'title', 'desc', 'clipPath', 'mask',
+                'filter', 'pattern', 'symbol', 'marker', 'style', 'script',
+                'linearGradient', 'radialGradient')
+
+INHERITED_PROPERTIES = {
+    'fill':              'black',
+    'fill-opacity':      '1',
+    'fill-rule':         'nonzero',
+    'stroke':            'none',
+    'stroke-width':      '1',
+    'stroke-opacity':    '1',
+    'stroke-linecap':    'butt',
+    'stroke-linejoin':   'miter',
+    'stroke-miterlimit': '4',
+    'stroke-dasharray':  'none',
+    'stroke-dashoffset': '0',
+    'visibility':        'visible',
+}
+
+NAMED_COLORS = {
+    'black':  (0, 0, 0),       'white':   (255, 255, 255),
+    'red':    (255, 0, 0),     'green':   (0, 128, 0),
+    'blue':   (0, 0, 255),     'yellow':  (255, 255, 0),
+    'cyan':   (0, 255, 255),   'magenta': (255, 0, 255),
+    'gray':   (128, 128, 128), 'grey':    (128, 128, 128),
+    'orange': (255, 165, 0),   'lime':    (0, 255, 0),
+}
+
+NUMBER = re.compile(r'[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?')
+
+IDENTITY = (1.0, 0.0, 0.0, 1.0, 0.0, 0.0)
+
+
+def warn(message):
+    sys.stderr.write('breeze_svg_compiler: warning: %s\n' % message)
+
+
+def multiply(a, b):
+    # Matrices are (a, b, c, d, e, f) as svg, a applied after b.
+    return (a[0] * b[0] + a[2] * b[1],
+            a[1] * b[0] + a[3] * b[1],
+            a[0] * b[2] + a[2] * b[3],
+            a[1] * b[2] + a[3] * b[3],
+            a[0] * b[4] + a[2] * b[5] + a[4],
+            a[1] * b[4] + a[3] * b[5] + a[5])
+
+
+def apply(m, x, y):
+    return (m[0] * x + m[2] * y + m[4], m[1] * x + m[3] * y + m[5])
+
+
+def parse_transform(text):
+    matrix = IDENTITY
+
+    for name, args in re.findall(r'([a-zA-Z]+)\s*\(([^)]*)\)', text or ''):
+        v = [float(n) for n in NUMBER.findall(args)]
+
+        if name == 'matrix' and len(v) == 6:
+            m = tuple(v)
+        elif name == 'translate':
+            m = (1.0, 0.0, 0.0, 1.0, v[0], v[1] if len(v) > 1 else 0.0)
+        elif name == 'scale':
+            m = (v[0], 0.0, 0.0, v[1] if len(v) > 1 else v[0], 0.0, 0.0)
+        elif name == 'rotate':
+            a = math.radians(v[0])
+            m = (math.cos(a), math.sin(a), -math.sin(a), math.cos(a),
+                 0.0, 0.0)
+            if len(v) == 3:
+                m = multiply((1.0, 0.0, 0.0, 1.0, v[1], v[2]),
+                             multiply(m, (1.0, 0.0, 0.0, 1.0,
+                                          -v[1], -v[2])))
+        elif name == 'skewX':
+            m = (1.0, 0.0, math.tan(math.radians(v[0])), 1.0, 0.0, 0.0)
+        elif name == 'skewY':
+            m = (1.0, math.tan(math.radians(v[0])), 0.0, 1.0, 0.0, 0.0)
+        else:
+            warn('unknown transform %s' % name)
+            continue
+
+        matrix = multiply(matrix, m)
+
+    return matrix
+
+
+def parse_length(text, reference=1.0, default=0.0):
+    if text is None:
+        return default
+
+    text = text.strip()
+
+    if text.endswith('%'):
+        return float(text[:-1]) / 100.0 * reference
+
+    match = NUMBER.match(text)
+
+    return float(match.group(0)) if match else default
+
+
+def parse_color(text):
+    # Returns (r, g, b) or None for none, url references are resolved by
+    # caller.
+    text = text.strip()
+
+    if text in ('none', 'transparent', ''):
+        return None
+    if text == 'currentColor':
+        return (0, 0, 0)
+    if text.startswith('#'):
+        h = text[1:]
+        if len(h) == 3:
+            h = ''.join(c * 2 for c in h)
+        return (int(h[0:2], 16), int(h[2:4], 16), int(h[4:6], 16))
+    if text.startswith('rgb'):
+        v = NUMBER.findall(text)
+        if '%' in text:
+            return tuple(int(float(n) * 2.55 + 0.5) for n in v[:3])
+        return tuple(int(float(n)) for n in v[:3])
+    if text.lower() in NAMED_COLORS:
+        return NAMED_COLORS[text.lower()]
+
+    warn('unknown color %s' % text)
+
+    return (0, 0, 0)
+
+
+def get_style(element):
+    style = {}
+
+    for name in list(INHERITED_PROPERTIES.keys()) + ['opacity', 'display',
+                                                      'stop-color',
+                                                      'stop-opacity']:
+        if element.get(name) is not None:
+            style[name] = element.get(name)
+
+    for item in (element.get('style') or '').split(';'):
+        if ':' in item:
+            name, value = item.split(':', 1)
+            style[name.strip()] = value.strip()
+
+    return style
+
+
+def local_name(element):
+    tag = element.tag
+
+    return tag[len(SVG_NS):] if tag.startswith(SVG_NS) else tag
+
+
+###############################################################################
+# Path geometry, every shape ends up as M, L, C and Z commands.
+###############################################################################
+
+def arc_to_cubics(x0, y0, rx, ry, angle, large, sweep, x, y):
+    # Endpoint to center parameterization of svg implementation notes.
+    if rx == 0 or ry == 0:
+        return [('L', [x, y])]
+
+    phi = math.radians(angle)
+    cos_phi, sin_phi = math.cos(phi), math.sin(phi)
+    dx, dy = (x0 - x) / 2.0, (y0 - y) / 2.0
+    x1 = cos_phi * dx + sin_phi * dy
+    y1 = -sin_phi * dx + cos_phi * dy
+    rx, ry = abs(rx), abs(ry)
+    scale = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry)
+
+    if scale > 1:
+        rx *= math.sqrt(scale)
+        ry *= math.sqrt(scale)
+
+    num = rx * rx * ry * ry - rx * rx * y1 * y1 - ry * ry * x1 * x1
+    den = rx * rx * y1 * y1 + ry * ry * x1 * x1
+    coef = math.sqrt(max(0.0, num / den)) if den else 0.0
+
+    if large == sweep:
+        coef = -coef
+
+    cx1 = coef * rx * y1 / ry
+    cy1 = -coef * ry * x1 / rx
+    cx = cos_phi * cx1 - sin_phi * cy1 + (x0 + x) / 2.0
+    cy = sin_phi * cx1 + cos_phi * cy1 + (y0 + y) / 2.0
+
+    def angle_of(ux, uy, vx, vy):
+        return math.atan2(ux * vy - uy * vx, ux * vx + uy * vy)
+
+    theta = angle_of(1, 0, (x1 - cx1) / rx, (y1 - cy1) / ry)
+    delta = angle_of((x1 - cx1) / rx, (y1 - cy1) / ry,
+                     (-x1 - cx1) / rx, (-y1 - cy1) / ry)
+
+    if not sweep and delta > 0:
+        delta -= 2 * math.pi
+    elif sweep and delta < 0:
+        delta += 2 * math.pi
+
+    segments = int(math.ceil(abs(delta) / (math.pi / 2)))
+    result = []
+
+    for i in range(segments):
+        t0 = theta + delta * i / segments
+        t1 = theta + delta * (i + 1) / segments
+        k = 4.0 / 3.0 * math.tan((t1 - t0) / 4.0)
+        e0x, e0y = math.cos(t0), math.sin(t0)
+        e1x, e1y = math.cos(t1), math.sin(t1)
+        control = [(e0x - k * e0y, e0y + k * e0x),
+                   (e1x + k * e1y, e1y - k * e1x),
+                   (e1x, e1y)]
+        coords = []
+
+        for ux, uy in control:
+            px = rx * ux
+            py = ry * uy
+            coords.append(cos_phi * px - sin_phi * py + cx)
+            coords.append(sin_phi * px + cos_phi * py + cy)
+
+        result.append(('C', coords))
+
+    return result
+
+
+def parse_path(d):
+    tokens = re.findall(r'[MmLlHhVvCcSsQqTtAaZz]|' + NUMBER.pattern, d or '')
+    commands = []
+    command = None
+    cx = cy = sx = sy = 0.0
+    last_control = None
+    index_box = [0]
+
+    def number():
+        value = float(tokens[index_box[0]])
+        index_box[0] += 1
+        return value
+
+    while index_box[0] < len(tokens):
+        token = tokens[index_box[0]]
+
+        if re.match(r'[A-Za-z]', token):
+            command = token
+            index_box[0] += 1
+            if command in 'Zz':
+                commands.append(('Z', []))
+                cx, cy = sx, sy
+                last_control = None
+                continue
+        elif command is None:
+            raise ValueError('path data starts with number')
+
+        relative = command.islower()
+        upper = command.upper()
+        ox, oy = (cx, cy) if relative else (0.0, 0.0)
+
+        if upper == 'M':
+            cx, cy = number() + ox, number() + oy
+            sx, sy = cx, cy
+            commands.append(('M', [cx, cy]))
+            # Following pairs are implicit line commands.
+            command = 'l' if relative else 'L'
+            last_control = None
+        elif upper == 'L':
+            cx, cy = number() + ox, number() + oy
+            commands.append(('L', [cx, cy]))
+            last_control = None
+        elif upper == 'H':
+            cx = number() + ox
+            commands.append(('L', [cx, cy]))
+            last_control = None
+        elif upper == 'V':
+            cy = number() + oy
+            commands.append(('L', [cx, cy]))
+            last_control = None
+        elif upper == 'C':
+            v = [number() for i in range(6)]
+            x1, y1 = v[0] + ox, v[1] + oy
+            x2, y2 = v[2] + ox, v[3] + oy
+            cx, cy = v[4] + ox, v[5] + oy
+            commands.append(('C', [x1, y1, x2, y2, cx, cy]))
+            last_control = ('C', x2, y2)
+        elif upper == 'S':
+            v = [number() for i in range(4)]
+            if last_control and last_control[0] == 'C':
+                x1, y1 = 2 * cx - last_control[1], 2 * cy - last_control[2]
+            else:
+                x1, y1 = cx, cy
+            x2, y2 = v[0] + ox, v[1] + oy
+            cx, cy = v[2] + ox, v[3] + oy
+            commands.append(('C', [x1, y1, x2, y2, cx, cy]))
+            last_control = ('C', x2, y2)
+        elif upper in 'QT':
+            if upper == 'Q':
+                v = [number() for i in range(4)]
+                qx, qy = v[0] + ox, v[1] + oy
+                x, y = v[2] + ox, v[3] + oy
+            else:
+                v = [number() for i in range(2)]
+                if last_control and last_control[0] == 'Q':
+                    qx = 2 * cx - last_control[1]
+                    qy = 2 * cy - last_control[2]
+                else:
+                    qx, qy = cx, cy
+                x, y = v[0] + ox, v[1] + oy
+            # Quadratic segments are raised to cubic ones.
+            commands.append(('C', [cx + 2.0 / 3.0 * (qx - cx),
+                                   cy + 2.0 / 3.0 * (qy - cy),
+                                   x + 2.0 / 3.0 * (qx - x),
+                                   y + 2.0 / 3.0 * (qy - y), x, y]))
+            cx, cy = x, y
+            last_control = ('Q', qx, qy)
+        elif upper == 'A':
+            v = [number() for i in range(7)]
+            x, y = v[5] + ox, v[6] + oy
+            commands.extend(arc_to_cubics(cx, cy, v[0], v[1], v[2],
+                                          bool(v[3]), bool(v[4]), x, y))
+            cx, cy = x, y
+            last_control = None
+
+    return commands
+
+
+def ellipse_path(cx, cy, rx, ry):
+    k = 0.5522847498
+    return [('M', [cx + rx, cy]),
+            ('C', [cx + rx, cy + k * ry, cx + k * rx, cy + ry, cx, cy + ry]),
+            ('C', [cx - k * rx, cy + ry, cx - rx, cy + k * ry, cx - rx, cy]),
+            ('C', [cx - rx, cy - k * ry, cx - k * rx, cy - ry, cx, cy - ry]),
+            ('C', [cx + k * rx, cy - ry, cx + rx, cy - k * ry, cx + rx, cy]),
+            ('Z', [])]
+
+
+def rect_path(element):
+    x = parse_length(element.get('x'))
+    y = parse_length(element.get('y'))
+    w = parse_length(element.get('width'))
+    h = parse_length(element.get('height'))
+    rx = element.get('rx')
+    ry = element.get('ry')
+    rx = parse_length(rx if rx is not None else ry)
+    ry = parse_length(ry if ry is not None else element.get('rx'))
+    rx, ry = min(rx, w / 2.0), min(ry, h / 2.0)
+
+    if w <= 0 or h <= 0:
+        return []
+    if rx <= 0 or ry <= 0:
+        return [('M', [x, y]), ('L', [x + w, y]), ('L', [x + w, y + h]),
+                ('L', [x, y + h]), ('Z', [])]
+
+    k = 0.5522847498
+    return [('M', [x + rx, y]),
+            ('L', [x + w - rx, y]),
+            ('C', [x + w - rx + k * rx, y, x + w, y + ry - k * ry,
+                   x + w, y + ry]),
+            ('L', [x + w, y + h - ry]),
+            ('C', [x + w, y + h - ry + k * ry, x + w - rx + k * rx, y + h,
+                   x + w - rx, y + h]),
+            ('L', [x + rx, y + h]),
+            ('C', [x + rx - k * rx, y + h, x, y + h - ry + k * ry,
+                   x, y + h - ry]),
+            ('L', [x, y + ry]),
+            ('C', [x, y + ry - k * ry, x + rx - k * rx, y, x + rx, y]),
+            ('Z', [])]
+
+
+def points_path(element, closed):
+    v = [float(n) for n in NUMBER.findall(element.get('points') or '')]
+    commands = []
+
+    for i in range(0, len(v) - 1, 2):
+        commands.append(('M' if i == 0 else 'L', [v[i], v[i + 1]]))
+    if closed and commands:
+        commands.append(('Z', []))
+
+    return commands
+
+
+def shape_path(element, name):
+    if name == 'path':
+        return parse_path(element.get('d'))
+    if name == 'rect':
+        return rect_path(element)
+    if name == 'circle':
+        r = parse_length(element.get('r'))
+        return ellipse_path(parse_length(element.get('cx')),
+                            parse_length(element.get('cy')), r, r)
+    if name == 'ellipse':
+        return ellipse_path(parse_length(element.get('cx')),
+                            parse_length(element.get('cy')),
+                            parse_length(element.get('rx')),
+                            parse_length(element.get('ry')))
+    if name == 'line':
+        return [('M', [parse_length(element.get('x1')),
+                       parse_length(element.get('y1'))]),
+                ('L', [parse_length(element.get('x2')),
+                       parse_length(element.get('y2'))])]
+    if name == 'polyline':
+        return points_path(element, False)
+    if name == 'polygon':
+        return points_path(element, True)
+
+    return None
+
+
+def bounds_of(commands):
+    xs = [c[1][i] for c in commands for i in range(0, len(c[1]), 2)]
+    ys = [c[1][i] for c in commands for i in range(1, len(c[1]), 2)]
+
+    if not xs:
+        return (0.0, 0.0, 0.0, 0.0)
+
+    return (min(xs), min(ys), max(xs) - min(xs), max(ys) - min(ys))
+
+
+###############################################################################
+# Gradients.
+###############################################################################
+
+class Gradients(object):
+
+    def __init__(self, root):
+        self.elements = {}
+        self.table = []
+
+        for element in root.iter():
+            if local_name(element) in ('linearGradient', 'radialGradient') \
+               and element.get('id'):
+                self.elements[element.get('id')] = element
+
+    def chain(self, element):
+        # Attributes and stops are inherited through xlink:href.
+        result = [element]
+
+        while True:
+            href = result[-1].get(XLINK_HREF) or result[-1].get('href')
+            if not href or href[1:] not in self.elements or \
+               self.elements[href[1:]] in result:
+                return result
+            result.append(self.elements[href[1:]])
+
+    def attribute(self, chain, name, default=None):
+        for element in chain:
+            if element.get(name) is not None:
+                return element.get(name)
+        return default
+
+    def create(self, reference, ctm, local_bounds, opacity):
+        element = self.elements.get(reference)
+
+        if element is None:
+            warn('missing gradient %s' % reference)
+            return -1, None
+
+        chain = self.chain(element)
+        stops = []
+
+        for link in chain:
+            found = [s for s in link if local_name(s) == 'stop']
+            if found:
+                for stop in found:
+                    style = get_style(stop)
+                    color = parse_color(style.get('stop-color', 'black')) \
+                        or (0, 0, 0)
+                    alpha = float(style.get('stop-opacity', '1')) * opacity
+                    stops.append((parse_length(stop.get('offset'), 1.0),
+                                  color, alpha))
+                break
+
+        if not stops:
+            return -1, None
+        if len(stops) == 1:
+            return -1, (stops[0][1], stops[0][2])
+
+        units = self.attribute(chain, 'gradientUnits', 'objectBoundingBox')
+        matrix = parse_transform(self.attribute(chain, 'gradientTransform'))
+        bounding = units == 'objectBoundingBox'
+        reference_size = 1.0 if bounding else 100.0
+
+        if bounding:
+            bx, by, bw, bh = local_bounds
+            matrix = multiply((bw, 0.0, 0.0, bh, bx, by), matrix)
+
+        matrix = multiply(ctm, matrix)
+
+        if local_name(element) == 'linearGradient' or \
+           local_name(chain[0]) == 'linearGradient':
+            kind = 0
+            coords = [parse_length(self.attribute(chain, 'x1'),
+                                   reference_size, 0.0),
+                      parse_length(self.attribute(chain, 'y1'),
+                                   reference_size, 0.0),
+                      parse_length(self.attribute(chain, 'x2'),
+                                   reference_size, reference_size),
+                      parse_length(self.attribute(chain, 'y2'),
+                                   reference_size, 0.0),
+                      0.0]
+        else:
+            kind = 1
+            cx = parse_length(self.attribute(chain, 'cx'),
+                              reference_size, reference_size / 2.0)
+            cy = parse_length(self.attribute(chain, 'cy'),
+                              reference_size, reference_size / 2.0)
+            coords = [cx, cy,
+                      parse_length(self.attribute(chain, 'r'),
+                                   reference_size, reference_size / 2.0),
+                      parse_length(self.attribute(chain, 'fx'),
+                                   reference_size, cx),
+                      parse_length(self.attribute(chain, 'fy'),
+                                   reference_size, cy)]
+
+        spread = {'pad': 0, 'reflect': 1, 'repeat': 2}.get(
+            self.attribute(chain, 'spreadMethod', 'pad'), 0)
+
+        self.table.append((kind, coords, matrix, spread, stops))
+
+        return len(self.table) - 1, None
+
+
+###############################################################################
+# Document walk.
+###############################################################################
+
+class Compiler(object):
+
+    def __init__(self, root):
+        self.root = root
+        self.layers = []
+        self.gradients = Gradients(root)
+
+        width = parse_length(root.get('width'), 1.0, 0.0)
+        height = parse_length(root.get('height'), 1.0, 0.0)
+        view_box = [float(n) for n in NUMBER.findall(root.get('viewBox')
+                                                       or '')]
+        matrix = IDENTITY
+
+        if len(view_box) == 4:
+            if width == 0 or height == 0:
+                width, height = view_box[2], view_box[3]
+            matrix = multiply((width / view_box[2], 0.0, 0.0,
+                               height / view_box[3], 0.0, 0.0),
+                              (1.0, 0.0, 0.0, 1.0,
+                               -view_box[0], -view_box[1]))
+
+        # QtSvg truncates document size, items are sized the same way.
+        self.width = float(int(width))
+        self.height = float(int(height))
+        self.walk(root, matrix, dict(INHERITED_PROPERTIES), 1.0)
+
+    def walk(self, element, ctm, inherited, opacity):
+        name = local_name(element)
+
+        if name in SKIPPED_TAGS or not isinstance(element.tag, str):
+            return
+        if not element.tag.startswith(SVG_NS) and element is not self.root:
+            return
+
+        style = get_style(element)
+
+        if style.get('display') == 'none':
+            return
+
+        properties = dict(inherited)
+
+        for key in INHERITED_PROPERTIES:
+            if key in style and style[key] != 'inherit':
+                properties[key] = style[key]
+
+        # Group opacity is folded into children, which only differs from
+        # QtSvg where children of one group overlap.
+        opacity *= float(style.get('opacity', '1'))
+
+        if element is not self.root:
+            ctm = multiply(ctm, parse_transform(element.get('transform')))
+
+        if name in ('svg', 'g', 'a', 'switch') or element is self.root:
+            for child in element:
+                self.walk(child, ctm, properties, opacity)
+            return
+
+        if name == 'use':
+            warn('use element is not supported')
+            return
+        if name in ('text', 'image'):
+            warn('%s element is not supported' % name)
+            return
+
+        commands = shape_path(element, name)
+
+        if not commands or properties['visibility'] != 'visible':
+            return
+
+        self.add_layer(commands, ctm, properties, opacity)
+
+    def paint(self, value, alpha, commands, ctm):
+        # Returns (argb, gradient index).
+        match = re.match(r'url\(\s*#([^)\s]+)\s*\)\s*(.*)', value.strip())
+
+        if match:
+            index, solid = self.gradients.create(match.group(1), ctm,
+                                                 bounds_of(commands), alpha)
+            if index >= 0:
+                return 0xff000000, index
+            if solid:
+                return argb(solid[0], solid[1]), -1
+            value = match.group(2) or 'none'
+
+        color = parse_color(value)
+
+        if color is None:
+            return 0, -1
+
+        return argb(color, alpha), -1
+
+    def add_layer(self, commands, ctm, properties, opacity):
+        fill, fill_gradient = self.paint(
+            properties['fill'],
+            float(properties['fill-opacity']) * opacity, commands, ctm)
+        stroke, stroke_gradient = self.paint(
+            properties['stroke'],
+            float(properties['stroke-opacity']) * opacity, commands, ctm)
+        scale = math.sqrt(abs(ctm[0] * ctm[3] - ctm[1] * ctm[2]))
+        stroke_width = parse_length(properties['stroke-width'], 1.0, 1.0)
+
+        if (stroke >> 24) == 0 and stroke_gradient < 0:
+            stroke_width = 0.0
+
+        dashes = []
+
+        if properties['stroke-dasharray'] not in ('none', ''):
+            dashes = [float(n) * scale for n in
+                      NUMBER.findall(properties['stroke-dasharray'])]
+            if len(dashes) % 2:
+                dashes = dashes * 2
+
+        if ((fill >> 24) == 0 and fill_gradient < 0 and
+                stroke_width <= 0.0):
+            return
+
+        baked = []
+
+        for command, coords in commands:
+            points = []
+            for i in range(0, len(coords), 2):
+                points.extend(apply(ctm, coords[i], coords[i + 1]))
+            baked.append((command, points))
+
+        self.layers.append({
+            'commands':        baked,
+            'fill_rule':       1 if properties['fill-rule'] == 'evenodd'
+                               else 0,
+            'fill':            fill,
+            'fill_gradient':   fill_gradient,
+            'stroke':          stroke,
+            'stroke_gradient': stroke_gradient,
+            'stroke_width':    stroke_width * scale,
+            'stroke_cap':      {'butt': 0, 'round': 1, 'square': 2}.get(
+                                   properties['stroke-linecap'], 0),
+            'stroke_join':     {'miter': 0, 'round': 1, 'bevel': 2}.get(
+                                   properties['stroke-linejoin'], 0),
+            'stroke_miter':    float(properties['stroke-miterlimit']),
+            'dashes':          dashes,
+            'dash_offset':     parse_length(properties['stroke-dashoffset'])
+                               * scale,
+        })
+
+
+def argb(color, alpha):
+    a = int(max(0.0, min(1.0, alpha)) * 255 + 0.5)
+
+    return (a << 24) | (color[0] << 16) | (color[1] << 8) | color[2]
+
+
+###############################################################################
+# C++ output.
+###############################################################################
+
+def literal(value):
+    text = '%.7g' % value
+
+    if 'e' not in text and '.' not in text:
+        text += '.0'
+
+    return text + 'f'
+
+
+def float_array(name, values):
+    lines = ['static const float %s[] = {' % name]
+    row = []
+
+    for value in values or [0.0]:
+        row.append(literal(value))
+        if len(row) == 6:
+            lines.append('    ' + ', '.join(row) + ',')
+            row = []
+    if row:
+        lines.append('    ' + ', '.join(row) + ',')
+
+    lines.append('};')
+
+    return lines
+
+
+def emit(compilers, output):
+    lines = [
+        '// Generated by tools/breeze_svg_compiler/breeze_svg_compiler.py '
+        'from',
+        '// instrucment svg files, do not edit.',
+        '',
+        '#include <fcs_instrucment_vector_item.h>',
+        '',
+    ]
+    table = []
+
+    for number, (resource, compiler) in enumerate(compilers):
+        prefix = 'vector_%d' % number
+
+        lines.append('// %s' % resource)
+
+        for index, gradient in enumerate(compiler.gradients.table):
+            kind, coords, matrix, spread, stops = gradient
+            values = []
+            for offset, color, alpha in stops:
+                values.extend([offset, color[0], color[1], color[2],
+                               max(0.0, min(1.0, alpha)) * 255])
+            lines.extend(float_array('%s_stops_%d' % (prefix, index),
+                                     values))
+
+        if compiler.gradients.table:
+            lines.append('static const FCSInstrucmentVectorGradient '
+                         '%s_gradients[] = {' % prefix)
+            for index, gradient in enumerate(compiler.gradients.table):
+                kind, coords, matrix, spread, stops = gradient
+                lines.append('    { %d, { %s }, { %s }, %d, %d, '
+                             '%s_stops_%d },' %
+                             (kind, ', '.join(literal(v) for v in coords),
+                              ', '.join(literal(v) for v in matrix),
+                              spread, len(stops), prefix, index))
+            lines.append('};')
+
+        for index, layer in enumerate(compiler.layers):
+            text = ''.join(c for c, p in layer['commands'])
+            points = [v for c, p in layer['commands'] for v in p]
+            lines.append('static const char %s_commands_%d[] = "%s";' %
+                         (prefix, index, text))
+            lines.extend(float_array('%s_points_%d' % (prefix, index),
+                                     points))
+            if layer['dashes']:
+                lines.extend(float_array('%s_dashes_%d' % (prefix, index),
+                                         layer['dashes']))
+
+        lines.append('static const FCSInstrucmentVectorLayer '
+                     '%s_layers[] = {' % prefix)
+
+        for index, layer in enumerate(compiler.layers):
+            lines.append(
+                '    { %s_commands_%d, %s_points_%d, %d, 0x%08xu, %d, '
+                '0x%08xu, %d, %s, %d, %d, %s, %d, %s, %s },' %
+                (prefix, index, prefix, index, layer['fill_rule'],
+                 layer['fill'], layer['fill_gradient'], layer['stroke'],
+                 layer['stroke_gradient'], literal(layer['stroke_width']),
+                 layer['stroke_cap'], layer['stroke_join'],
+                 literal(layer['stroke_miter']), len(layer['dashes']),
+                 ('%s_dashes_%d' % (prefix, index)) if layer['dashes']
+                 else '0', literal(layer['dash_offset'])))
+
+        if not compiler.layers:
+            lines.append('    { "", 0, 0, 0u, -1, 0u, -1, 0.0f, 0, 0, 4.0f, '
+                         '0, 0, 0.0f },')
+
+        lines.append('};')
+        lines.append('static const FCSInstrucmentVectorData %s_data = {' %
+                     prefix)
+        lines.append('    "%s", %s, %s, %d, %s_layers, %s' %
+                     (resource, literal(compiler.width),
+                      literal(compiler.height), len(compiler.layers), prefix,
+                      ('%s_gradients' % prefix) if compiler.gradients.table
+                      else '0'))
+        lines.append('};')
+        lines.append('')
+
+        table.append('&%s_data' % prefix)
+
+    lines.append('const FCSInstrucmentVectorData *const '
+                 'fcs_instrucment_vector_table[] = {')
+    for entry in table:
+        lines.append('    %s,' % entry)
+    lines.append('    0')
+    lines.append('};')
+    lines.append('')
+
+    with open(output, 'w') as stream:
+        stream.write('\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compile instrucment svg files into painter path tables.')
+    parser.add_argument('-o', '--output', required=True,
+                        help='generated c++ source file')
+    parser.add_argument('-r', '--root', default='.',
+                        help='directory resource paths are relative to')
+    parser.add_argument('-p', '--prefix', default=':/fcs_instrucment/',
+                        help='resource prefix of svg files')
+    parser.add_argument('inputs', nargs='+', help='svg files')
+    arguments = parser.parse_args()
+    compilers = []
+
+    for path in sorted(arguments.inputs):
+        resource = arguments.prefix + os.path.relpath(
+            os.path.abspath(path),
+            os.path.abspath(arguments.root)).replace(os.sep, '/')
+
+        try:
+            compilers.append((resource,
+                              Compiler(ElementTree.parse(path).getroot())))
+        except (ElementTree.ParseError, ValueError) as error:
+            sys.stderr.write('breeze_svg_compiler: %s: %s\n' % (path, error))
+            return 1
+
+    emit(compilers, arguments.output)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
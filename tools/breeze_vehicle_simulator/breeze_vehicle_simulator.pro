@@ -0,0 +1,27 @@
+#-------------------------------------------------
+#
+# Synthetic vehicle running the slave side of communication link
+#
+#-------------------------------------------------
+
+QT      -= core gui
+CONFIG  += console
+CONFIG  -= app_bundle
+
+TARGET   = breeze_vehicle_simulator
+TEMPLATE = app
+
+INCLUDEPATH += \
+    . \
+    ../../lib/communication_link/include
+
+HEADERS += \
+    vehicle_model.h \
+    ../../lib/communication_link/include/communication_data_type.h \
+    ../../lib/communication_link/include/communication_link.h
+
+SOURCES += \
+    main.cpp \
+    vehicle_model.cpp \
+    ../../lib/communication_link/src/communication_data_type.cpp \
+    ../../lib/communication_link/src/communication_link.cpp
@@ -0,0 +1,384 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * main.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file runs a synthetic vehicle as the slave side of communication
+ * link over a pty or UDP, so that the station can be exercised without any
+ * hardware. Noise, loss and latency can be injected into the link.
+ *****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <csignal>
+#include <ctime>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <communication_link.h>
+#include <vehicle_model.h>
+
+typedef struct SimulatorPacket {
+    double                     time_due;
+    std::vector<unsigned char> data;
+} SimulatorPacket;
+
+static volatile sig_atomic_t flag_exit = 0;
+
+static void handleSignal(int signal_number)
+{
+    (void)signal_number;
+    flag_exit = 1;
+}
+
+static double getTime(void)
+{
+    struct timespec time_spec;
+    clock_gettime(CLOCK_MONOTONIC, &time_spec);
+
+    return time_spec.tv_sec + time_spec.tv_nsec * 1e-9;
+}
+
+// Open a pseudo terminal whose slave side looks like the serial port of a
+// real vehicle, the slave side is kept open so that reopening by station
+// doesn't hang up the master side.
+static int openPTY(const std::string &link_path, int *pty_slave)
+{
+    int pty_master = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if (pty_master < 0 || grantpt(pty_master) != 0 ||
+        unlockpt(pty_master) != 0) {
+        std::cerr << "Failed to open pty!" << std::endl;
+        return -1;
+    }
+
+    std::string pty_name = ptsname(pty_master);
+    *pty_slave = open(pty_name.c_str(), O_RDWR | O_NOCTTY);
+
+    struct termios pty_termios;
+
+    if (*pty_slave < 0 || tcgetattr(*pty_slave, &pty_termios) != 0) {
+        std::cerr << "Failed to open pty " << pty_name << "!" << std::endl;
+        close(pty_master);
+        return -1;
+    }
+
+    cfmakeraw(&pty_termios);
+    tcsetattr(*pty_slave, TCSANOW, &pty_termios);
+
+    if (link_path != "") {
+        unlink(link_path.c_str());
+
+        if (symlink(pty_name.c_str(), link_path.c_str()) != 0) {
+            std::cerr << "Failed to link " << link_path << "!" << std::endl;
+        }
+    }
+
+    std::cout << "Simulate vehicle on serial://"
+              << (link_path != "" ? link_path : pty_name) << std::endl;
+
+    return pty_master;
+}
+
+static int openUDP(const std::string &udp_url)
+{
+    std::string address = udp_url.substr(udp_url.find("://") + 3);
+    std::string port    = "20190";
+
+    if (address.find(':') != std::string::npos) {
+        port    = address.substr(address.find(':') + 1);
+        address = address.substr(0, address.find(':'));
+    }
+
+    struct sockaddr_in socket_address;
+    memset(&socket_address, 0, sizeof(socket_address));
+    socket_address.sin_family = AF_INET;
+    socket_address.sin_port   = htons(atoi(port.c_str()));
+
+    int udp_socket = socket(AF_INET, SOCK_DGRAM, 0);
+
+    if (udp_socket < 0 ||
+        inet_pton(AF_INET, address.c_str(), &socket_address.sin_addr) != 1 ||
+        bind(udp_socket, (struct sockaddr *)&socket_address,
+             sizeof(socket_address)) != 0) {
+        std::cerr << "Failed to open " << udp_url << "!" << std::endl;
+        return -1;
+    }
+
+    std::cout << "Simulate vehicle on " << udp_url << std::endl;
+
+    return udp_socket;
+}
+
+static void printUsage(const char *program)
+{
+    std::cout << "Usage: " << program << " [options]" << std::endl
+              << "  -u <udp_url>    serve udp://address:port instead of pty"
+              << std::endl
+              << "  -l <link_path>  symlink the pty to path" << std::endl
+              << "  -f <rate>       model update rate in Hz, default 1000"
+              << std::endl
+              << "  -i <rate>       imu sample rate in Hz, default 100"
+              << std::endl
+              << "  -h <rate>       height sample rate in Hz, default 100"
+              << std::endl
+              << "  -m <rate>       motor sample rate in Hz, default 100"
+              << std::endl
+              << "  -n <level>      noise level, 0 disables noise, default 1"
+              << std::endl
+              << "  -o <ratio>      ratio of lost replies, default 0"
+              << std::endl
+              << "  -a <ms>         latency of replies, default 0" << std::endl
+              << "  -j <ms>         jitter added to latency, default 0"
+              << std::endl
+              << "  -s <seed>       seed of noise and loss, default 1"
+              << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string udp_url    = "";
+    std::string link_path  = "";
+    double      model_rate = 1000.0;
+    double      loss_ratio = 0.0;
+    double      latency    = 0.0;
+    double      jitter     = 0.0;
+    unsigned    seed       = 1;
+
+    VehicleModel vehicle_model;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2) {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        const char *value = argv[++i];
+
+        switch (argv[i - 1][1]) {
+            case 'u': {
+                udp_url = value;
+                break;
+            }
+            case 'l': {
+                link_path = value;
+                break;
+            }
+            case 'f': {
+                model_rate = atof(value);
+                break;
+            }
+            case 'i': {
+                vehicle_model.setSensorRate(SENSOR_IMU, atof(value));
+                break;
+            }
+            case 'h': {
+                vehicle_model.setSensorRate(SENSOR_HEIGHT, atof(value));
+                break;
+            }
+            case 'm': {
+                vehicle_model.setSensorRate(SENSOR_MOTOR, atof(value));
+                break;
+            }
+            case 'n': {
+                vehicle_model.setNoiseLevel(atof(value));
+                break;
+            }
+            case 'o': {
+                loss_ratio = atof(value);
+                break;
+            }
+            case 'a': {
+                latency = atof(value) / 1000.0;
+                break;
+            }
+            case 'j': {
+                jitter = atof(value) / 1000.0;
+                break;
+            }
+            case 's': {
+                seed = strtoul(value, 0, 10);
+                vehicle_model.setNoiseSeed(seed);
+                break;
+            }
+            default: {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+    }
+
+    if (model_rate <= 0.0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    signal(SIGINT, handleSignal);
+    signal(SIGTERM, handleSignal);
+
+    int pty_slave = -1;
+    int port      = (udp_url != "") ? openUDP(udp_url) :
+        openPTY(link_path, &pty_slave);
+
+    if (port < 0) {
+        return 1;
+    }
+
+    CommunicationDataType data_type;
+    CommunicationLink     link(0x11, 0x01, &data_type);
+
+    link.setLinkMode(MODE_SLAVE);
+    vehicle_model.setLinkQuality(100.0 * (1.0 - loss_ratio));
+
+    struct sockaddr_in          peer_address;
+    socklen_t                   peer_length  = 0;
+    double                      model_step   = 1.0 / model_rate;
+    double                      model_time   = getTime();
+    double                      report_time  = model_time + 10.0;
+    unsigned long               count_recv   = 0;
+    unsigned long               count_send   = 0;
+    unsigned long               count_lost   = 0;
+    unsigned char               buffer[1024];
+    std::deque<SimulatorPacket> packets;
+
+    while (!flag_exit) {
+        double time_now = getTime();
+
+        // Catch up the model with wall clock, but never spend more than a
+        // second of steps after a stall.
+        if (time_now - model_time > 1.0) {
+            model_time = time_now - 1.0;
+        }
+
+        while (model_time + model_step <= time_now) {
+            vehicle_model.updateModel(model_step, &data_type);
+            model_time += model_step;
+        }
+
+        // Replies leave in order, so a reply never overtakes an earlier one.
+        while (!packets.empty() && packets.front().time_due <= time_now) {
+            const std::vector<unsigned char> &data = packets.front().data;
+            ssize_t length = (udp_url != "") ?
+                sendto(port, &data[0], data.size(), 0,
+                       (struct sockaddr *)&peer_address, peer_length) :
+                write(port, &data[0], data.size());
+
+            if (length == (ssize_t)data.size()) {
+                count_send++;
+            }
+
+            packets.pop_front();
+        }
+
+        if (time_now >= report_time) {
+            std::cout << "Receive " << count_recv << ", send " << count_send
+                      << ", lose " << count_lost << " packages." << std::endl;
+            report_time += 10.0;
+        }
+
+        double time_next = model_time + model_step;
+
+        if (!packets.empty() && packets.front().time_due < time_next) {
+            time_next = packets.front().time_due;
+        }
+
+        struct pollfd poll_fd;
+        poll_fd.fd     = port;
+        poll_fd.events = POLLIN;
+
+        int timeout = (int)((time_next - getTime()) * 1000.0);
+
+        if (poll(&poll_fd, 1, timeout > 0 ? timeout : 0) <= 0 ||
+            !(poll_fd.revents & POLLIN)) {
+            continue;
+        }
+
+        ssize_t length = 0;
+
+        if (udp_url != "") {
+            peer_length = sizeof(peer_address);
+            length = recvfrom(port, buffer, sizeof(buffer), 0,
+                              (struct sockaddr *)&peer_address, &peer_length);
+        }
+        else {
+            length = read(port, buffer, sizeof(buffer));
+        }
+
+        for (ssize_t i = 0; i < length; i++) {
+            if (!link.analyseReceiveByte(buffer[i])) {
+                continue;
+            }
+
+            count_recv++;
+
+            if (rand_r(&seed) < loss_ratio * ((double)RAND_MAX + 1.0)) {
+                count_lost++;
+                continue;
+            }
+
+            SimulatorPacket packet;
+            packet.time_due = getTime() + latency + jitter * rand_r(&seed) /
+                ((double)RAND_MAX + 1.0);
+            packet.data.assign(link.getSerializeData(),
+                               link.getSerializeData() +
+                               link.getSerializedLength());
+
+            if (!packets.empty() &&
+                packet.time_due < packets.back().time_due) {
+                packet.time_due = packets.back().time_due;
+            }
+
+            packets.push_back(packet);
+        }
+    }
+
+    if (pty_slave >= 0) {
+        close(pty_slave);
+    }
+
+    if (link_path != "") {
+        unlink(link_path.c_str());
+    }
+
+    close(port);
+
+    return 0;
+}
@@ -0,0 +1,315 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * vehicle_model.cpp
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .cpp file implements a simple quadcopter model for simulator.
+ *****************************************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include <vehicle_model.h>
+
+#define DEG_TO_RAD (M_PI / 180.0)
+
+VehicleModel::VehicleModel(unsigned int seed) :
+    seed_(seed),
+    time_(0.0),
+    noise_level_(1.0),
+    link_quality_(100.0),
+    alt_cmd_(0.0),
+    thrust_(0.0),
+    battery_(100.0)
+{
+    for (int i = 0; i < 3; i++) {
+        pos_[i]      = 0.0;
+        vel_[i]      = 0.0;
+        acc_[i]      = 0.0;
+        att_[i]      = 0.0;
+        att_cmd_[i]  = 0.0;
+        att_rate_[i] = 0.0;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        motor_rpm_[i]     = 0.0;
+        motor_mileage_[i] = 0.0;
+    }
+
+    for (int i = 0; i < SENSOR_LAST; i++) {
+        sensor_period_[i] = 0.01;
+        sensor_time_[i]   = 0.0;
+    }
+
+    sensor_period_[SENSOR_SYSTEM] = 1.0;
+}
+
+void VehicleModel::setNoiseSeed(unsigned int seed)
+{
+    seed_ = seed;
+}
+
+void VehicleModel::setNoiseLevel(double noise_level)
+{
+    noise_level_ = (noise_level > 0.0) ? noise_level : 0.0;
+}
+
+void VehicleModel::setSensorRate(VehicleSensor sensor, double sensor_rate)
+{
+    if (sensor_rate > 0.0) {
+        sensor_period_[sensor] = 1.0 / sensor_rate;
+    }
+}
+
+void VehicleModel::setLinkQuality(double link_quality)
+{
+    link_quality_ = link_quality;
+}
+
+void VehicleModel::updateModel(double time_step,
+                               CommunicationDataType *data_type)
+{
+    time_ += time_step;
+
+    updateCommand();
+    updateDynamics(time_step);
+
+    // Every sensor is sampled and held at its own rate, like the real board.
+    for (int i = 0; i < SENSOR_LAST; i++) {
+        if (time_ - sensor_time_[i] >= sensor_period_[i]) {
+            sensor_time_[i] = time_;
+            sampleSensor((VehicleSensor)i, data_type);
+        }
+    }
+}
+
+// Take off to 10m in 10s, then wander around with slow rolling, pitching and
+// yawing while the altitude swings by 3m.
+void VehicleModel::updateCommand(void)
+{
+    if (time_ < 10.0) {
+        alt_cmd_    = time_;
+        att_cmd_[0] = 0.0;
+        att_cmd_[1] = 0.0;
+    }
+    else {
+        alt_cmd_    = 10.0 + 3.0 * sin(2.0 * M_PI * 0.05 * (time_ - 10.0));
+        att_cmd_[0] = 15.0 * sin(2.0 * M_PI * 0.10 * time_);
+        att_cmd_[1] = 10.0 * sin(2.0 * M_PI * 0.07 * time_ + 1.0);
+    }
+
+    att_cmd_[2] = fmod(10.0 * time_, 360.0);
+}
+
+void VehicleModel::updateDynamics(double time_step)
+{
+    double att_rate_last[3];
+
+    // The attitude loop is modelled as a first order lag of 0.2s.
+    for (int i = 0; i < 3; i++) {
+        double att_error = att_cmd_[i] - att_[i];
+
+        if (i == 2) {
+            att_error = fmod(att_error + 540.0, 360.0) - 180.0;
+        }
+
+        att_rate_last[i] = att_rate_[i];
+        att_rate_[i]     = att_error / 0.2;
+        att_[i]         += att_rate_[i] * time_step;
+    }
+
+    att_[2] = fmod(att_[2] + 360.0, 360.0);
+
+    double roll  = att_[0] * DEG_TO_RAD;
+    double pitch = att_[1] * DEG_TO_RAD;
+    double yaw   = att_[2] * DEG_TO_RAD;
+    double tilt  = cos(roll) * cos(pitch);
+
+    // The altitude loop is a PD controller on the collective thrust.
+    double acc_z_cmd = 2.0 * (alt_cmd_ - pos_[2]) - 2.5 * vel_[2];
+    thrust_ = VEHICLE_HOVER_THRUST * (1.0 + acc_z_cmd / VEHICLE_GRAVITY) /
+        (tilt > 0.5 ? tilt : 0.5);
+    thrust_ = (thrust_ < 0.0) ? 0.0 : ((thrust_ > 100.0) ? 100.0 : thrust_);
+
+    if (pos_[2] <= 0.0 && time_ < 0.5) {
+        thrust_ = 0.0;
+    }
+
+    // The thrust tilted by attitude drives the vehicle, and the drag slows it.
+    double force = VEHICLE_GRAVITY * thrust_ / VEHICLE_HOVER_THRUST;
+    double force_body[3] = { 0.0, 0.0, force };
+    double force_world[3];
+
+    force_world[0] = (cos(yaw) * sin(pitch) * cos(roll) +
+                      sin(yaw) * sin(roll)) * force_body[2];
+    force_world[1] = (sin(yaw) * sin(pitch) * cos(roll) -
+                      cos(yaw) * sin(roll)) * force_body[2];
+    force_world[2] = tilt * force_body[2];
+
+    for (int i = 0; i < 3; i++) {
+        acc_[i] = force_world[i] - 0.3 * vel_[i];
+    }
+
+    acc_[2] -= VEHICLE_GRAVITY;
+
+    for (int i = 0; i < 3; i++) {
+        vel_[i] += acc_[i] * time_step;
+        pos_[i] += vel_[i] * time_step;
+    }
+
+    if (pos_[2] < 0.0) {
+        pos_[2] = 0.0;
+        vel_[2] = (vel_[2] < 0.0) ? 0.0 : vel_[2];
+        acc_[2] = (acc_[2] < 0.0) ? 0.0 : acc_[2];
+    }
+
+    // Motors share the thrust and differ by the angular acceleration of roll,
+    // pitch and yaw in X configuration.
+    double rpm_base = VEHICLE_MAX_RPM * sqrt(thrust_ / 100.0);
+    double mix_r    = 4.0 * (att_rate_[0] - att_rate_last[0]) / time_step;
+    double mix_p    = 4.0 * (att_rate_[1] - att_rate_last[1]) / time_step;
+    double mix_y    = 2.0 * att_rate_[2];
+    double mix[4][3] = {
+        { -1.0,  1.0,  1.0 },
+        { -1.0, -1.0, -1.0 },
+        {  1.0, -1.0,  1.0 },
+        {  1.0,  1.0, -1.0 }
+    };
+
+    for (int i = 0; i < 4; i++) {
+        double rpm = rpm_base + mix[i][0] * mix_r + mix[i][1] * mix_p +
+            mix[i][2] * mix_y;
+        motor_rpm_[i]      = (rpm < 0.0) ? 0.0 :
+            ((rpm > VEHICLE_MAX_RPM) ? VEHICLE_MAX_RPM : rpm);
+        motor_mileage_[i] += motor_rpm_[i] / 60.0 * time_step;
+    }
+
+    // A full battery lasts about 15 minutes at hover.
+    battery_ -= thrust_ / VEHICLE_HOVER_THRUST * 100.0 / 900.0 * time_step;
+    battery_  = (battery_ < 0.0) ? 0.0 : battery_;
+}
+
+void VehicleModel::sampleSensor(VehicleSensor sensor,
+                                CommunicationDataType *data_type)
+{
+    switch (sensor) {
+        case SENSOR_IMU: {
+            double roll  = att_[0] * DEG_TO_RAD;
+            double pitch = att_[1] * DEG_TO_RAD;
+            double yaw   = att_[2] * DEG_TO_RAD;
+            double force[3] = { acc_[0], acc_[1],
+                                acc_[2] + VEHICLE_GRAVITY };
+
+            // The accelerometer measures the specific force in body frame.
+            double force_yaw[2] = {
+                 cos(yaw) * force[0] + sin(yaw) * force[1],
+                -sin(yaw) * force[0] + cos(yaw) * force[1]
+            };
+            double force_x = cos(pitch) * force_yaw[0] - sin(pitch) * force[2];
+            double force_z = sin(pitch) * force_yaw[0] + cos(pitch) * force[2];
+            double force_y = cos(roll) * force_yaw[1] + sin(roll) * force_z;
+            force_z        = -sin(roll) * force_yaw[1] + cos(roll) * force_z;
+
+            data_type->robot_imu_actual_.acc.acc_x = force_x + getNoise(0.05);
+            data_type->robot_imu_actual_.acc.acc_y = force_y + getNoise(0.05);
+            data_type->robot_imu_actual_.acc.acc_z = force_z + getNoise(0.05);
+            data_type->robot_imu_actual_.att.att_r = att_[0] + getNoise(0.2);
+            data_type->robot_imu_actual_.att.att_p = att_[1] + getNoise(0.2);
+            data_type->robot_imu_actual_.att.att_y = att_[2] + getNoise(0.5);
+
+            data_type->global_coordinate_actual_.axis_x = pos_[0];
+            data_type->global_coordinate_actual_.axis_y = pos_[1];
+            data_type->global_coordinate_actual_.axis_z = pos_[2];
+
+            data_type->global_coord_speed_actual_.axis_x = vel_[0];
+            data_type->global_coord_speed_actual_.axis_y = vel_[1];
+            data_type->global_coord_speed_actual_.axis_z = vel_[2];
+
+            data_type->robot_coordinate_actual_ =
+                data_type->global_coordinate_actual_;
+
+            data_type->robot_coord_speed_actual_.axis_x =
+                 cos(yaw) * vel_[0] + sin(yaw) * vel_[1];
+            data_type->robot_coord_speed_actual_.axis_y =
+                -sin(yaw) * vel_[0] + cos(yaw) * vel_[1];
+            data_type->robot_coord_speed_actual_.axis_z = vel_[2];
+
+            data_type->robot_space_pose_actual_.coo =
+                data_type->global_coordinate_actual_;
+            data_type->robot_space_pose_actual_.att =
+                data_type->robot_imu_actual_.att;
+            break;
+        }
+        case SENSOR_HEIGHT: {
+            data_type->robot_height_actual_.alt = VEHICLE_SITE_ALT + pos_[2] +
+                getNoise(0.3);
+            data_type->robot_height_actual_.hei = pos_[2] + getNoise(0.02);
+            break;
+        }
+        case SENSOR_MOTOR: {
+            DataTypeMotor &motor_speed   = data_type->motor_speed_actual_;
+            DataTypeMotor &motor_mileage = data_type->motor_mileage_actual_;
+
+            motor_speed.motor_a   = motor_rpm_[0] + getNoise(20.0);
+            motor_speed.motor_b   = motor_rpm_[1] + getNoise(20.0);
+            motor_speed.motor_c   = motor_rpm_[2] + getNoise(20.0);
+            motor_speed.motor_d   = motor_rpm_[3] + getNoise(20.0);
+            motor_mileage.motor_a = motor_mileage_[0];
+            motor_mileage.motor_b = motor_mileage_[1];
+            motor_mileage.motor_c = motor_mileage_[2];
+            motor_mileage.motor_d = motor_mileage_[3];
+
+            data_type->motor_thrust_actual_.thrust = thrust_;
+            break;
+        }
+        case SENSOR_SYSTEM: {
+            data_type->robot_system_info_actual_.battery_capacity = battery_;
+            data_type->robot_system_info_actual_.link_quality = link_quality_;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+// Gaussian noise from Box-Muller transform.
+double VehicleModel::getNoise(double stddev)
+{
+    if (noise_level_ <= 0.0) {
+        return 0.0;
+    }
+
+    double u = (rand_r(&seed_) + 1.0) / ((double)RAND_MAX + 2.0);
+    double v = (rand_r(&seed_) + 1.0) / ((double)RAND_MAX + 2.0);
+
+    return noise_level_ * stddev * sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
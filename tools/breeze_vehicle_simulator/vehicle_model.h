@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Software License Agreement (GPL V3 License)
+ *
+ * Copyright (c) 2018 myyerrol(Team MicroDynamics)
+ *
+ * This file is part of breeze_flight_control_station.
+ *
+ * breeze_flight_control_station is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+
+ * breeze_flight_control_station is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+ * Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with breeze_flight_control_station.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ ******************************************************************************
+
+ ******************************************************************************
+ * File:
+ * vehicle_model.h
+ *
+ * Author:
+ * myyerrol<myyerrol@126.com>
+ *
+ * History:
+ * <Authors>     <Date>         <Version>     <Operation>
+ * myyerrol      2026.10.18     1.0.0         Create this file
+ *
+ * Description:
+ * This .h file defines a simple quadcopter model, which flies a scripted
+ * manoeuvre and samples its sensors with noise into data types.
+ *****************************************************************************/
+
+#ifndef VEHICLE_MODEL_H
+#define VEHICLE_MODEL_H
+
+#include <communication_data_type.h>
+
+#define VEHICLE_GRAVITY      9.80665
+#define VEHICLE_SITE_ALT     50.0
+#define VEHICLE_HOVER_THRUST 50.0
+#define VEHICLE_MAX_RPM      9000.0
+
+typedef enum VehicleSensor {
+    SENSOR_IMU,
+    SENSOR_HEIGHT,
+    SENSOR_MOTOR,
+    SENSOR_SYSTEM,
+    SENSOR_LAST
+} VehicleSensor;
+
+class VehicleModel
+{
+public:
+    VehicleModel(unsigned int seed = 1);
+    void setNoiseSeed(unsigned int seed);
+    void setNoiseLevel(double noise_level);
+    void setSensorRate(VehicleSensor sensor, double sensor_rate);
+    void setLinkQuality(double link_quality);
+    void updateModel(double time_step, CommunicationDataType *data_type);
+private:
+    void updateCommand(void);
+    void updateDynamics(double time_step);
+    void sampleSensor(VehicleSensor sensor, CommunicationDataType *data_type);
+    double getNoise(double stddev);
+private:
+    unsigned int seed_;
+    double       time_;
+    double       noise_level_;
+    double       link_quality_;
+    double       sensor_period_[SENSOR_LAST];
+    double       sensor_time_[SENSOR_LAST];
+    double       pos_[3], vel_[3], acc_[3];
+    double       att_[3], att_cmd_[3], att_rate_[3];
+    double       alt_cmd_;
+    double       thrust_;
+    double       battery_;
+    double       motor_rpm_[4];
+    double       motor_mileage_[4];
+};
+
+#endif // VEHICLE_MODEL_H